@@ -354,6 +354,16 @@ class CPPCACHE_EXPORT AttributesFactory {
   */
   void setCloningEnabled(bool isClonable);
 
+  /**
+  * Keeps the values of the region serialized in slab arenas instead of as
+  * objects, so that many small values take a fraction of the heap. Every
+  * read deserializes a fresh copy of the value, and values larger than 1KB
+  * stay objects. Disabled by default.
+  * @param enable whether to store the values in arenas
+  * @see RegionAttributes#getArenaStorageEnabled()
+  */
+  void setArenaStorageEnabled(bool enable);
+
   /**
   * Enables or disables concurrent modification checks
   * @since 7.0
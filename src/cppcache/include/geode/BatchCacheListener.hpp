@@ -0,0 +1,126 @@
+#pragma once
+
+#ifndef GEODE_BATCHCACHELISTENER_H_
+#define GEODE_BATCHCACHELISTENER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "geode_globals.hpp"
+#include "geode_types.hpp"
+#include "CacheListener.hpp"
+#include "EntryEvent.hpp"
+
+#include <vector>
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class BatchCacheListener BatchCacheListener.hpp
+ * A <code>CacheListener</code> that receives the entry events of
+ * notifications from the server in batches instead of one at a time, for
+ * listeners that forward the events to another system and are better off
+ * writing many at once.
+ *
+ * Entry notifications are collected into a batch until it holds
+ * <code>getMaxBatchSize</code> events or <code>getBatchTimeInterval</code>
+ * milliseconds have passed, and the batch is then handed to
+ * <code>afterEvents</code> in the order the events were applied. A pending
+ * batch is also delivered before any region event of a notification, and
+ * when the region is closed. For a durable client the events of a batch are
+ * acknowledged to the server by the periodic ack only after
+ * <code>afterEvents</code> has returned, so a batch that was not delivered
+ * is sent again after failover or reconnect.
+ *
+ * Entry events of operations done by this client are not batched; they are
+ * delivered to the <code>CacheListener</code> methods as usual.
+ *
+ * @see CacheListener
+ */
+class CPPCACHE_EXPORT BatchCacheListener : public CacheListener {
+ public:
+  /** The default for the maximum number of events in a batch. */
+  static const uint32_t DEFAULT_MAX_BATCH_SIZE = 100;
+
+  /** The default for the time a batch is held, in milliseconds. */
+  static const uint32_t DEFAULT_BATCH_TIME_INTERVAL = 1000;
+
+  /** The operation of an event in a batch. */
+  enum Operation { CREATE, UPDATE, INVALIDATE, DESTROY };
+
+  /** An entry event in a batch, along with its operation. */
+  class CPPCACHE_EXPORT Event : public EntryEvent {
+   public:
+    Event(Operation operation, const RegionPtr& region,
+          const CacheableKeyPtr& key, const CacheablePtr& oldValue,
+          const CacheablePtr& newValue, const UserDataPtr& aCallbackArgument,
+          const bool remoteOrigin);
+
+    virtual ~Event();
+
+    /** @return the operation that caused this event. */
+    inline Operation getOperation() const { return m_operation; }
+
+   private:
+    Operation m_operation;
+  };
+
+  typedef std::shared_ptr<Event> EventPtr;
+
+  virtual ~BatchCacheListener();
+
+  /**
+   * Handles a batch of entry events received from the server.
+   *
+   * @param events the events of the batch, in the order they were applied
+   * to the region
+   */
+  virtual void afterEvents(const std::vector<EventPtr>& events) = 0;
+
+  /** @return the maximum number of events in a batch */
+  uint32_t getMaxBatchSize() const { return m_maxBatchSize; }
+
+  /**
+   * @return the time in milliseconds after which a batch is delivered
+   * even if it is not full
+   */
+  uint32_t getBatchTimeInterval() const { return m_batchTimeInterval; }
+
+ protected:
+  /**
+   * @param maxBatchSize the maximum number of events in a batch, at least 1
+   * @param batchTimeInterval the time in milliseconds after which a batch
+   * is delivered even if it is not full, at least 1
+   */
+  BatchCacheListener(uint32_t maxBatchSize = DEFAULT_MAX_BATCH_SIZE,
+                     uint32_t batchTimeInterval = DEFAULT_BATCH_TIME_INTERVAL);
+
+ private:
+  uint32_t m_maxBatchSize;
+  uint32_t m_batchTimeInterval;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_BATCHCACHELISTENER_H_
@@ -405,6 +405,32 @@ class CPPCACHE_EXPORT CacheFactory : public std::enable_shared_from_this<CacheFa
    */
   CacheFactoryPtr setPRSingleHopEnabled(bool enabled);
 
+  /**
+   * Sets whether simple operations are pipelined over a shared connection per
+   * server.
+   * @see PoolFactory#setMultiplexedConnections
+   * @param enabled whether simple operations share a multiplexed connection.
+   * @return a reference to <code>this</code>
+   */
+  CacheFactoryPtr setMultiplexedConnections(bool enabled);
+
+  /**
+   * Sets whether PDX values received from the servers are kept serialized
+   * until first access.
+   * @see PoolFactory#setLazyDeserialization
+   * @param enabled whether PDX values are kept serialized until first access.
+   * @return a reference to <code>this</code>
+   */
+  CacheFactoryPtr setLazyDeserialization(bool enabled);
+
+  /**
+   * Sets the maximum number of keys sent to a server in one getAll request.
+   * @see PoolFactory#setGetAllBatchSize
+   * @param batchSize the maximum number of keys in a getAll request.
+   * @return a reference to <code>this</code>
+   */
+  CacheFactoryPtr setGetAllBatchSize(int batchSize);
+
   /**
   * Control whether pdx ignores fields that were unread during deserialization.
   * The default is to preserve unread fields be including their data during
@@ -0,0 +1,118 @@
+#pragma once
+
+#ifndef GEODE_CACHEDDESERIALIZABLE_H_
+#define GEODE_CACHEDDESERIALIZABLE_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "geode_globals.hpp"
+#include "geode_types.hpp"
+#include "Cacheable.hpp"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+/** @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class CachedDeserializable CachedDeserializable.hpp
+ * A PDX value received from a server, kept as its serialized bytes until the
+ * application first asks for it. Returned in place of the value by pools with
+ * lazy deserialization enabled.
+ *
+ * <code>getDeserializedValue</code> deserializes the bytes on the first call
+ * and returns the same object afterwards. Writing a
+ * <code>CachedDeserializable</code>, for example putting it into another
+ * region, writes the received bytes unchanged without deserializing them.
+ *
+ * @see PoolFactory::setLazyDeserialization
+ */
+class CPPCACHE_EXPORT CachedDeserializable : public Cacheable {
+ public:
+  /**
+   * Returns the deserialized value, deserializing the bytes on the first
+   * call. Thread safe.
+   */
+  CacheablePtr getDeserializedValue() const;
+
+  /** Returns true if the value has already been deserialized. */
+  bool isDeserialized() const;
+
+  /** Returns the serialized bytes, starting with the type id byte. */
+  inline const uint8_t* getSerializedValue() const { return &m_bytes[0]; }
+
+  /** Returns the number of serialized bytes. */
+  inline int32_t getSerializedLength() const {
+    return static_cast<int32_t>(m_bytes.size());
+  }
+
+  /**
+   *@brief serialize this object, writing the serialized bytes after the type
+   * id byte already written by the caller.
+   **/
+  virtual void toData(DataOutput& output) const;
+
+  /**
+   *@brief not supported, a CachedDeserializable is never read from a stream.
+   **/
+  virtual Serializable* fromData(DataInput& input);
+
+  virtual int32_t classId() const;
+
+  /**
+   *@brief return the type id byte of the serialized value.
+   **/
+  virtual int8_t typeId() const;
+
+  virtual uint32_t objectSize() const;
+
+  /**
+   * Factory method that copies the <code>length</code> serialized bytes of a
+   * value starting at <code>bytes</code>. <code>poolName</code>, if not
+   * null, is the pool used to fetch unknown PDX types on deserialization.
+   */
+  static CachedDeserializablePtr create(const uint8_t* bytes, int32_t length,
+                                        const char* poolName = nullptr);
+
+ protected:
+  CachedDeserializable(const uint8_t* bytes, int32_t length,
+                       const char* poolName);
+
+ private:
+  std::vector<uint8_t> m_bytes;
+  std::string m_poolName;
+  mutable std::mutex m_mutex;
+  mutable CacheablePtr m_value;
+
+  // never implemented.
+  CachedDeserializable& operator=(const CachedDeserializable& other);
+  CachedDeserializable(const CachedDeserializable& other);
+
+  FRIEND_STD_SHARED_PTR(CachedDeserializable)
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_CACHEDDESERIALIZABLE_H_
@@ -0,0 +1,234 @@
+#pragma once
+
+#ifndef GEODE_COLUMNARSTRUCTSET_H_
+#define GEODE_COLUMNARSTRUCTSET_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "geode_globals.hpp"
+#include "geode_types.hpp"
+#include "Cacheable.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class ColumnarStructSetCursor;
+
+/**
+ * @class ColumnarStructSet ColumnarStructSet.hpp
+ *
+ * The results of a query stored column by column, as returned by
+ * <code>Query::executeColumnar</code>. Integral, floating point and string
+ * fields are decoded straight into one array per field with a bitmap of
+ * null values, instead of a Struct and a Cacheable per row and field. The
+ * fields of a query that returns single values rather than structs are
+ * stored in a single column with an empty name.
+ *
+ * A column holds 64-bit integers, doubles or strings if all the non null
+ * values received for it are of one of those kinds; byte, short and int
+ * values are widened to 64-bit integers and floats to doubles. Any other
+ * column keeps its values as objects of the types they were received as.
+ */
+class CPPCACHE_EXPORT ColumnarStructSet {
+ public:
+  /** The kind of values stored in a column. */
+  enum ColumnType {
+    /** Every value of the column is null. */
+    NULL_COLUMN = 0,
+    INT64_COLUMN,
+    DOUBLE_COLUMN,
+    STRING_COLUMN,
+    OBJECT_COLUMN
+  };
+
+  /**
+   * Get the number of rows.
+   */
+  virtual int32_t size() const = 0;
+
+  /**
+   * Get the number of fields, and so of columns, of each row.
+   */
+  virtual int32_t getFieldCount() const = 0;
+
+  /**
+   * Get the index number of the specified field name.
+   *
+   * @param fieldname the field name for which the index is required.
+   * @returns the index number of the specified field name.
+   * @throws IllegalArgumentException if the field name is not found.
+   */
+  virtual int32_t getFieldIndex(const char* fieldname) const = 0;
+
+  /**
+   * Get the field name from the specified index number.
+   *
+   * @param index the index number of the field name to get.
+   * @returns the field name from the specified index number or nullptr if not
+   * found.
+   */
+  virtual const char* getFieldName(int32_t index) const = 0;
+
+  /**
+   * Get the kind of values stored for the specified field.
+   *
+   * @throws IllegalArgumentException if the field index is out of bounds.
+   */
+  virtual ColumnType getColumnType(int32_t field) const = 0;
+
+  /**
+   * Check whether the value of a field is null.
+   *
+   * @throws IllegalArgumentException if the row or field index is out of
+   * bounds.
+   */
+  virtual bool isNull(int32_t row, int32_t field) const = 0;
+
+  /**
+   * Get the value of a field of an <code>INT64_COLUMN</code>.
+   *
+   * @returns the value, or 0 if it is null.
+   * @throws IllegalArgumentException if the row or field index is out of
+   * bounds.
+   * @throws IllegalStateException if the value is not null and the column is
+   * of another type.
+   */
+  virtual int64_t getInt64(int32_t row, int32_t field) const = 0;
+
+  /**
+   * Get the value of a field of a <code>DOUBLE_COLUMN</code>.
+   *
+   * @returns the value, or 0 if it is null.
+   * @throws IllegalArgumentException if the row or field index is out of
+   * bounds.
+   * @throws IllegalStateException if the value is not null and the column is
+   * of another type.
+   */
+  virtual double getDouble(int32_t row, int32_t field) const = 0;
+
+  /**
+   * Get the value of a field of a <code>STRING_COLUMN</code>, in the java
+   * modified UTF-8 encoding the server uses, which is UTF-8 for characters
+   * other than NUL and those outside the Basic Multilingual Plane. The
+   * string is owned by this <code>ColumnarStructSet</code>.
+   *
+   * @returns the value, or nullptr if it is null.
+   * @throws IllegalArgumentException if the row or field index is out of
+   * bounds.
+   * @throws IllegalStateException if the value is not null and the column is
+   * of another type.
+   */
+  virtual const char* getString(int32_t row, int32_t field) const = 0;
+
+  /**
+   * Get the value of a field of any column as an object, of the same type
+   * as the one <code>Query::execute</code> returns for it. Values of typed
+   * columns are returned as new objects.
+   *
+   * @returns a smart pointer to the value, or nullptr if it is null.
+   * @throws IllegalArgumentException if the row or field index is out of
+   * bounds.
+   */
+  virtual CacheablePtr getObject(int32_t row, int32_t field) const = 0;
+
+  /**
+   * Get a cursor positioned before the first row.
+   */
+  virtual ColumnarStructSetCursor getCursor() const = 0;
+
+  /**
+   * Destructor
+   */
+  virtual ~ColumnarStructSet() {}
+};
+
+/**
+ * @class ColumnarStructSetCursor ColumnarStructSet.hpp
+ * A ColumnarStructSetCursor is obtained from a ColumnarStructSet and is used
+ * to read the fields of its rows one row at a time.
+ */
+class CPPCACHE_EXPORT ColumnarStructSetCursor {
+ public:
+  /**
+   * Move the cursor to the next row.
+   *
+   * @returns true if another row was available to move to otherwise false.
+   */
+  inline bool next() {
+    if (m_row < m_set->size()) {
+      ++m_row;
+    }
+    return m_row < m_set->size();
+  }
+
+  /**
+   * Get the index number of the current row.
+   */
+  inline int32_t getRow() const { return m_row; }
+
+  /**
+   * Reset the cursor to point before the first row.
+   */
+  inline void reset() { m_row = -1; }
+
+  /** @see ColumnarStructSet::isNull */
+  inline bool isNull(int32_t field) const {
+    return m_set->isNull(m_row, field);
+  }
+
+  /** @see ColumnarStructSet::getInt64 */
+  inline int64_t getInt64(int32_t field) const {
+    return m_set->getInt64(m_row, field);
+  }
+
+  /** @see ColumnarStructSet::getDouble */
+  inline double getDouble(int32_t field) const {
+    return m_set->getDouble(m_row, field);
+  }
+
+  /** @see ColumnarStructSet::getString */
+  inline const char* getString(int32_t field) const {
+    return m_set->getString(m_row, field);
+  }
+
+  /** @see ColumnarStructSet::getObject */
+  inline CacheablePtr getObject(int32_t field) const {
+    return m_set->getObject(m_row, field);
+  }
+
+  /**
+   * Constructor - meant only for internal use.
+   */
+  explicit ColumnarStructSetCursor(const ColumnarStructSetPtr& set)
+      : m_set(set), m_row(-1) {}
+
+ private:
+  // keeps the ColumnarStructSet alive while the cursor is in use
+  ColumnarStructSetPtr m_set;
+  int32_t m_row;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COLUMNARSTRUCTSET_H_
@@ -33,6 +33,7 @@
 #include "CacheableObjectArray.hpp"
 #include "CacheableString.hpp"
 #include "CacheableUndefined.hpp"
+#include "CachedDeserializable.hpp"
 #include "CacheFactory.hpp"
 #include "Cache.hpp"
 #include "GeodeCache.hpp"
@@ -69,6 +70,7 @@
 #include "Serializable.hpp"
 #include <memory>
 #include "StructSet.hpp"
+#include "ColumnarStructSet.hpp"
 #include "UserData.hpp"
 #include "VectorT.hpp"
 #include "TransactionId.hpp"
@@ -78,6 +80,7 @@
 #include "WritablePdxInstance.hpp"
 #include "PdxWrapper.hpp"
 #include "PdxSerializer.hpp"
+#include "PdxAutoSerializable.hpp"
 #include "CacheableEnum.hpp"
 #include "CqStatusListener.hpp"
 #include "PdxFieldTypes.hpp"
@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef GEODE_GETALLLISTENER_H_
+#define GEODE_GETALLLISTENER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "geode_globals.hpp"
+#include "geode_types.hpp"
+#include "HashMapT.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class GetAllListener GetAllListener.hpp
+ * Receives the results of a {@link Region::getAll} as they arrive instead of
+ * once the whole operation has completed.
+ *
+ * The keys of a getAll are split by server and into batches of at most the
+ * pool's getall-batch-size keys, which are in flight concurrently. Each
+ * chunk of a server reply is handed to the listener as soon as it has been
+ * read, so the methods are invoked several times per getAll and may be
+ * invoked concurrently from different threads. Values found in the local
+ * cache are delivered first, on the calling thread. The getAll returns
+ * once every reply has been delivered.
+ *
+ * Exceptions thrown by the listener are caught and logged.
+ *
+ * @see Region::getAll
+ * @see PoolFactory::setGetAllBatchSize
+ */
+class CPPCACHE_EXPORT GetAllListener {
+ public:
+  virtual ~GetAllListener();
+
+  /**
+   * Called with the values of one batch of keys; keys that do not exist
+   * have no entry in the map.
+   */
+  virtual void onValues(const HashMapOfCacheable& values) = 0;
+
+  /**
+   * Called with the keys of one batch that could not be read and the
+   * exception for each. The default implementation does nothing.
+   */
+  virtual void onExceptions(const HashMapOfException& exceptions);
+
+ protected:
+  GetAllListener();
+
+ private:
+  // never implemented.
+  GetAllListener(const GetAllListener& other);
+  void operator=(const GetAllListener& other);
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_GETALLLISTENER_H_
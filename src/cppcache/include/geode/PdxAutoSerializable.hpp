@@ -0,0 +1,329 @@
+#pragma once
+
+#ifndef GEODE_PDXAUTOSERIALIZABLE_H_
+#define GEODE_PDXAUTOSERIALIZABLE_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "geode_globals.hpp"
+#include "PdxSerializable.hpp"
+#include "PdxWriter.hpp"
+#include "PdxReader.hpp"
+#include "DataOutput.hpp"
+#include "DataInput.hpp"
+#include "GeodeTypeIds.hpp"
+
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @brief Describes how a field of type <code>F</code> of a
+ * <code>PdxAutoSerializable</code> is written and read, both through the
+ * <code>PdxWriter</code>/<code>PdxReader</code> and directly on the stream.
+ *
+ * Specializations are provided for bool, int8_t, int16_t, int32_t, int64_t,
+ * float, double and std::string. A field of any other type fails to
+ * compile unless the application provides a specialization with the same
+ * members, writing the same bytes as the matching <code>PdxWriter</code>
+ * method.
+ */
+template <typename F>
+struct PdxFieldTraits;
+
+#define _GF_PDX_FIELD_TRAITS_(t, pdxWrite, pdxRead, streamWrite, streamRead) \
+  template <>                                                                \
+  struct PdxFieldTraits<t> {                                                 \
+    static const bool isVariableLength = false;                              \
+    inline static void write(PdxWriter& writer, const char* fieldName,       \
+                             const t& value) {                               \
+      writer.pdxWrite(fieldName, value);                                     \
+    }                                                                        \
+    inline static void read(PdxReader& reader, const char* fieldName,        \
+                            t& value) {                                      \
+      value = reader.pdxRead(fieldName);                                     \
+    }                                                                        \
+    inline static void write(DataOutput& output, const t& value) {           \
+      output.streamWrite(value);                                             \
+    }                                                                        \
+    inline static void read(DataInput& input, t& value) {                    \
+      input.streamRead(&value);                                              \
+    }                                                                        \
+  }
+
+_GF_PDX_FIELD_TRAITS_(bool, writeBoolean, readBoolean, writeBoolean,
+                      readBoolean);
+_GF_PDX_FIELD_TRAITS_(int8_t, writeByte, readByte, write, read);
+_GF_PDX_FIELD_TRAITS_(int16_t, writeShort, readShort, writeInt, readInt);
+_GF_PDX_FIELD_TRAITS_(int32_t, writeInt, readInt, writeInt, readInt);
+_GF_PDX_FIELD_TRAITS_(int64_t, writeLong, readLong, writeInt, readInt);
+_GF_PDX_FIELD_TRAITS_(float, writeFloat, readFloat, writeFloat, readFloat);
+_GF_PDX_FIELD_TRAITS_(double, writeDouble, readDouble, writeDouble,
+                      readDouble);
+
+template <>
+struct CPPCACHE_EXPORT PdxFieldTraits<std::string> {
+  static const bool isVariableLength = true;
+
+  inline static void write(PdxWriter& writer, const char* fieldName,
+                           const std::string& value) {
+    writer.writeString(fieldName, value.c_str());
+  }
+
+  inline static void read(PdxReader& reader, const char* fieldName,
+                          std::string& value) {
+    char* str = reader.readString(fieldName);
+    assign(value, str);
+    freeReaderString(str);
+  }
+
+  inline static void write(DataOutput& output, const std::string& value) {
+    const char* str = value.c_str();
+    if (DataOutput::getEncodedLength(str) > 0xffff) {
+      output.write(static_cast<int8_t>(GeodeTypeIds::CacheableStringHuge));
+      output.writeUTFHuge(str);
+    } else {
+      output.write(static_cast<int8_t>(GeodeTypeIds::CacheableString));
+      output.writeUTF(str);
+    }
+  }
+
+  inline static void read(DataInput& input, std::string& value) {
+    char* str = nullptr;
+    input.readString(&str);
+    assign(value, str);
+    DataInput::freeUTFMemory(str);
+  }
+
+ private:
+  inline static void assign(std::string& value, const char* str) {
+    if (str == nullptr) {
+      value.clear();
+    } else {
+      value = str;
+    }
+  }
+
+  /**
+   * Frees a string returned by <code>PdxReader::readString</code>, unless
+   * it is the empty string the reader shares for fields missing from the
+   * serialized type.
+   */
+  static void freeReaderString(char* str);
+};
+
+/**
+ * @class PdxAutoSerializableBase PdxAutoSerializable.hpp
+ * The part of <code>PdxAutoSerializable</code> that the library uses to
+ * write and read the fields directly on the stream. Applications derive
+ * from <code>PdxAutoSerializable</code> instead.
+ */
+class CPPCACHE_EXPORT PdxAutoSerializableBase : public PdxSerializable {
+ public:
+  virtual ~PdxAutoSerializableBase();
+
+  /** Number of fields written by the object. */
+  virtual int32_t getPdxFieldCount() const = 0;
+
+  /** Number of those fields that are of variable length. */
+  virtual int32_t getPdxVariableLengthFieldCount() const = 0;
+
+  /**
+   * Writes the fields in declaration order, starting at fieldsOffset in
+   * output, and appends the position of each variable length field,
+   * relative to fieldsOffset, to offsets.
+   */
+  virtual void writePdxFields(DataOutput& output, int32_t fieldsOffset,
+                              std::vector<int32_t>& offsets) = 0;
+
+  /** Reads the fields in declaration order. */
+  virtual void readPdxFields(DataInput& input) = 0;
+};
+
+/**
+ * @class PdxAutoSerializable PdxAutoSerializable.hpp
+ * Base for PDX domain classes whose serialization code is generated from a
+ * list of their fields. T derives from
+ * <code>PdxAutoSerializable<T></code>, implements
+ * <code>getClassName</code> and lists its fields, in the order they are
+ * written, in a member template:
+ *
+ * <pre>
+ * class Order : public PdxAutoSerializable<Order> {
+ *  public:
+ *   template <typename Fields>
+ *   void pdxFields(Fields& fields) {
+ *     fields("id", m_id)("name", m_name)("price", m_price);
+ *   }
+ *   virtual const char* getClassName() const { return "Order"; }
+ *
+ *  private:
+ *   int32_t m_id;
+ *   std::string m_name;
+ *   double m_price;
+ * };
+ * </pre>
+ *
+ * The <code>toData</code> and <code>fromData</code> generated from the list
+ * use the <code>PdxWriter</code> and <code>PdxReader</code> like hand written
+ * ones. Once the local PDX type of the class is known, objects without
+ * preserved unread fields are written and read straight on the stream in
+ * the same wire format instead: each field is written by its
+ * <code>PdxFieldTraits</code>, inlined into the generated code, without a
+ * field name or a virtual call. The number of fields and of variable length
+ * fields, and so the size of the offset table, are computed once per class.
+ *
+ * T must be default constructible; it is registered with
+ * <code>Serializable::registerPdxType(T::createDeserializable)</code>.
+ */
+template <typename T>
+class PdxAutoSerializable : public PdxAutoSerializableBase {
+ public:
+  virtual void toData(PdxWriterPtr writer) {
+    WriterFields fields(*writer);
+    static_cast<T*>(this)->pdxFields(fields);
+  }
+
+  virtual void fromData(PdxReaderPtr reader) {
+    ReaderFields fields(*reader);
+    static_cast<T*>(this)->pdxFields(fields);
+  }
+
+  virtual int32_t getPdxFieldCount() const { return getLayout().m_fields; }
+
+  virtual int32_t getPdxVariableLengthFieldCount() const {
+    return getLayout().m_variableLengthFields;
+  }
+
+  virtual void writePdxFields(DataOutput& output, int32_t fieldsOffset,
+                              std::vector<int32_t>& offsets) {
+    StreamWriterFields fields(output, fieldsOffset, offsets);
+    static_cast<T*>(this)->pdxFields(fields);
+  }
+
+  virtual void readPdxFields(DataInput& input) {
+    StreamReaderFields fields(input);
+    static_cast<T*>(this)->pdxFields(fields);
+  }
+
+  static PdxSerializable* createDeserializable() { return new T(); }
+
+ private:
+  struct Layout {
+    Layout() : m_fields(0), m_variableLengthFields(0) {}
+
+    int32_t m_fields;
+    int32_t m_variableLengthFields;
+
+    template <typename F>
+    Layout& operator()(const char*, F&) {
+      ++m_fields;
+      if (PdxFieldTraits<F>::isVariableLength) {
+        ++m_variableLengthFields;
+      }
+      return *this;
+    }
+  };
+
+  static const Layout& getLayout() {
+    static const Layout layout = makeLayout();
+    return layout;
+  }
+
+  static Layout makeLayout() {
+    Layout layout;
+    T object;
+    object.pdxFields(layout);
+    return layout;
+  }
+
+  class WriterFields {
+   public:
+    explicit WriterFields(PdxWriter& writer) : m_writer(writer) {}
+
+    template <typename F>
+    WriterFields& operator()(const char* fieldName, F& value) {
+      PdxFieldTraits<F>::write(m_writer, fieldName, value);
+      return *this;
+    }
+
+   private:
+    PdxWriter& m_writer;
+  };
+
+  class ReaderFields {
+   public:
+    explicit ReaderFields(PdxReader& reader) : m_reader(reader) {}
+
+    template <typename F>
+    ReaderFields& operator()(const char* fieldName, F& value) {
+      PdxFieldTraits<F>::read(m_reader, fieldName, value);
+      return *this;
+    }
+
+   private:
+    PdxReader& m_reader;
+  };
+
+  class StreamWriterFields {
+   public:
+    StreamWriterFields(DataOutput& output, int32_t fieldsOffset,
+                       std::vector<int32_t>& offsets)
+        : m_output(output), m_fieldsOffset(fieldsOffset), m_offsets(offsets) {}
+
+    template <typename F>
+    StreamWriterFields& operator()(const char*, F& value) {
+      if (PdxFieldTraits<F>::isVariableLength) {
+        m_offsets.push_back(m_output.getBufferLength() - m_fieldsOffset);
+      }
+      PdxFieldTraits<F>::write(m_output, value);
+      return *this;
+    }
+
+   private:
+    DataOutput& m_output;
+    int32_t m_fieldsOffset;
+    std::vector<int32_t>& m_offsets;
+  };
+
+  class StreamReaderFields {
+   public:
+    explicit StreamReaderFields(DataInput& input) : m_input(input) {}
+
+    template <typename F>
+    StreamReaderFields& operator()(const char*, F& value) {
+      PdxFieldTraits<F>::read(m_input, value);
+      return *this;
+    }
+
+   private:
+    DataInput& m_input;
+  };
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXAUTOSERIALIZABLE_H_
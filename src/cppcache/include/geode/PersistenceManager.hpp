@@ -33,6 +33,12 @@
 #define MAX_PAGE_COUNT "MaxPageCount"
 #define PAGE_SIZE "PageSize"
 #define PERSISTENCE_DIR "PersistenceDirectory"
+#define JOURNAL_MODE "JournalMode"
+#define MAX_BATCH_SIZE "MaxBatchSize"
+#define FLUSH_INTERVAL "FlushInterval"
+#define SEGMENT_SIZE "SegmentSize"
+#define COMPACTION_THRESHOLD "CompactionThreshold"
+#define COMPACTION_INTERVAL "CompactionInterval"
 
 namespace apache {
 namespace geode {
@@ -66,7 +72,9 @@ class CPPCACHE_EXPORT PersistenceManager {
   * in this method by the class implementing this method.
   * @param key the key to write.
   * @param value the value to write
-  * @param PersistenceInfo related persistence information.
+  * @param PersistenceInfo related persistence information. The
+  * implementation may set it to a handle of its own, which is kept with the
+  * entry and passed to later calls for the same entry.
   * @throws RegionDestroyedException is the region is already destroyed.
   * @throws OutofMemoryException if the disk is full
   * @throws DiskFailureException if the write fails due to disk fail.
@@ -109,7 +117,8 @@ class CPPCACHE_EXPORT PersistenceManager {
   /**
   * destroys the entry specified by the key in the argument.
   * @param key is the key of the entry which is being destroyed.
-  * @param PersistenceInfo related persistence information.
+  * @param PersistenceInfo related persistence information; the
+  * implementation may reset it once the handle is released.
   * @throws RegionDestroyedException is the region is already destroyed.
   * @throws EntryNotFoundException if the entry is not found on the disk.
   */
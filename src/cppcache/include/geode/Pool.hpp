@@ -161,6 +161,27 @@ class CPPCACHE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   bool getPRSingleHopEnabled() const;
 
+  /**
+   * Returns true if simple operations share a multiplexed connection per
+   * server.
+   * @see PoolFactory#setMultiplexedConnections
+   */
+  bool getMultiplexedConnections() const;
+
+  /**
+   * Returns true if PDX values received from the servers are kept serialized
+   * until first access.
+   * @see PoolFactory#setLazyDeserialization
+   */
+  bool getLazyDeserialization() const;
+
+  /**
+   * Returns the maximum number of keys sent to a server in one getAll
+   * request.
+   * @see PoolFactory#setGetAllBatchSize
+   */
+  int getGetAllBatchSize() const;
+
   /**
    * If this pool was configured to use <code>threadlocalconnections</code>,
    * then this method will release the connection cached for the calling thread.
@@ -199,6 +199,27 @@ class CPPCACHE_EXPORT PoolFactory  {
    */
   static const bool DEFAULT_PR_SINGLE_HOP_ENABLED = true;
 
+  /**
+   * The default value for whether simple operations are pipelined over a
+   * shared connection per server.
+   * <p>Current value: <code>false</code>.
+   */
+  static const bool DEFAULT_MULTIPLEXED_CONNECTIONS = false;
+
+  /**
+   * The default value for whether PDX values received from the servers are
+   * kept serialized until first access.
+   * <p>Current value: <code>false</code>.
+   */
+  static const bool DEFAULT_LAZY_DESERIALIZATION = false;
+
+  /**
+   * The default maximum number of keys sent to a server in one getAll
+   * request.
+   * <p>Current value: <code>1000</code>.
+   */
+  static const int DEFAULT_GETALL_BATCH_SIZE = 1000;
+
   /**
    * Sets the free connection timeout for this pool.
    * If the pool has a max connections setting, operations will block
@@ -517,6 +538,43 @@ class CPPCACHE_EXPORT PoolFactory  {
    */
   void setPRSingleHopEnabled(bool enabled);
 
+  /**
+   * By default setMultiplexedConnections is false<br>
+   * If true, get, put, destroy, invalidate, containsKeyOnServer and size
+   * requests are written back-to-back on a single connection per server that
+   * is shared by all application threads, instead of each operation checking
+   * out a pool connection of its own. Replies are matched to requests in the
+   * order the server sends them, so threads no longer wait for a free
+   * connection under heavy concurrency. All other operations, transactions
+   * and pools with security or SSL enabled keep using the regular pool
+   * connections.
+   * @param enabled whether simple operations share a multiplexed connection.
+   */
+  void setMultiplexedConnections(bool enabled);
+
+  /**
+   * By default setLazyDeserialization is false<br>
+   * If true, PDX values in the replies to get, getAll and query requests are
+   * not deserialized when the reply is read. Their bytes are copied into a
+   * <code>CachedDeserializable</code> that is returned to the application and
+   * stored in caching regions instead, and are deserialized the first time
+   * <code>CachedDeserializable::getDeserializedValue</code> is called. Values
+   * that are only forwarded, for example put into another region, are
+   * written back as the received bytes and never deserialized.
+   * @param enabled whether PDX values are kept serialized until first access.
+   */
+  void setLazyDeserialization(bool enabled);
+
+  /**
+   * Sets the maximum number of keys sent to a server in one getAll request.
+   * Larger getAlls are split into batches of this many keys, which are sent
+   * concurrently, several to the same server, so that the results of the
+   * first batches are processed while later ones are still in flight. A
+   * value of <code>0</code> sends the keys for a server in one request.
+   * @param batchSize the maximum number of keys in a getAll request
+   */
+  void setGetAllBatchSize(int batchSize);
+
   ~PoolFactory();
 
  private:
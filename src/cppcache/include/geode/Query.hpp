@@ -24,6 +24,7 @@
 #include "geode_types.hpp"
 
 #include "SelectResults.hpp"
+#include "ColumnarStructSet.hpp"
 
 /**
  * @file
@@ -92,6 +93,36 @@ class CPPCACHE_EXPORT Query {
   virtual SelectResultsPtr execute(
       CacheableVectorPtr paramList,
       uint32_t timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the OQL Query on the cache server and returns the results
+   * column by column. The values are decoded into the columns while the
+   * reply is read, without creating a Struct per row or, for integral,
+   * floating point and string fields, an object per value.
+   * @param timeout The time (in seconds) to wait for query response, optional.
+   *        This should be less than or equal to 2^31/1000 i.e. 2147483.
+   * @throws IllegalArgumentException if timeout parameter is greater than
+   * 2^31/1000.
+   * @throws QueryException if some query error occurred at the server.
+   * @throws IllegalStateException if some error occurred.
+   * @throws NotConnectedException if no java cache server is available.
+   * @returns A smart pointer to the ColumnarStructSet.
+   */
+  virtual ColumnarStructSetPtr executeColumnar(
+      uint32_t timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the parameterized OQL Query on the cache server and returns the
+   * results column by column.
+   * @param paramList The query parameters list
+   * @param timeout The time (in seconds) to wait for query response, optional.
+   *        This should be less than or equal to 2^31/1000 i.e. 2147483.
+   * @see executeColumnar(uint32_t)
+   * @returns A smart pointer to the ColumnarStructSet.
+   */
+  virtual ColumnarStructSetPtr executeColumnar(
+      CacheableVectorPtr paramList,
+      uint32_t timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
   /**
    * Get the query string provided when a new Query was created from a
    * QueryService.
@@ -46,6 +46,8 @@
 #include "AttributesFactory.hpp"
 #include "CacheableKey.hpp"
 #include "Query.hpp"
+#include "GetAllListener.hpp"
+#include <future>
 #define DEFAULT_RESPONSE_TIMEOUT 15
 
 namespace apache {
@@ -316,6 +318,35 @@ class CPPCACHE_EXPORT Region : public std::enable_shared_from_this<Region> {
     return get(createKey(key), callbackArg);
   }
 
+  /**
+  * Asynchronous version of {@link get}. Returns immediately with a future
+  * that is completed with the value, or with one of the exceptions listed
+  * for {@link get}, once the server replies.
+  *
+  * For pools with multiplexed connections enabled the request is written on
+  * the shared connection and the future is completed by the thread that
+  * reads the replies, so no application thread is held while the operation
+  * is in flight. Any <code>CacheListener</code> is invoked on that thread as
+  * well. Values found in the local cache, operations in a transaction,
+  * regions with a <code>CacheLoader</code> and pools that cannot multiplex
+  * the request are served synchronously and return a future that is already
+  * complete.
+  *
+  * @param key whose associated value is to be returned.
+  * @param aCallbackArgument an argument passed into the CacheListener.
+  * @see PoolFactory::setMultiplexedConnections
+  **/
+  virtual std::future<CacheablePtr> getAsync(
+      const CacheableKeyPtr& key,
+      const UserDataPtr& aCallbackArgument = nullptr) = 0;
+
+  /** Convenience method allowing key to be a const char* */
+  template <class KEYTYPE>
+  inline std::future<CacheablePtr> getAsync(
+      const KEYTYPE& key, const UserDataPtr& callbackArg = nullptr) {
+    return getAsync(createKey(key), callbackArg);
+  }
+
   /** Places a new value into an entry in this region with the specified key,
   * providing a user-defined parameter
   * object to any <code>CacheWriter</code> invoked in the process.
@@ -383,6 +414,34 @@ class CPPCACHE_EXPORT Region : public std::enable_shared_from_this<Region> {
     put(key, createValue(value), arg);
   }
 
+  /**
+  * Asynchronous version of {@link put}. Returns immediately with a future
+  * that is completed once the server has applied the update and the local
+  * cache has been updated, or with one of the exceptions listed for
+  * {@link put}.
+  *
+  * The same threading rules as {@link getAsync} apply. Regions with a
+  * <code>CacheWriter</code> and operations in a transaction are served
+  * synchronously. Delta propagation is not used; the full value is sent.
+  *
+  * @param key a key smart pointer associated with the value to be put into
+  * this region.
+  * @param value the value to be put into the cache
+  * @param aCallbackArgument an argument that is passed to the callback
+  * function
+  */
+  virtual std::future<void> putAsync(
+      const CacheableKeyPtr& key, const CacheablePtr& value,
+      const UserDataPtr& aCallbackArgument = nullptr) = 0;
+
+  /** Convenience method allowing both key and value to be a const char* */
+  template <class KEYTYPE, class VALUETYPE>
+  inline std::future<void> putAsync(const KEYTYPE& key,
+                                    const VALUETYPE& value,
+                                    const UserDataPtr& arg = nullptr) {
+    return putAsync(createKey(key), createValue(value), arg);
+  }
+
   /**
    * Places a set of new values in this region with the specified keys
    * given as a map of key/value pairs.
@@ -1312,6 +1371,54 @@ class CPPCACHE_EXPORT Region : public std::enable_shared_from_this<Region> {
                       bool addToLocalCache = false,
                       const UserDataPtr& aCallbackArgument = nullptr) = 0;
 
+  /**
+  * Streaming version of {@link getAll}. Instead of collecting the values in
+  * a map, hands them to the listener batch by batch as the replies of the
+  * servers arrive, so that the first values can be processed while the rest
+  * are still being read. Values found in the local cache are delivered
+  * first. Returns once every value has been delivered.
+  *
+  * @param keys the array of keys
+  * @param listener receives the values and the exceptions of each batch;
+  *   see {@link GetAllListener} for how it is invoked
+  * @param addToLocalCache true if the obtained values have also to be added
+  *   to the local cache
+  * @param aCallbackArgument an argument that is passed to the callback
+  *   functions. It may be nullptr.
+  * @throws IllegalArgumentException If the array of keys is empty or the
+  *   listener is nullptr.
+  * @throws CacheServerException If an exception is received from the Java
+  *   cache server while processing the request.
+  * @throws NotConnectedException if it is not connected to the cache because
+  *   the client cannot establish usable connections to any of the given servers
+  * @throws RegionDestroyedException If region destroy is pending.
+  * @throws TimeoutException if operation timed out.
+  *
+  * @see PoolFactory::setGetAllBatchSize
+  */
+  virtual void getAll(const VectorOfCacheableKey& keys,
+                      const GetAllListenerPtr& listener,
+                      bool addToLocalCache = false,
+                      const UserDataPtr& aCallbackArgument = nullptr) = 0;
+
+  /**
+  * Asynchronous version of {@link getAll}. The keys missing from the local
+  * cache are sent to the servers in GET_ALL requests, split per server and
+  * by the pool's getAll batch size as for {@link getAll}, and the returned
+  * future is completed with the map of keys to values once every reply has
+  * arrived. If any request fails, the future is completed with the first
+  * exception encountered. Values are added to the local cache when caching
+  * is enabled.
+  *
+  * @param keys the keys for which values are required.
+  * @param aCallbackArgument an argument passed into the CacheListener.
+  * @throws IllegalArgumentException If the array of keys is empty.
+  * @see PoolFactory::setGetAllBatchSize
+  */
+  virtual std::future<HashMapOfCacheablePtr> getAllAsync(
+      const VectorOfCacheableKey& keys,
+      const UserDataPtr& aCallbackArgument = nullptr) = 0;
+
   /**
   * Executes the query on the server based on the predicate.
   * Valid only for a Native Client region.
@@ -306,6 +306,13 @@ class CPPCACHE_EXPORT RegionAttributes : public Serializable {
   const char* getPoolName() { return m_poolName; }
   bool getCloningEnabled() { return m_isClonable; }
 
+  /**
+   * Returns true if the region keeps its values serialized in slab arenas
+   * and deserializes them on each read.
+   * @see AttributesFactory#setArenaStorageEnabled
+   */
+  bool getArenaStorageEnabled() { return m_isArenaStorageEnabled; }
+
   /**
    * Returns true if concurrent update checks are turned on for this region.
    * <p>
@@ -332,6 +339,7 @@ class CPPCACHE_EXPORT RegionAttributes : public Serializable {
   void setEndpoints(const char* endpoints);
   void setPoolName(const char* poolName);
   void setCloningEnabled(bool isClonable);
+  void setArenaStorageEnabled(bool enable);
   void setCachingEnabled(bool enable);
   void setLruEntriesLimit(int limit);
   void setDiskPolicy(DiskPolicyType::PolicyType diskPolicy);
@@ -385,6 +393,7 @@ class CPPCACHE_EXPORT RegionAttributes : public Serializable {
   PersistenceManagerPtr m_persistenceManager;
   char* m_poolName;
   bool m_isClonable;
+  bool m_isArenaStorageEnabled;
   bool m_isConcurrencyChecksEnabled;
   friend class AttributesFactory;
   friend class AttributesMutator;
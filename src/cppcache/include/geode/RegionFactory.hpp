@@ -236,6 +236,14 @@ class CPPCACHE_EXPORT RegionFactory
    */
   RegionFactoryPtr setCloningEnabled(bool isClonable);
 
+  /**
+   * Keep the values of the region serialized in slab arenas.
+   * @param enable whether to store the values in arenas
+   * @return a reference to <code>this</code>
+   * @see AttributesFactory#setArenaStorageEnabled
+   */
+  RegionFactoryPtr setArenaStorageEnabled(bool enable);
+
   /**
   * Enables or disables concurrent modification checks
   * @since 7.0
@@ -154,6 +154,22 @@ class CPPCACHE_EXPORT SystemProperties {
    * it has exceeded the HeapLRULimit. Defaults to 10%
    */
   const int32_t heapLRUDelta() const { return m_heapLRUDelta; }
+
+  /**
+   * Returns how heap LRU measures the memory held by the cache:
+   * "object-size" adds up the objectSize of keys and values, "allocator"
+   * samples the bytes in use by the memory allocator where the platform
+   * supports it. Defaults to "object-size".
+   */
+  const char* heapLRUAccounting() const { return m_heapLRUAccounting; }
+
+  /**
+   * Returns true if LRU regions only keep a new entry in place of the least
+   * recently used one when its key has been accessed more often (TinyLFU
+   * admission). Defaults to false.
+   */
+  const bool lruAdmissionFilter() const { return m_lruAdmissionFilter; }
+
   /**
    * Returns  the maximum socket buffer size to use
    */
@@ -181,6 +197,14 @@ class CPPCACHE_EXPORT SystemProperties {
    */
   const int32_t notifyDupCheckLife() const { return m_notifyDupCheckLife; }
 
+  /**
+   * Returns the number of threads that process subscription events. With
+   * the default of 0 events are processed by the thread receiving them.
+   */
+  const int32_t notifyDispatchThreads() const {
+    return m_notifyDispatchThreads;
+  }
+
   /**
    * Returns the durable client ID
    */
@@ -268,6 +292,16 @@ class CPPCACHE_EXPORT SystemProperties {
    */
   bool disableChunkHandlerThread() const { return m_disableChunkHandlerThread; }
 
+  /**
+   * Returns the number of threads that process the chunks of responses for
+   * a pool or region. The chunks of one response are always processed in
+   * order by a single thread, so more threads only help when responses
+   * arrive from several servers, or for several requests, at once.
+   */
+  const int32_t chunkProcessorThreads() const {
+    return m_chunkProcessorThreads;
+  }
+
   /**
    * This can be call to know whether read timeout unit is in milli second
    */
@@ -439,12 +473,15 @@ class CPPCACHE_EXPORT SystemProperties {
 
   int32_t m_heapLRULimit;
   int32_t m_heapLRUDelta;
+  char* m_heapLRUAccounting;
+  bool m_lruAdmissionFilter;
   int32_t m_maxSocketBufferSize;
   int32_t m_pingInterval;
   int32_t m_redundancyMonitorInterval;
 
   int32_t m_notifyAckInterval;
   int32_t m_notifyDupCheckLife;
+  int32_t m_notifyDispatchThreads;
 
   PropertiesPtr m_securityPropertiesPtr;
   CacheableStringPtr m_AuthIniLoaderLibrary;
@@ -477,6 +514,7 @@ class CPPCACHE_EXPORT SystemProperties {
   uint32_t m_suspendedTxTimeout;
   uint32_t m_tombstoneTimeoutInMSec;
   bool m_disableChunkHandlerThread;
+  int32_t m_chunkProcessorThreads;
   bool m_readTimeoutUnitInMillis;
   bool m_onClientDisconnectClearPdxTypeIds;
 
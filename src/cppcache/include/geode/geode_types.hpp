@@ -56,6 +56,8 @@ _GF_PTR_DEF_(Properties, PropertiesPtr);
 _GF_PTR_DEF_(FunctionService, FunctionServicePtr);
 _GF_PTR_DEF_(CacheLoader, CacheLoaderPtr);
 _GF_PTR_DEF_(CacheListener, CacheListenerPtr);
+_GF_PTR_DEF_(BatchCacheListener, BatchCacheListenerPtr);
+_GF_PTR_DEF_(GetAllListener, GetAllListenerPtr);
 _GF_PTR_DEF_(CacheWriter, CacheWriterPtr);
 _GF_PTR_DEF_(MembershipListener, MembershipListenerPtr);
 _GF_PTR_DEF_(RegionAttributes, RegionAttributesPtr);
@@ -65,12 +67,14 @@ _GF_PTR_DEF_(CacheableKey, CacheableKeyPtr);
 _GF_PTR_DEF_(CacheableObjectArray, CacheableObjectArrayPtr);
 _GF_PTR_DEF_(CacheableString, CacheableStringPtr);
 _GF_PTR_DEF_(CacheableUndefined, CacheableUndefinedPtr);
+_GF_PTR_DEF_(CachedDeserializable, CachedDeserializablePtr);
 _GF_PTR_DEF_(Serializable, SerializablePtr);
 _GF_PTR_DEF_(PdxSerializable, PdxSerializablePtr);
 _GF_PTR_DEF_(StackTrace, StackTracePtr);
 _GF_PTR_DEF_(SelectResults, SelectResultsPtr);
 _GF_PTR_DEF_(CqResults, CqResultsPtr);
 _GF_PTR_DEF_(ResultSet, ResultSetPtr);
+_GF_PTR_DEF_(ColumnarStructSet, ColumnarStructSetPtr);
 _GF_PTR_DEF_(StructSet, StructSetPtr);
 _GF_PTR_DEF_(Struct, StructPtr);
 _GF_PTR_DEF_(Query, QueryPtr);
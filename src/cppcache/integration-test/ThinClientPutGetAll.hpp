@@ -24,6 +24,7 @@
 #include <geode/GeodeCppCache.hpp>
 #include <ace/OS.h>
 #include <ace/High_Res_Timer.h>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -104,6 +105,50 @@ void verifyGetAllWithCallBackArg(RegionPtr region, bool addToLocalCache,
   verifyGetAll(region, addToLocalCache, vals, startIndex, callBack);
 }
 
+// collects what a streaming getAll hands over, call by call
+class CollectingGetAllListener : public GetAllListener {
+ public:
+  CollectingGetAllListener() : m_calls(0) {}
+
+  virtual void onValues(const HashMapOfCacheable& values) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_values.insert(values.begin(), values.end());
+    m_calls++;
+  }
+
+  HashMapOfCacheable m_values;
+  int m_calls;
+
+ private:
+  std::mutex m_mutex;
+};
+
+void verifyGetAllWithListener(RegionPtr region, const char** vals,
+                              int startIndex) {
+  VectorOfCacheableKey keys;
+  keys.push_back(CacheableKey::create(_keys[0]));
+  keys.push_back(CacheableKey::create(_keys[1]));
+  keys.push_back(CacheableKey::create("keyNotThere"));
+
+  // the first key is served from the local cache and the others by the
+  // server, so the values come in more than one call
+  region->localInvalidate(keys[1]);
+  auto listener = std::make_shared<CollectingGetAllListener>();
+  region->getAll(keys, listener);
+  ASSERT(listener->m_calls >= 2, "cached and server values not delivered");
+  for (int i = 0; i < 2; i++) {
+    const auto& iter = listener->m_values.find(keys[i]);
+    ASSERT(iter != listener->m_values.end(), "value not delivered");
+    ASSERT(iter->second != nullptr, "value is null");
+    ASSERT(strcmp(iter->second->toString()->asChar(),
+                  vals[startIndex + i]) == 0,
+           "value not matched");
+  }
+  const auto& missing = listener->m_values.find(keys[2]);
+  ASSERT(missing == listener->m_values.end() || missing->second == nullptr,
+         "keyNotThere value is not null");
+}
+
 void createPooledRegion(const char* name, bool ackMode, const char* locators,
                         const char* poolname,
                         bool clientNotificationEnabled = false,
@@ -233,6 +278,14 @@ DUNIT_TASK_DEFINITION(CLIENT2, GetAllAfterLocalDestroyRegionOnClientTwo_Pool)
   }
 END_TASK_DEFINITION
 
+DUNIT_TASK_DEFINITION(CLIENT2, GetAllWithListenerFromClientTwo)
+  {
+    RegionPtr region = getHelper()->getRegion(_regionNames[0]);
+    verifyGetAllWithListener(region, _nvals, 0);
+    LOG("GetAllWithListenerFromClientTwo complete.");
+  }
+END_TASK_DEFINITION
+
 DUNIT_TASK_DEFINITION(CLIENT1, putallAndGetallPdxWithCallBackArg)
   {
     LOG("putallAndGetallPdxWithCallBackArg started.");
@@ -614,6 +667,7 @@ void runPutGetAll() {
   CALL_TASK(GetAllUpdatedValuesFromClientTwo);
 
   CALL_TASK(GetAllAfterLocalDestroyRegionOnClientTwo_Pool);
+  CALL_TASK(GetAllWithListenerFromClientTwo);
   CALL_TASK(putallAndGetallPdx);
 
   // TODO: Does this task add value? Is it same code path as
@@ -95,7 +95,8 @@ class FakeRegion : public RegionInternal {
   virtual GfErrType getAllNoThrow(
       const VectorOfCacheableKey& keys, const HashMapOfCacheablePtr& values,
       const HashMapOfExceptionPtr& exceptions, bool addToLocalCache,
-      const UserDataPtr& aCallbackArgument) override {
+      const UserDataPtr& aCallbackArgument,
+      const GetAllListenerPtr& listener = nullptr) override {
     return GF_NOERR;
   }
   virtual GfErrType putNoThrow(const CacheableKeyPtr& key,
@@ -182,6 +183,7 @@ class FakeRegion : public RegionInternal {
   virtual bool cacheEnabled() override { return 0; }
   virtual bool isDestroyed() const override { return 0; }
   virtual void evict(int32_t percentage) override {}
+  virtual int64_t getHeapLRUSize() override { return 0; }
   virtual CacheImpl* getCacheImpl() const override { return nullptr; }
   virtual TombstoneListPtr getTombstoneList() override { return nullptr; }
 
@@ -228,10 +230,27 @@ class FakeRegion : public RegionInternal {
   virtual void put(const CacheableKeyPtr& key, const CacheablePtr& value,
                    const UserDataPtr& aCallbackArgument = nullptr) override {}
 
+  virtual std::future<CacheablePtr> getAsync(
+      const CacheableKeyPtr& key,
+      const UserDataPtr& aCallbackArgument = nullptr) override {
+    return std::future<CacheablePtr>();
+  }
+
+  virtual std::future<void> putAsync(
+      const CacheableKeyPtr& key, const CacheablePtr& value,
+      const UserDataPtr& aCallbackArgument = nullptr) override {
+    return std::future<void>();
+  }
+
   virtual void putAll(const HashMapOfCacheable& map,
                       uint32_t timeout = DEFAULT_RESPONSE_TIMEOUT,
                       const UserDataPtr& aCallbackArgument = nullptr) override {
   }
+  virtual void getAll(const VectorOfCacheableKey& keys,
+                      const GetAllListenerPtr& listener,
+                      bool addToLocalCache = false,
+                      const UserDataPtr& aCallbackArgument = nullptr) override {
+  }
   virtual void localPut(
       const CacheableKeyPtr& key, const CacheablePtr& value,
       const UserDataPtr& aCallbackArgument = nullptr) override {}
@@ -286,6 +305,17 @@ class FakeRegion : public RegionInternal {
                       bool addToLocalCache = false,
                       const UserDataPtr& aCallbackArgument = nullptr) override {
   }
+  virtual void getAll(const VectorOfCacheableKey& keys,
+                      const GetAllListenerPtr& listener,
+                      bool addToLocalCache = false,
+                      const UserDataPtr& aCallbackArgument = nullptr) override {
+  }
+
+  virtual std::future<HashMapOfCacheablePtr> getAllAsync(
+      const VectorOfCacheableKey& keys,
+      const UserDataPtr& aCallbackArgument = nullptr) override {
+    return std::future<HashMapOfCacheablePtr>();
+  }
   virtual void removeAll(
       const VectorOfCacheableKey& keys,
       const UserDataPtr& aCallbackArgument = nullptr) override {}
@@ -305,6 +335,11 @@ class FakeRegion : public RegionInternal {
   virtual void create(const CacheableKeyPtr& key, const CacheablePtr& value,
                       const UserDataPtr& aCallbackArgument = nullptr) override {
   }
+  virtual void getAll(const VectorOfCacheableKey& keys,
+                      const GetAllListenerPtr& listener,
+                      bool addToLocalCache = false,
+                      const UserDataPtr& aCallbackArgument = nullptr) override {
+  }
   virtual RegionServicePtr getRegionService() const override { return nullptr; }
   virtual bool containsValueForKey(
       const CacheableKeyPtr& keyPtr) const override {
@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fw_dunit.hpp"
+#include <geode/GeodeCppCache.hpp>
+
+#include <PdxHelper.hpp>
+#include <PdxTypeRegistry.hpp>
+#include <PdxWriterWithTypeCollector.hpp>
+
+#include <vector>
+
+#define ROOT_NAME "testPdxSerializePerf"
+
+// Prints the time per object serialized by PdxHelper::serializePdx. There
+// are no recorded results to compare against; run it before and after a
+// change to the serialization path to see its effect.
+
+using namespace apache::geode::client;
+
+perf::PerfSuite perfSuite("PdxSerializePerf");
+
+// objects serialized into one DataOutput, as for a putAll of that size
+static const int BATCH_SIZE = 10000;
+
+static const int BATCHES = 20;
+
+class PerfPdx : public PdxSerializable {
+ public:
+  explicit PerfPdx(int32_t id = 0) : m_id(id), m_price(id * 1.5) {
+    sprintf(m_name, "name-%d", id);
+  }
+
+  virtual void toData(PdxWriterPtr pw) {
+    pw->writeInt("id", m_id);
+    pw->writeString("name", m_name);
+    pw->writeDouble("price", m_price);
+  }
+
+  virtual void fromData(PdxReaderPtr pr) {
+    m_id = pr->readInt("id");
+    m_price = pr->readDouble("price");
+  }
+
+  virtual const char* getClassName() const { return "PerfPdx"; }
+
+  static PdxSerializable* createDeserializable() { return new PerfPdx(); }
+
+ private:
+  int32_t m_id;
+  char m_name[32];
+  double m_price;
+};
+
+CachePtr cachePtr;
+
+// registers the local type the way the first serialization would, without
+// asking a server for the type id
+void registerLocalType() {
+  DataOutput output;
+  auto collector =
+      std::make_shared<PdxWriterWithTypeCollector>(output, "PerfPdx");
+  PerfPdx obj;
+  obj.toData(collector);
+  PdxTypePtr type = collector->getPdxLocalType();
+  type->InitializeType();
+  type->setTypeId(1);
+  PdxTypeRegistry::addLocalPdxType("PerfPdx", type);
+  PdxTypeRegistry::addPdxType(1, type);
+}
+
+class SerializeTask : public perf::Thread {
+ private:
+  std::vector<PdxSerializablePtr> m_objects;
+
+ public:
+  SerializeTask() : Thread() {}
+
+  virtual void setup() {
+    for (int i = 0; i < BATCH_SIZE; i++) {
+      m_objects.push_back(std::make_shared<PerfPdx>(i));
+    }
+  }
+
+  virtual void perftask() {
+    for (int b = 0; b < BATCHES; b++) {
+      DataOutput output;
+      for (const auto& object : m_objects) {
+        PdxHelper::serializePdx(output, object);
+      }
+    }
+  }
+
+  virtual void cleanup() { m_objects.clear(); }
+};
+
+void runSerialize(const char* name, int threads) {
+  SerializeTask taskDef;
+  perf::ThreadLauncher tl(threads, taskDef);
+  tl.go();
+
+  long ops = static_cast<long>(BATCHES) * BATCH_SIZE * threads;
+  perfSuite.addRecord(name, ops, tl.startTime(), tl.stopTime());
+  int64_t elapsed = tl.stopTime().msec() - tl.startTime().msec();
+  fprintf(stdout, "[PdxSerializePerf] %s: %.3f usec per object\n", name,
+          (elapsed * 1000.0 * threads) / ops);
+  fflush(stdout);
+}
+
+DUNIT_TASK(s1p1, Init)
+  {
+    cachePtr = CacheFactory::createCacheFactory()->create();
+    Serializable::registerPdxType(PerfPdx::createDeserializable);
+    registerLocalType();
+  }
+END_TASK(Init)
+
+DUNIT_TASK(s1p1, SerializeOneThread)
+  { runSerialize(fwtest_Name, 1); }
+END_TASK(SerializeOneThread)
+
+DUNIT_TASK(s1p1, SerializeFourThreads)
+  { runSerialize(fwtest_Name, 4); }
+END_TASK(SerializeFourThreads)
+
+DUNIT_TASK(s1p1, Finish)
+  {
+    perfSuite.save();
+    cachePtr->close();
+    cachePtr = nullptr;
+  }
+END_TASK(Finish)
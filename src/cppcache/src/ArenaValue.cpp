@@ -0,0 +1,103 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ArenaValue.hpp"
+#include "CacheableToken.hpp"
+
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Log.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+CacheablePtr ArenaValue::pack(const ValueArenaPtr& arena,
+                              const CacheablePtr& value) {
+  if (value == nullptr || CacheableToken::isToken(value) || isPacked(value)) {
+    return value;
+  }
+  try {
+    DataOutput output;
+    output.setPoolName(arena->poolName());
+    output.writeObject(value);
+    uint32_t length = 0;
+    const uint8_t* bytes = output.getBuffer(&length);
+    uint32_t handle = arena->store(bytes, length);
+    if (handle == ValueArena::NO_HANDLE) {
+      return value;
+    }
+    return std::make_shared<ArenaValue>(arena, handle, length);
+  } catch (const Exception& ex) {
+    LOGFINE("Keeping value of class %d off the arena: %s: %s",
+            value->classId(), ex.getName(), ex.getMessage());
+    return value;
+  }
+}
+
+bool ArenaValue::take(uint16_t& arenaId, uint32_t& handle,
+                      uint16_t& length) {
+  if (m_handle == ValueArena::NO_HANDLE) {
+    return false;
+  }
+  arenaId = m_arena->id();
+  handle = m_handle;
+  length = static_cast<uint16_t>(m_length);
+  m_handle = ValueArena::NO_HANDLE;
+  return true;
+}
+
+CacheablePtr ArenaValue::unpack(uint16_t arenaId, uint32_t handle,
+                                uint16_t length) {
+  const ValueArena* arena = ValueArena::find(arenaId);
+  // the bytes stay in place until unpin, even if the arena is compacted
+  DataInput input(arena->pin(handle), length);
+  input.setPoolName(arena->poolName());
+  CacheablePtr value;
+  try {
+    input.readObject(value);
+  } catch (...) {
+    arena->unpin();
+    throw;
+  }
+  arena->unpin();
+  return value;
+}
+
+ArenaValue::ArenaValue(const ValueArenaPtr& arena, uint32_t handle,
+                       uint32_t length)
+    : m_arena(arena), m_handle(handle), m_length(length) {}
+
+ArenaValue::~ArenaValue() {
+  if (m_handle != ValueArena::NO_HANDLE) {
+    m_arena->release(m_handle);
+  }
+}
+
+void ArenaValue::toData(DataOutput& output) const {
+  throw UnsupportedOperationException(
+      "ArenaValue::toData: unpack the value to serialize it");
+}
+
+Serializable* ArenaValue::fromData(DataInput& input) {
+  throw UnsupportedOperationException(
+      "ArenaValue::fromData: values are packed from their objects");
+}
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
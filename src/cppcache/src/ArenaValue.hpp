@@ -0,0 +1,101 @@
+#pragma once
+
+#ifndef GEODE_ARENAVALUE_H_
+#define GEODE_ARENAVALUE_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/geode_globals.hpp>
+#include <geode/Cacheable.hpp>
+
+#include <typeinfo>
+
+#include "ValueArena.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * A value of a region with arena storage, serialized into the region's
+ * ValueArena. It only carries the value from pack() to
+ * MapEntryImpl::setValueI, which takes the arena id, handle and length over
+ * into the entry itself and lets the ArenaValue go. MapEntryImpl::getValueI
+ * hands out the deserialized value instead, so every read deserializes a
+ * fresh copy, and the bytes are freed when the entry lets go of them.
+ */
+class CPPCACHE_EXPORT ArenaValue : public Cacheable {
+ public:
+  /**
+   * Returns the value serialized into the arena, or the value itself if it
+   * is a token, does not fit or cannot be serialized here.
+   */
+  static CacheablePtr pack(const ValueArenaPtr& arena,
+                           const CacheablePtr& value);
+
+  inline static bool isPacked(const CacheablePtr& value) {
+    return value != nullptr && typeid(*value) == typeid(ArenaValue);
+  }
+
+  /**
+   * Moves the value out to a map entry, which then has to release() it.
+   * Returns false if the value has already been taken.
+   */
+  bool take(uint16_t& arenaId, uint32_t& handle, uint16_t& length);
+
+  /** Deserializes the value with the handle in the arena with the id. */
+  static CacheablePtr unpack(uint16_t arenaId, uint32_t handle,
+                             uint16_t length);
+
+  /** Frees a value taken by a map entry. */
+  inline static void release(uint16_t arenaId, uint32_t handle) {
+    ValueArena::find(arenaId)->release(handle);
+  }
+
+  ArenaValue(const ValueArenaPtr& arena, uint32_t handle, uint32_t length);
+
+  virtual ~ArenaValue();
+
+  /** Not supported, the value is never serialized in this form. */
+  virtual void toData(DataOutput& output) const;
+
+  /** Not supported, the value is never serialized in this form. */
+  virtual Serializable* fromData(DataInput& input);
+
+  virtual int32_t classId() const { return 0; }
+
+  virtual int8_t typeId() const { return 0; }
+
+  virtual uint32_t objectSize() const {
+    return static_cast<uint32_t>(sizeof(ArenaValue)) + m_length;
+  }
+
+ private:
+  ValueArenaPtr m_arena;
+  uint32_t m_handle;
+  uint32_t m_length;
+
+  // never implemented.
+  ArenaValue(const ArenaValue& other);
+  void operator=(const ArenaValue& other);
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_ARENAVALUE_H_
@@ -208,6 +208,11 @@ void AttributesFactory::setPoolName(const char* name) {
 void AttributesFactory::setCloningEnabled(bool isClonable) {
   m_regionAttributes.setCloningEnabled(isClonable);
 }
+
+void AttributesFactory::setArenaStorageEnabled(bool enable) {
+  m_regionAttributes.setArenaStorageEnabled(enable);
+}
+
 void AttributesFactory::setConcurrencyChecksEnabled(bool enable) {
   m_regionAttributes.setConcurrencyChecksEnabled(enable);
 }
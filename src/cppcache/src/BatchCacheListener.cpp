@@ -0,0 +1,47 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/BatchCacheListener.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+const uint32_t BatchCacheListener::DEFAULT_MAX_BATCH_SIZE;
+const uint32_t BatchCacheListener::DEFAULT_BATCH_TIME_INTERVAL;
+
+BatchCacheListener::Event::Event(Operation operation, const RegionPtr& region,
+                                 const CacheableKeyPtr& key,
+                                 const CacheablePtr& oldValue,
+                                 const CacheablePtr& newValue,
+                                 const UserDataPtr& aCallbackArgument,
+                                 const bool remoteOrigin)
+    : EntryEvent(region, key, oldValue, newValue, aCallbackArgument,
+                 remoteOrigin),
+      m_operation(operation) {}
+
+BatchCacheListener::Event::~Event() {}
+
+BatchCacheListener::BatchCacheListener(uint32_t maxBatchSize,
+                                       uint32_t batchTimeInterval)
+    : m_maxBatchSize(maxBatchSize > 0 ? maxBatchSize : 1),
+      m_batchTimeInterval(batchTimeInterval > 0 ? batchTimeInterval : 1) {}
+
+BatchCacheListener::~BatchCacheListener() {}
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -539,6 +539,21 @@ CacheFactoryPtr CacheFactory::setPRSingleHopEnabled(bool enabled) {
   return shared_from_this();
 }
 
+CacheFactoryPtr CacheFactory::setMultiplexedConnections(bool enabled) {
+  getPoolFactory()->setMultiplexedConnections(enabled);
+  return shared_from_this();
+}
+
+CacheFactoryPtr CacheFactory::setLazyDeserialization(bool enabled) {
+  getPoolFactory()->setLazyDeserialization(enabled);
+  return shared_from_this();
+}
+
+CacheFactoryPtr CacheFactory::setGetAllBatchSize(int batchSize) {
+  getPoolFactory()->setGetAllBatchSize(batchSize);
+  return shared_from_this();
+}
+
 CacheFactoryPtr CacheFactory::setPdxIgnoreUnreadFields(bool ignore) {
   ignorePdxUnreadFields = ignore;
   return shared_from_this();
@@ -85,7 +85,8 @@ CacheImpl::CacheImpl(Cache* c, const char* name, DistributedSystemPtr sys,
   SystemProperties* prop = DistributedSystem::getSystemProperties();
   if (prop && prop->heapLRULimitEnabled()) {
     m_evictionControllerPtr = new EvictionController(
-        prop->heapLRULimit(), prop->heapLRUDelta(), this);
+        prop->heapLRULimit(), prop->heapLRUDelta(), prop->heapLRUAccounting(),
+        this);
     m_evictionControllerPtr->start();
     LOGINFO("Heap LRU eviction controller thread started");
   }
@@ -131,7 +132,8 @@ CacheImpl::CacheImpl(Cache* c, const char* name, DistributedSystemPtr sys,
   SystemProperties* prop = DistributedSystem::getSystemProperties();
   if (prop && prop->heapLRULimitEnabled()) {
     m_evictionControllerPtr = new EvictionController(
-        prop->heapLRULimit(), prop->heapLRUDelta(), this);
+        prop->heapLRULimit(), prop->heapLRUDelta(), prop->heapLRUAccounting(),
+        this);
     m_evictionControllerPtr->start();
     LOGINFO("Heap LRU eviction controller thread started");
   }
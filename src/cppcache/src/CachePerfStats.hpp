@@ -41,7 +41,7 @@ class CPPCACHE_EXPORT CachePerfStats {
 
     if (statsType == nullptr) {
       const bool largerIsBetter = true;
-      StatisticDescriptor** statDescArr = new StatisticDescriptor*[24];
+      StatisticDescriptor** statDescArr = new StatisticDescriptor*[26];
 
       statDescArr[0] = factory->createIntCounter(
           "creates", "The total number of cache creates", "entries",
@@ -135,10 +135,20 @@ class CPPCACHE_EXPORT CachePerfStats {
           "pdxDeserializedBytes",
           "Total number of bytes read by pdx deserialization.", "entries",
           !largerIsBetter);
+      statDescArr[24] = factory->createIntGauge(
+          "notificationDispatchQueueSize",
+          "The current number of subscription events waiting for a dispatcher "
+          "thread",
+          "events", !largerIsBetter);
+      statDescArr[25] = factory->createIntCounter(
+          "notificationsDispatched",
+          "Total number of subscription events processed by dispatcher "
+          "threads",
+          "events", largerIsBetter);
 
       statsType = factory->createType("CachePerfStats",
                                       "Statistics about native client cache",
-                                      statDescArr, 24);
+                                      statDescArr, 26);
     }
     GF_D_ASSERT(statsType != nullptr);
     // Create Statistics object
@@ -173,6 +183,10 @@ class CPPCACHE_EXPORT CachePerfStats {
     m_pdxSerializedBytesId = statsType->nameToId("pdxSerializedBytes");
     m_pdxDeserializationsId = statsType->nameToId("pdxDeserializations");
     m_pdxDeserializedBytesId = statsType->nameToId("pdxDeserializedBytes");
+    m_notificationDispatchQueueSizeId =
+        statsType->nameToId("notificationDispatchQueueSize");
+    m_notificationsDispatchedId =
+        statsType->nameToId("notificationsDispatched");
 
     // Set initial value
     m_cachePerfStats->setInt(m_destroysId, 0);
@@ -199,6 +213,8 @@ class CPPCACHE_EXPORT CachePerfStats {
     m_cachePerfStats->setLong(m_pdxSerializedBytesId, 0);
     m_cachePerfStats->setInt(m_pdxDeserializationsId, 0);
     m_cachePerfStats->setLong(m_pdxDeserializedBytesId, 0);
+    m_cachePerfStats->setInt(m_notificationDispatchQueueSizeId, 0);
+    m_cachePerfStats->setInt(m_notificationsDispatchedId, 0);
   }
 
   virtual ~CachePerfStats() { m_cachePerfStats = nullptr; }
@@ -330,6 +346,14 @@ class CPPCACHE_EXPORT CachePerfStats {
     return m_cachePerfStats->getLong(m_pdxDeserializedBytesId);
   }
 
+  inline void incNotificationDispatchQueueSize(int32_t delta) {
+    m_cachePerfStats->incInt(m_notificationDispatchQueueSizeId, delta);
+  }
+
+  inline void incNotificationsDispatched() {
+    m_cachePerfStats->incInt(m_notificationsDispatchedId, 1);
+  }
+
  private:
   Statistics* m_cachePerfStats;
 
@@ -357,6 +381,8 @@ class CPPCACHE_EXPORT CachePerfStats {
   int32_t m_pdxSerializedBytesId;
   int32_t m_pdxDeserializationsId;
   int32_t m_pdxDeserializedBytesId;
+  int32_t m_notificationDispatchQueueSizeId;
+  int32_t m_notificationsDispatchedId;
 };
 }  // namespace client
 }  // namespace geode
@@ -180,7 +180,11 @@ CacheXml::CacheXml() {
   SUBSCRIPTION_REDUNDANCY = "subscription-redundancy";
   THREAD_LOCAL_CONNECTIONS = "thread-local-connections";
   CLONING_ENABLED = "cloning-enabled";
+  ARENA_STORAGE_ENABLED = "arena-storage-enabled";
   ID = "id";
   REFID = "refid";
   PR_SINGLE_HOP_ENABLED = "pr-single-hop-enabled";
+  MULTIPLEXED_CONNECTIONS = "multiplexed-connections";
+  LAZY_DESERIALIZATION = "lazy-deserialization";
+  GETALL_BATCH_SIZE = "getall-batch-size";
 }
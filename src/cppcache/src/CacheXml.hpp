@@ -199,8 +199,12 @@ class CPPCACHE_EXPORT CacheXml {
   const char* SUBSCRIPTION_REDUNDANCY;
   const char* THREAD_LOCAL_CONNECTIONS;
   const char* CLONING_ENABLED;
+  const char* ARENA_STORAGE_ENABLED;
   const char* MULTIUSER_SECURE_MODE;
   const char* PR_SINGLE_HOP_ENABLED;
+  const char* MULTIPLEXED_CONNECTIONS;
+  const char* LAZY_DESERIALIZATION;
+  const char* GETALL_BATCH_SIZE;
   const char* CONCURRENCY_CHECKS_ENABLED;
   const char* TOMBSTONE_TIMEOUT;
 
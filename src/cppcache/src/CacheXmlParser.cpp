@@ -688,6 +688,20 @@ void CacheXmlParser::setPoolInfo(PoolFactory* factory, const char* name,
     } else {
       factory->setPRSingleHopEnabled(false);
     }
+  } else if (strcmp(name, MULTIPLEXED_CONNECTIONS) == 0) {
+    if (ACE_OS::strcasecmp(value, "true") == 0) {
+      factory->setMultiplexedConnections(true);
+    } else {
+      factory->setMultiplexedConnections(false);
+    }
+  } else if (strcmp(name, LAZY_DESERIALIZATION) == 0) {
+    if (ACE_OS::strcasecmp(value, "true") == 0) {
+      factory->setLazyDeserialization(true);
+    } else {
+      factory->setLazyDeserialization(false);
+    }
+  } else if (strcmp(name, GETALL_BATCH_SIZE) == 0) {
+    factory->setGetAllBatchSize(atoi(value));
   } else {
     std::string s = "XML:Unrecognized pool attribute ";
     s += name;
@@ -967,6 +981,24 @@ void CacheXmlParser::startRegionAttributes(const xmlChar** atts) {
 
         attrsFactory->setCloningEnabled(flag);
         isTCR = true;
+      } else if (strcmp(ARENA_STORAGE_ENABLED, (char*)atts[i]) == 0) {
+        i++;
+        bool flag = false;
+        char* arenaStorageEnabled = (char*)atts[i];
+        if (strcmp("true", arenaStorageEnabled) == 0 ||
+            strcmp("TRUE", arenaStorageEnabled) == 0) {
+          flag = true;
+        } else if (strcmp("false", arenaStorageEnabled) == 0 ||
+                   strcmp("FALSE", arenaStorageEnabled) == 0) {
+          flag = false;
+        } else {
+          std::string temp(arenaStorageEnabled);
+          std::string s = "XML: " + temp +
+                          " is not a valid value for the attribute "
+                          "<arena-storage-enabled>";
+          throw CacheXmlException(s.c_str());
+        }
+        attrsFactory->setArenaStorageEnabled(flag);
       } else if (strcmp(CONCURRENCY_CHECKS_ENABLED, (char*)atts[i]) == 0) {
         bool flag = false;
         i++;
@@ -0,0 +1,83 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/CachedDeserializable.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <GeodeTypeIdsImpl.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+CachedDeserializable::CachedDeserializable(const uint8_t* bytes,
+                                           int32_t length,
+                                           const char* poolName)
+    : m_bytes(bytes, bytes + length),
+      m_poolName(poolName != nullptr ? poolName : "") {}
+
+CachedDeserializablePtr CachedDeserializable::create(const uint8_t* bytes,
+                                                     int32_t length,
+                                                     const char* poolName) {
+  if (bytes == nullptr || length < 1 || bytes[0] != GeodeTypeIdsImpl::PDX) {
+    throw IllegalArgumentException(
+        "CachedDeserializable::create: bytes are not a serialized PDX value");
+  }
+  return std::make_shared<CachedDeserializable>(bytes, length, poolName);
+}
+
+CacheablePtr CachedDeserializable::getDeserializedValue() const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_value == nullptr) {
+    DataInput input(&m_bytes[0], getSerializedLength());
+    if (!m_poolName.empty()) {
+      input.setPoolName(m_poolName.c_str());
+    }
+    input.readObject(m_value);
+  }
+  return m_value;
+}
+
+bool CachedDeserializable::isDeserialized() const {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_value != nullptr;
+}
+
+void CachedDeserializable::toData(DataOutput& output) const {
+  // the type id byte has been written by the caller
+  output.writeBytesOnly(&m_bytes[1],
+                        static_cast<uint32_t>(m_bytes.size() - 1));
+}
+
+Serializable* CachedDeserializable::fromData(DataInput& input) {
+  throw UnsupportedOperationException(
+      "CachedDeserializable::fromData not supported");
+}
+
+int32_t CachedDeserializable::classId() const { return 0; }
+
+int8_t CachedDeserializable::typeId() const {
+  return static_cast<int8_t>(m_bytes[0]);
+}
+
+uint32_t CachedDeserializable::objectSize() const {
+  return static_cast<uint32_t>(sizeof(CachedDeserializable) + m_bytes.size());
+}
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
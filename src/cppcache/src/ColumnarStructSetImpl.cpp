@@ -0,0 +1,442 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "ColumnarStructSetImpl.hpp"
+#include "TcrMessage.hpp"
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/GeodeTypeIds.hpp>
+
+using namespace apache::geode::client;
+
+ColumnarStructSetImpl::Column::Column() : m_type(NULL_COLUMN), m_size(0) {}
+
+CacheablePtr ColumnarStructSetImpl::Column::getObject(int32_t row) const {
+  if (isNull(row)) {
+    return nullptr;
+  }
+  switch (m_type) {
+    case INT64_COLUMN:
+      return createInt(m_int64s[row], m_typeIds[row]);
+    case DOUBLE_COLUMN:
+      return createFloat(m_doubles[row], m_typeIds[row]);
+    case STRING_COLUMN: {
+      const char* value = getString(row);
+      return createString(value, static_cast<uint32_t>(strlen(value)));
+    }
+    case OBJECT_COLUMN:
+      return m_objects[row];
+    default:
+      return nullptr;
+  }
+}
+
+void ColumnarStructSetImpl::Column::addNull() {
+  addPlaceholder();
+  addRow(true);
+}
+
+void ColumnarStructSetImpl::Column::addInt64(int64_t value, int8_t typeId) {
+  if (prepare(INT64_COLUMN)) {
+    m_int64s.push_back(value);
+    m_typeIds.push_back(typeId);
+  } else {
+    m_objects.push_back(createInt(value, typeId));
+  }
+  addRow(false);
+}
+
+void ColumnarStructSetImpl::Column::addDouble(double value, int8_t typeId) {
+  if (prepare(DOUBLE_COLUMN)) {
+    m_doubles.push_back(value);
+    m_typeIds.push_back(typeId);
+  } else {
+    m_objects.push_back(createFloat(value, typeId));
+  }
+  addRow(false);
+}
+
+void ColumnarStructSetImpl::Column::addString(const char* value,
+                                              uint32_t length) {
+  if (prepare(STRING_COLUMN)) {
+    m_stringOffsets.push_back(m_strings.size());
+    m_strings.insert(m_strings.end(), value, value + length);
+    m_strings.push_back('\0');
+  } else {
+    m_objects.push_back(createString(value, length));
+  }
+  addRow(false);
+}
+
+void ColumnarStructSetImpl::Column::addObject(const CacheablePtr& value) {
+  if (value == nullptr) {
+    addNull();
+    return;
+  }
+  prepare(OBJECT_COLUMN);
+  m_objects.push_back(value);
+  addRow(false);
+}
+
+bool ColumnarStructSetImpl::Column::prepare(ColumnType type) {
+  if (m_type == type) {
+    return true;
+  }
+  if (m_type == NULL_COLUMN) {
+    m_type = type;
+    for (int32_t row = 0; row < m_size; ++row) {
+      addPlaceholder();
+    }
+  } else if (m_type != OBJECT_COLUMN) {
+    // values of different types; keep them all as objects from now on
+    std::vector<CacheablePtr> objects;
+    objects.reserve(m_size + 1);
+    for (int32_t row = 0; row < m_size; ++row) {
+      objects.push_back(getObject(row));
+    }
+    m_objects.swap(objects);
+    std::vector<int64_t>().swap(m_int64s);
+    std::vector<double>().swap(m_doubles);
+    std::vector<int8_t>().swap(m_typeIds);
+    std::vector<size_t>().swap(m_stringOffsets);
+    std::vector<char>().swap(m_strings);
+    m_type = OBJECT_COLUMN;
+  }
+  return m_type == type;
+}
+
+void ColumnarStructSetImpl::Column::addPlaceholder() {
+  switch (m_type) {
+    case INT64_COLUMN:
+      m_int64s.push_back(0);
+      m_typeIds.push_back(0);
+      break;
+    case DOUBLE_COLUMN:
+      m_doubles.push_back(0);
+      m_typeIds.push_back(0);
+      break;
+    case STRING_COLUMN:
+      m_stringOffsets.push_back(m_strings.size());
+      break;
+    case OBJECT_COLUMN:
+      m_objects.push_back(nullptr);
+      break;
+    default:
+      break;
+  }
+}
+
+void ColumnarStructSetImpl::Column::addRow(bool isNull) {
+  if ((m_size & 63) == 0) {
+    m_nulls.push_back(0);
+  }
+  if (isNull) {
+    m_nulls.back() |= static_cast<uint64_t>(1) << (m_size & 63);
+  }
+  ++m_size;
+}
+
+CacheablePtr ColumnarStructSetImpl::Column::createInt(int64_t value,
+                                                      int8_t typeId) {
+  switch (typeId) {
+    case GeodeTypeIds::CacheableByte:
+      return CacheableByte::create(static_cast<uint8_t>(value));
+    case GeodeTypeIds::CacheableInt16:
+      return CacheableInt16::create(static_cast<int16_t>(value));
+    case GeodeTypeIds::CacheableInt32:
+      return CacheableInt32::create(static_cast<int32_t>(value));
+    default:
+      return CacheableInt64::create(value);
+  }
+}
+
+CacheablePtr ColumnarStructSetImpl::Column::createFloat(double value,
+                                                        int8_t typeId) {
+  if (typeId == GeodeTypeIds::CacheableFloat) {
+    return CacheableFloat::create(static_cast<float>(value));
+  }
+  return CacheableDouble::create(value);
+}
+
+ColumnarStructSetImpl::ColumnarStructSetImpl() : m_rows(0), m_nextField(0) {}
+
+ColumnarStructSetImpl::~ColumnarStructSetImpl() {}
+
+void ColumnarStructSetImpl::setFieldNames(
+    const std::vector<CacheableStringPtr>& fieldNames) {
+  if (hasFields()) {
+    return;
+  }
+  if (fieldNames.empty()) {
+    m_fieldNames.push_back("");
+  }
+  for (size_t i = 0; i < fieldNames.size(); i++) {
+    m_fieldNames.push_back(fieldNames[i]->asChar());
+    m_fieldNameIndexMap.insert(
+        std::make_pair(fieldNames[i]->asChar(), static_cast<int32_t>(i)));
+  }
+  m_columns.resize(m_fieldNames.size());
+}
+
+void ColumnarStructSetImpl::readValue(DataInput& input, bool keepSerialized) {
+  Column& column = m_columns[m_nextField];
+  int8_t typeId;
+  input.read(&typeId);
+  switch (typeId) {
+    case GeodeTypeIds::NullObj:
+      column.addNull();
+      break;
+    case GeodeTypeIds::CacheableByte: {
+      int8_t value;
+      input.read(&value);
+      column.addInt64(value, typeId);
+      break;
+    }
+    case GeodeTypeIds::CacheableInt16: {
+      int16_t value;
+      input.readInt(&value);
+      column.addInt64(value, typeId);
+      break;
+    }
+    case GeodeTypeIds::CacheableInt32: {
+      int32_t value;
+      input.readInt(&value);
+      column.addInt64(value, typeId);
+      break;
+    }
+    case GeodeTypeIds::CacheableInt64: {
+      int64_t value;
+      input.readInt(&value);
+      column.addInt64(value, typeId);
+      break;
+    }
+    case GeodeTypeIds::CacheableFloat: {
+      float value;
+      input.readFloat(&value);
+      column.addDouble(value, typeId);
+      break;
+    }
+    case GeodeTypeIds::CacheableDouble: {
+      double value;
+      input.readDouble(&value);
+      column.addDouble(value, typeId);
+      break;
+    }
+    case GeodeTypeIds::CacheableASCIIString:
+    case GeodeTypeIds::CacheableString: {
+      // ASCII, or java modified UTF-8 with the same length prefix
+      uint16_t length;
+      input.readInt(&length);
+      readString(input, column, length);
+      break;
+    }
+    case GeodeTypeIds::CacheableASCIIStringHuge: {
+      uint32_t length;
+      input.readInt(&length);
+      readString(input, column, length);
+      break;
+    }
+    case GeodeTypeIds::CacheableStringHuge:
+      readStringHuge(input, column);
+      break;
+    default: {
+      input.rewindCursor(1);
+      SerializablePtr value;
+      TcrMessageHelper::readObject(input, value, keepSerialized);
+      column.addObject(value);
+      break;
+    }
+  }
+  nextField();
+}
+
+void ColumnarStructSetImpl::addValue(const CacheablePtr& value) {
+  Column& column = m_columns[m_nextField];
+  auto intValue = std::dynamic_pointer_cast<CacheableInt32>(value);
+  if (intValue != nullptr) {
+    column.addInt64(intValue->value(), GeodeTypeIds::CacheableInt32);
+  } else {
+    column.addObject(value);
+  }
+  nextField();
+}
+
+void ColumnarStructSetImpl::readString(DataInput& input, Column& column,
+                                       uint32_t length) {
+  if (length > static_cast<uint32_t>(input.getBytesRemaining())) {
+    throw OutOfRangeException(
+        "ColumnarStructSetImpl: attempt to read string beyond buffer");
+  }
+  column.addString(reinterpret_cast<const char*>(input.currentBufferPosition()),
+                   length);
+  input.advanceCursor(static_cast<int32_t>(length));
+}
+
+void ColumnarStructSetImpl::readStringHuge(DataInput& input, Column& column) {
+  // UTF-16 chars, stored in java modified UTF-8 like the other strings
+  uint32_t length;
+  input.readInt(&length);
+  m_scratch.clear();
+  for (uint32_t i = 0; i < length; i++) {
+    uint16_t ch;
+    input.readInt(&ch);
+    if (ch != 0 && ch < 0x80) {
+      m_scratch.push_back(static_cast<char>(ch));
+    } else if (ch < 0x800) {
+      m_scratch.push_back(static_cast<char>(0xc0 | (ch >> 6)));
+      m_scratch.push_back(static_cast<char>(0x80 | (ch & 0x3f)));
+    } else {
+      m_scratch.push_back(static_cast<char>(0xe0 | (ch >> 12)));
+      m_scratch.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3f)));
+      m_scratch.push_back(static_cast<char>(0x80 | (ch & 0x3f)));
+    }
+  }
+  column.addString(m_scratch.empty() ? "" : &m_scratch[0],
+                   static_cast<uint32_t>(m_scratch.size()));
+}
+
+void ColumnarStructSetImpl::clear() {
+  m_columns.clear();
+  m_fieldNames.clear();
+  m_fieldNameIndexMap.clear();
+  m_rows = 0;
+  m_nextField = 0;
+}
+
+int32_t ColumnarStructSetImpl::size() const { return m_rows; }
+
+int32_t ColumnarStructSetImpl::getFieldCount() const {
+  return static_cast<int32_t>(m_columns.size());
+}
+
+int32_t ColumnarStructSetImpl::getFieldIndex(const char* fieldname) const {
+  std::map<std::string, int32_t>::const_iterator iter =
+      m_fieldNameIndexMap.find(fieldname);
+  if (iter != m_fieldNameIndexMap.end()) {
+    return iter->second;
+  } else {
+    throw IllegalArgumentException("fieldname not found");
+  }
+}
+
+const char* ColumnarStructSetImpl::getFieldName(int32_t index) const {
+  if (index >= 0 && index < getFieldCount()) {
+    return m_fieldNames[index].c_str();
+  }
+  return nullptr;
+}
+
+ColumnarStructSet::ColumnType ColumnarStructSetImpl::getColumnType(
+    int32_t field) const {
+  if (field < 0 || field >= getFieldCount()) {
+    throw IllegalArgumentException("Index out of bounds");
+  }
+  return m_columns[field].getType();
+}
+
+bool ColumnarStructSetImpl::isNull(int32_t row, int32_t field) const {
+  return getColumn(row, field).isNull(row);
+}
+
+int64_t ColumnarStructSetImpl::getInt64(int32_t row, int32_t field) const {
+  const Column& column = getColumn(row, field);
+  if (column.isNull(row)) {
+    return 0;
+  }
+  checkType(column, INT64_COLUMN, "getInt64");
+  return column.getInt64(row);
+}
+
+double ColumnarStructSetImpl::getDouble(int32_t row, int32_t field) const {
+  const Column& column = getColumn(row, field);
+  if (column.isNull(row)) {
+    return 0;
+  }
+  checkType(column, DOUBLE_COLUMN, "getDouble");
+  return column.getDouble(row);
+}
+
+const char* ColumnarStructSetImpl::getString(int32_t row,
+                                             int32_t field) const {
+  const Column& column = getColumn(row, field);
+  if (column.isNull(row)) {
+    return nullptr;
+  }
+  checkType(column, STRING_COLUMN, "getString");
+  return column.getString(row);
+}
+
+CacheablePtr ColumnarStructSetImpl::getObject(int32_t row,
+                                              int32_t field) const {
+  return getColumn(row, field).getObject(row);
+}
+
+ColumnarStructSetCursor ColumnarStructSetImpl::getCursor() const {
+  return ColumnarStructSetCursor(
+      std::const_pointer_cast<ColumnarStructSetImpl>(shared_from_this()));
+}
+
+const ColumnarStructSetImpl::Column& ColumnarStructSetImpl::getColumn(
+    int32_t row, int32_t field) const {
+  if (row < 0 || row >= m_rows || field < 0 || field >= getFieldCount()) {
+    throw IllegalArgumentException("Index out of bounds");
+  }
+  return m_columns[field];
+}
+
+void ColumnarStructSetImpl::checkType(const Column& column, ColumnType type,
+                                      const char* method) const {
+  if (column.getType() != type) {
+    std::string exMsg = "ColumnarStructSet::";
+    exMsg += method;
+    exMsg += ": field is not of that type";
+    throw IllegalStateException(exMsg.c_str());
+  }
+}
+
+CacheableStringPtr ColumnarStructSetImpl::createString(const char* value,
+                                                       uint32_t length) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(value);
+  uint32_t i = 0;
+  while (i < length && bytes[i] < 0x80) {
+    ++i;
+  }
+  if (i == length) {
+    return CacheableString::create(value, static_cast<int32_t>(length));
+  }
+  std::wstring wide;
+  wide.reserve(length);
+  for (i = 0; i < length;) {
+    uint8_t b = bytes[i];
+    if ((b & 0xe0) == 0xc0 && i + 1 < length) {
+      wide += static_cast<wchar_t>(((b & 0x1f) << 6) | (bytes[i + 1] & 0x3f));
+      i += 2;
+    } else if ((b & 0xf0) == 0xe0 && i + 2 < length) {
+      wide += static_cast<wchar_t>(((b & 0x0f) << 12) |
+                                   ((bytes[i + 1] & 0x3f) << 6) |
+                                   (bytes[i + 2] & 0x3f));
+      i += 3;
+    } else {
+      wide += static_cast<wchar_t>(b);
+      ++i;
+    }
+  }
+  return CacheableString::create(wide.c_str(),
+                                 static_cast<int32_t>(wide.size()));
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#ifndef GEODE_COLUMNARSTRUCTSETIMPL_H_
+#define GEODE_COLUMNARSTRUCTSETIMPL_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/geode_globals.hpp>
+#include <geode/geode_types.hpp>
+
+#include <geode/ColumnarStructSet.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/DataInput.hpp>
+
+#include <string>
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * The ColumnarStructSet filled by ChunkedQueryResponse while it reads the
+ * reply to a query. Values are added row after row, one field at a time.
+ */
+class CPPCACHE_EXPORT ColumnarStructSetImpl
+    : public ColumnarStructSet,
+      public std::enable_shared_from_this<ColumnarStructSetImpl> {
+ public:
+  ColumnarStructSetImpl();
+
+  /**
+   * Creates a column per field name, or a single unnamed column if there
+   * are none. Does nothing if the columns have already been created.
+   */
+  void setFieldNames(const std::vector<CacheableStringPtr>& fieldNames);
+
+  inline bool hasFields() const { return !m_columns.empty(); }
+
+  /**
+   * Reads the next value from input into the column of the next field.
+   * Integral, floating point and string values are decoded in place; other
+   * values are read as objects, PDX values kept serialized if keepSerialized
+   * is true.
+   */
+  void readValue(DataInput& input, bool keepSerialized);
+
+  /** Adds a value that has already been read. */
+  void addValue(const CacheablePtr& value);
+
+  /** Returns true if the values added so far make up whole rows. */
+  inline bool isComplete() const { return m_nextField == 0; }
+
+  /** Drops the columns and their values. */
+  void clear();
+
+  virtual int32_t size() const;
+
+  virtual int32_t getFieldCount() const;
+
+  virtual int32_t getFieldIndex(const char* fieldname) const;
+
+  virtual const char* getFieldName(int32_t index) const;
+
+  virtual ColumnType getColumnType(int32_t field) const;
+
+  virtual bool isNull(int32_t row, int32_t field) const;
+
+  virtual int64_t getInt64(int32_t row, int32_t field) const;
+
+  virtual double getDouble(int32_t row, int32_t field) const;
+
+  virtual const char* getString(int32_t row, int32_t field) const;
+
+  virtual CacheablePtr getObject(int32_t row, int32_t field) const;
+
+  virtual ColumnarStructSetCursor getCursor() const;
+
+  virtual ~ColumnarStructSetImpl();
+
+  /**
+   * Creates a CacheableString from a java modified UTF-8 encoded string.
+   */
+  static CacheableStringPtr createString(const char* value, uint32_t length);
+
+ private:
+  /**
+   * The values of one field. Each typed vector holds a value, 0 for null
+   * values, for every row once the column has that type; the strings are
+   * stored NUL terminated, one after the other, in a single arena. The type
+   * id each number was received with is kept so that it is returned as an
+   * object of that type.
+   */
+  class Column {
+   public:
+    Column();
+
+    inline ColumnType getType() const { return m_type; }
+
+    inline bool isNull(int32_t row) const {
+      return (m_nulls[row >> 6] & (static_cast<uint64_t>(1) << (row & 63))) !=
+             0;
+    }
+
+    inline int64_t getInt64(int32_t row) const { return m_int64s[row]; }
+
+    inline double getDouble(int32_t row) const { return m_doubles[row]; }
+
+    inline const char* getString(int32_t row) const {
+      return &m_strings[m_stringOffsets[row]];
+    }
+
+    CacheablePtr getObject(int32_t row) const;
+
+    void addNull();
+    void addInt64(int64_t value, int8_t typeId);
+    void addDouble(double value, int8_t typeId);
+    void addString(const char* value, uint32_t length);
+    void addObject(const CacheablePtr& value);
+
+   private:
+    ColumnType m_type;
+    int32_t m_size;
+    std::vector<uint64_t> m_nulls;
+    std::vector<int64_t> m_int64s;
+    std::vector<double> m_doubles;
+    std::vector<int8_t> m_typeIds;
+    std::vector<size_t> m_stringOffsets;
+    std::vector<char> m_strings;
+    std::vector<CacheablePtr> m_objects;
+
+    // makes the column ready for a value of the given type and returns
+    // false if the value has to be added as an object instead
+    bool prepare(ColumnType type);
+    void addPlaceholder();
+    void addRow(bool isNull);
+
+    static CacheablePtr createInt(int64_t value, int8_t typeId);
+    static CacheablePtr createFloat(double value, int8_t typeId);
+  };
+
+  const Column& getColumn(int32_t row, int32_t field) const;
+  void checkType(const Column& column, ColumnType type,
+                 const char* method) const;
+  void readString(DataInput& input, Column& column, uint32_t length);
+  void readStringHuge(DataInput& input, Column& column);
+
+  inline void nextField() {
+    if (++m_nextField == m_columns.size()) {
+      m_nextField = 0;
+      ++m_rows;
+    }
+  }
+
+  std::vector<Column> m_columns;
+  std::vector<std::string> m_fieldNames;
+  std::map<std::string, int32_t> m_fieldNameIndexMap;
+  int32_t m_rows;
+  size_t m_nextField;
+  std::vector<char> m_scratch;
+};
+
+typedef std::shared_ptr<ColumnarStructSetImpl> ColumnarStructSetImplPtr;
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COLUMNARSTRUCTSETIMPL_H_
@@ -16,7 +16,6 @@
  */
 #include "ConcurrentEntriesMap.hpp"
 #include "RegionInternal.hpp"
-#include "TableOfPrimes.hpp"
 
 #include <algorithm>
 
@@ -34,17 +33,18 @@ ConcurrentEntriesMap::ConcurrentEntriesMap(EntryFactory* entryFactory,
       m_size(0),
       m_region(region),
       m_numDestroyTrackers(0),
+      m_tableBytes(0),
       /* adongre
        * CID 28929: Uninitialized pointer field (UNINIT_CTOR)
        */
-      m_concurrencyChecksEnabled(concurrencyChecksEnabled) {
+      m_concurrencyChecksEnabled(concurrencyChecksEnabled),
+      m_valueArena(nullptr) {
   GF_DEV_ASSERT(entryFactory != nullptr);
 
-  uint8_t maxConcurrency = TableOfPrimes::getMaxPrimeForConcurrency();
-  if (concurrency > maxConcurrency) {
-    m_concurrency = maxConcurrency;
-  } else {
-    m_concurrency = TableOfPrimes::nextLargerPrimeForConcurrency(concurrency);
+  // round up to a power of two so that segmentIdx can mask
+  m_concurrency = 1;
+  while (m_concurrency < concurrency && m_concurrency < MAX_CONCURRENCY) {
+    m_concurrency <<= 1;
   }
 }
 
@@ -53,7 +53,8 @@ void ConcurrentEntriesMap::open(uint32_t initialCapacity) {
   m_segments = new MapSegment[m_concurrency];
   for (int index = 0; index < m_concurrency; ++index) {
     m_segments[index].open(m_region, this->getEntryFactory(), segSize,
-                           &m_numDestroyTrackers, m_concurrencyChecksEnabled);
+                           &m_numDestroyTrackers, m_concurrencyChecksEnabled,
+                           &m_tableBytes, m_valueArena);
   }
 }
 
@@ -171,6 +172,8 @@ void ConcurrentEntriesMap::values(VectorOfCacheable& result) const {
 
 uint32_t ConcurrentEntriesMap::size() const { return m_size; }
 
+int64_t ConcurrentEntriesMap::tableBytes() const { return m_tableBytes; }
+
 int ConcurrentEntriesMap::addTrackerForEntry(const CacheableKeyPtr& key,
                                              CacheablePtr& oldValue,
                                              bool addIfAbsent,
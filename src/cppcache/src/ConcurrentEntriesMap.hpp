@@ -38,12 +38,19 @@ class RegionInternal;
  */
 class CPPCACHE_EXPORT ConcurrentEntriesMap : public EntriesMap {
  protected:
+  /** Upper bound on the number of segments. */
+  static const uint8_t MAX_CONCURRENCY = 128;
+
   uint8_t m_concurrency;
   MapSegment* m_segments;
   std::atomic<uint32_t> m_size;
   RegionInternal* m_region;
   std::atomic<int32_t> m_numDestroyTrackers;
+  // bytes allocated by the hash tables of all segments
+  std::atomic<int64_t> m_tableBytes;
   bool m_concurrencyChecksEnabled;
+  // serialized values of a region with arena storage, else null
+  ValueArenaPtr m_valueArena;
   // TODO:  hashcode() is invoked 3-4 times -- need a better
   // implementation (STLport hash_map?) that will invoke it only once
   /**
@@ -62,9 +69,14 @@ class CPPCACHE_EXPORT ConcurrentEntriesMap : public EntriesMap {
   }
 
   /**
-   * Return the segment index number for the given hash.
+   * Return the segment index number for the given hash. The number of
+   * segments is a power of two; the hash is spread by a multiplication so
+   * that keys whose hash codes differ only in the high bits do not all land
+   * in one segment.
    */
-  inline int segmentIdx(uint32_t hash) const { return (hash % m_concurrency); }
+  inline int segmentIdx(uint32_t hash) const {
+    return ((hash * 0x9e3779b1U) >> 16) & (m_concurrency - 1);
+  }
 
  public:
   /**
@@ -74,6 +86,13 @@ class CPPCACHE_EXPORT ConcurrentEntriesMap : public EntriesMap {
                        bool concurrencyChecksEnabled, RegionInternal* region,
                        uint8_t concurrency = 16);
 
+  /**
+   * Keep the values serialized in the arena; must be called before open.
+   */
+  inline void setValueArena(const ValueArenaPtr& valueArena) {
+    m_valueArena = valueArena;
+  }
+
   /**
    * Initialize segments with proper EntryFactory.
    */
@@ -140,6 +159,8 @@ class CPPCACHE_EXPORT ConcurrentEntriesMap : public EntriesMap {
    */
   virtual uint32_t size() const;
 
+  virtual int64_t tableBytes() const;
+
   virtual int addTrackerForEntry(const CacheableKeyPtr& key,
                                  CacheablePtr& oldValue, bool addIfAbsent,
                                  bool failIfPresent, bool incUpdateCount);
@@ -22,6 +22,7 @@
 
 #include <geode/geode_globals.hpp>
 #include <geode/ExceptionTypes.hpp>
+#include <ace/os_include/sys/os_uio.h>
 
 /*
 These are superseded by the connect-timeout system property for SR # 6525.
@@ -84,6 +85,33 @@ class Connector {
   virtual int32_t send(const char *b, int32_t len, uint32_t waitSeconds,
                        uint32_t waitMicroSeconds) = 0;
 
+  /**
+   * Writes the given buffers, in order, to the underlying output stream.
+   * By default each buffer is written with <code>send</code>; connections
+   * that support gather writes override this.
+   *
+   * @param      iov   the buffers.
+   * @param      iovcnt   the number of buffers.
+   * @param      waitSeconds   the number of seconds to allow the write to
+   * complete.
+   * @return     the actual number of bytes written.
+   * @exception  GeodeIOException, TimeoutException, IllegalArgumentException.
+   */
+  virtual int32_t sendv(const iovec *iov, int32_t iovcnt, uint32_t waitSeconds,
+                        uint32_t waitMicroSeconds) {
+    int32_t totalSent = 0;
+    for (int32_t i = 0; i < iovcnt; i++) {
+      int32_t len = static_cast<int32_t>(iov[i].iov_len);
+      int32_t sent = send(static_cast<const char *>(iov[i].iov_base), len,
+                          waitSeconds, waitMicroSeconds);
+      totalSent += sent;
+      if (sent < len) {
+        break;
+      }
+    }
+    return totalSent;
+  }
+
   /**
    * Initialises the connection.
    */
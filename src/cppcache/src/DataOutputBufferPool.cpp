@@ -0,0 +1,186 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "DataOutputBufferPool.hpp"
+#include <cstdlib>
+#include <mutex>
+
+using namespace apache::geode::client;
+using apache::geode::util::concurrent::spinlock_mutex;
+
+const uint32_t DataOutputBufferPool::MIN_BUFFER_SIZE;
+const size_t DataOutputBufferPool::MAX_POOLED_BYTES;
+const size_t DataOutputBufferPool::MAGAZINE_SIZE;
+const size_t DataOutputBufferPool::MAX_MAGAZINE_BYTES;
+
+/**
+ * Buffers cached by one thread. The bytes they hold are already accounted
+ * for in m_bytesHeld; on thread exit they move to the shared size classes.
+ */
+class DataOutputBufferPool::Magazine {
+ public:
+  Magazine() : m_count(0), m_bytes(0) {}
+
+  ~Magazine() {
+    DataOutputBufferPool& pool = getInstance();
+    while (m_count > 0) {
+      m_count--;
+      pool.checkinShared(m_buffers[m_count].m_buf, m_buffers[m_count].m_size);
+    }
+  }
+
+  bool push(uint8_t* buffer, uint32_t size) {
+    if (m_count == MAGAZINE_SIZE || m_bytes + size > MAX_MAGAZINE_BYTES) {
+      return false;
+    }
+    m_buffers[m_count].m_buf = buffer;
+    m_buffers[m_count].m_size = size;
+    m_count++;
+    m_bytes += size;
+    return true;
+  }
+
+  uint8_t* pop(uint32_t* size) {
+    if (m_count == 0) {
+      return nullptr;
+    }
+    m_count--;
+    *size = m_buffers[m_count].m_size;
+    m_bytes -= *size;
+    return m_buffers[m_count].m_buf;
+  }
+
+ private:
+  BufferDesc m_buffers[MAGAZINE_SIZE];
+  size_t m_count;
+  size_t m_bytes;
+};
+
+DataOutputBufferPool::DataOutputBufferPool()
+    : m_hits(0), m_misses(0), m_bytesHeld(0), m_discards(0) {}
+
+DataOutputBufferPool& DataOutputBufferPool::getInstance() {
+  // never destroyed since thread exit may still return buffers to it
+  static DataOutputBufferPool* instance = new DataOutputBufferPool();
+  return *instance;
+}
+
+DataOutputBufferPool::Magazine& DataOutputBufferPool::getMagazine() {
+  static thread_local Magazine magazine;
+  return magazine;
+}
+
+int DataOutputBufferPool::sizeClassFor(uint32_t size) {
+  int sizeClass = 0;
+  while (sizeClass < NUM_SIZE_CLASSES - 1 &&
+         size >= (static_cast<uint64_t>(MIN_BUFFER_SIZE) << (sizeClass + 1))) {
+    sizeClass++;
+  }
+  return sizeClass;
+}
+
+uint8_t* DataOutputBufferPool::checkout(uint32_t* size) {
+  DataOutputBufferPool& pool = getInstance();
+  uint8_t* buffer = getMagazine().pop(size);
+  if (buffer == nullptr) {
+    buffer = pool.checkoutShared(size);
+  }
+  if (buffer == nullptr) {
+    ++pool.m_misses;
+    return nullptr;
+  }
+  ++pool.m_hits;
+  pool.m_bytesHeld -= *size;
+  return buffer;
+}
+
+void DataOutputBufferPool::checkin(uint8_t* buffer, uint32_t size) {
+  if (buffer == nullptr) {
+    return;
+  }
+  DataOutputBufferPool& pool = getInstance();
+  if (!pool.reserve(size)) {
+    ++pool.m_discards;
+    std::free(buffer);
+    return;
+  }
+  if (!getMagazine().push(buffer, size)) {
+    pool.checkinShared(buffer, size);
+  }
+}
+
+uint8_t* DataOutputBufferPool::checkoutShared(uint32_t* size) {
+  // smallest buffers first so that big ones stay available for the
+  // serializations that need them
+  for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+    SizeClass& sc = m_classes[i];
+    std::lock_guard<spinlock_mutex> guard(sc.m_lock);
+    if (!sc.m_free.empty()) {
+      BufferDesc desc = sc.m_free.back();
+      sc.m_free.pop_back();
+      *size = desc.m_size;
+      return desc.m_buf;
+    }
+  }
+  return nullptr;
+}
+
+void DataOutputBufferPool::checkinShared(uint8_t* buffer, uint32_t size) {
+  SizeClass& sc = m_classes[sizeClassFor(size)];
+  BufferDesc desc;
+  desc.m_buf = buffer;
+  desc.m_size = size;
+  std::lock_guard<spinlock_mutex> guard(sc.m_lock);
+  sc.m_free.push_back(desc);
+}
+
+bool DataOutputBufferPool::reserve(uint32_t size) {
+  int64_t held = m_bytesHeld.load(std::memory_order_relaxed);
+  do {
+    if (held + size > static_cast<int64_t>(MAX_POOLED_BYTES)) {
+      return false;
+    }
+  } while (!m_bytesHeld.compare_exchange_weak(held, held + size));
+  return true;
+}
+
+int64_t DataOutputBufferPool::getHits() { return getInstance().m_hits; }
+
+int64_t DataOutputBufferPool::getMisses() { return getInstance().m_misses; }
+
+int64_t DataOutputBufferPool::getBytesHeld() {
+  return getInstance().m_bytesHeld;
+}
+
+int64_t DataOutputBufferPool::getDiscards() {
+  return getInstance().m_discards;
+}
+
+void DataOutputBufferPool::clear() {
+  DataOutputBufferPool& pool = getInstance();
+  for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+    std::vector<BufferDesc> buffers;
+    {
+      std::lock_guard<spinlock_mutex> guard(pool.m_classes[i].m_lock);
+      buffers.swap(pool.m_classes[i].m_free);
+    }
+    for (std::vector<BufferDesc>::iterator iter = buffers.begin();
+         iter != buffers.end(); ++iter) {
+      pool.m_bytesHeld -= iter->m_size;
+      std::free(iter->m_buf);
+    }
+  }
+}
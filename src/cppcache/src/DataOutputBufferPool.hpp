@@ -0,0 +1,120 @@
+#pragma once
+
+#ifndef GEODE_DATAOUTPUTBUFFERPOOL_H_
+#define GEODE_DATAOUTPUTBUFFERPOOL_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <geode/geode_globals.hpp>
+#include "NonCopyable.hpp"
+#include "util/concurrent/spinlock_mutex.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Process wide pool of the buffers backing DataOutput objects.
+ *
+ * Buffers are malloc'ed and may have been grown with realloc by the
+ * DataOutput that used them, so they come back in any size. They are kept in
+ * power of two size classes starting at MIN_BUFFER_SIZE and shared by all
+ * threads. Each thread also keeps a small magazine of buffers in front of the
+ * shared classes so that the common checkout/checkin pair on one thread does
+ * not touch any lock. The memory held by the pool as a whole is bounded by
+ * MAX_POOLED_BYTES; buffers that do not fit are freed.
+ */
+class CPPCACHE_EXPORT DataOutputBufferPool : private NonCopyable,
+                                             private NonAssignable {
+ public:
+  /** Size of the buffers given to DataOutput objects on a miss. */
+  static const uint32_t MIN_BUFFER_SIZE = 8192;
+  /** Upper bound on the memory held by the pool, magazines included. */
+  static const size_t MAX_POOLED_BYTES = 64 * 1024 * 1024;
+  /** Number of buffers a thread keeps for itself. */
+  static const size_t MAGAZINE_SIZE = 4;
+  /** Upper bound on the memory in a single thread's magazine. */
+  static const size_t MAX_MAGAZINE_BYTES = 1024 * 1024;
+
+  /**
+   * Returns a pooled buffer and sets size to its capacity, or nullptr when
+   * the pool is empty in which case the caller allocates a buffer of
+   * MIN_BUFFER_SIZE with malloc.
+   */
+  static uint8_t* checkout(uint32_t* size);
+
+  /**
+   * Gives back a buffer allocated with malloc/realloc; it is freed if the
+   * pool is full.
+   */
+  static void checkin(uint8_t* buffer, uint32_t size);
+
+  /** Number of checkouts served from the pool. */
+  static int64_t getHits();
+
+  /** Number of checkouts that found the pool empty. */
+  static int64_t getMisses();
+
+  /** Bytes currently held by the pool, magazines included. */
+  static int64_t getBytesHeld();
+
+  /** Number of buffers freed on checkin because the pool was full. */
+  static int64_t getDiscards();
+
+  /** Frees the buffers in the shared size classes. */
+  static void clear();
+
+ private:
+  struct BufferDesc {
+    uint8_t* m_buf;
+    uint32_t m_size;
+  };
+
+  struct SizeClass {
+    util::concurrent::spinlock_mutex m_lock;
+    std::vector<BufferDesc> m_free;
+  };
+
+  class Magazine;
+
+  static const int NUM_SIZE_CLASSES = 13;  // 8 KB to 32 MB and above
+
+  DataOutputBufferPool();
+
+  static DataOutputBufferPool& getInstance();
+  static Magazine& getMagazine();
+  static int sizeClassFor(uint32_t size);
+
+  uint8_t* checkoutShared(uint32_t* size);
+  void checkinShared(uint8_t* buffer, uint32_t size);
+  bool reserve(uint32_t size);
+
+  SizeClass m_classes[NUM_SIZE_CLASSES];
+  std::atomic<int64_t> m_hits;
+  std::atomic<int64_t> m_misses;
+  std::atomic<int64_t> m_bytesHeld;
+  std::atomic<int64_t> m_discards;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_DATAOUTPUTBUFFERPOOL_H_
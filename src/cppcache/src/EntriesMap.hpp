@@ -113,6 +113,9 @@ class CPPCACHE_EXPORT EntriesMap {
   /** @brief return the number of entries in the map. */
   virtual uint32_t size() const = 0;
 
+  /** @brief return the number of bytes held by the hash tables of the map. */
+  virtual int64_t tableBytes() const = 0;
+
   /**
    * Add a watch for updates for the given entry. If the entry is present in
    * the cache then the current update counter for the entry is returned,
@@ -155,6 +158,13 @@ class CPPCACHE_EXPORT EntriesMap {
     return nullptr;
   }
 
+  /**
+   * Frees the disk copy of an overflowed value that has been read back into
+   * the entry.
+   */
+  virtual void releaseFromDisk(const CacheableKeyPtr& key,
+                               MapEntryImplPtr& me) {}
+
   virtual void reapTombstones(std::map<uint16_t, int64_t>& gcVersions) = 0;
 
   virtual void reapTombstones(CacheableHashSetPtr removedKeys) = 0;
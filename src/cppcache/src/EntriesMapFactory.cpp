@@ -34,7 +34,7 @@ using namespace apache::geode::client;
  */
 EntriesMap* EntriesMapFactory::createMap(RegionInternal* region,
                                          const RegionAttributesPtr& attrs) {
-  EntriesMap* result = nullptr;
+  ConcurrentEntriesMap* result = nullptr;
   uint32_t initialCapacity = attrs->getInitialCapacity();
   uint8_t concurrency = attrs->getConcurrencyLevel();
   /** @TODO will need a statistics entry factory... */
@@ -48,6 +48,7 @@ EntriesMap* EntriesMapFactory::createMap(RegionInternal* region,
   if ((lruLimit != 0) ||
       (prop && prop->heapLRULimitEnabled())) {  // create LRU map...
     LRUAction::Action lruEvictionAction;
+    bool admissionFilterEnabled = prop && prop->lruAdmissionFilter();
     DiskPolicyType::PolicyType dpType = attrs->getDiskPolicy();
     if (dpType == DiskPolicyType::OVERFLOWS) {
       lruEvictionAction = LRUAction::OVERFLOW_TO_DISK;
@@ -63,13 +64,15 @@ EntriesMap* EntriesMapFactory::createMap(RegionInternal* region,
       entryFactory->setConcurrencyChecksEnabled(concurrencyChecksEnabled);
       result = new LRUEntriesMap(entryFactory, region, lruEvictionAction,
                                  lruLimit, concurrencyChecksEnabled,
-                                 concurrency, heapLRUEnabled);
+                                 concurrency, heapLRUEnabled,
+                                 admissionFilterEnabled);
     } else {
       EntryFactory* entryFactory = LRUEntryFactory::singleton;
       entryFactory->setConcurrencyChecksEnabled(concurrencyChecksEnabled);
       result = new LRUEntriesMap(entryFactory, region, lruEvictionAction,
                                  lruLimit, concurrencyChecksEnabled,
-                                 concurrency, heapLRUEnabled);
+                                 concurrency, heapLRUEnabled,
+                                 admissionFilterEnabled);
     }
   } else if (ttl != 0 || idle != 0) {
     // create entries with a ExpEntryFactory.
@@ -84,6 +87,9 @@ EntriesMap* EntriesMapFactory::createMap(RegionInternal* region,
     result = new ConcurrentEntriesMap(entryFactory, concurrencyChecksEnabled,
                                       region, concurrency);
   }
+  if (attrs->getArenaStorageEnabled()) {
+    result->setValueArena(ValueArena::create(attrs->getPoolName()));
+  }
   result->open(initialCapacity);
   return result;
 }
@@ -31,19 +31,17 @@
 using namespace apache::geode::client;
 
 EntryExpiryHandler::EntryExpiryHandler(RegionInternalPtr& rptr,
-                                       MapEntryImplPtr& entryPtr,
                                        ExpirationAction::Action action,
                                        uint32_t duration)
-    : m_regionPtr(rptr),
-      m_entryPtr(entryPtr),
-      m_action(action),
-      m_duration(duration) {}
+    : m_regionPtr(rptr), m_action(action), m_duration(duration) {}
 
 int EntryExpiryHandler::handle_timeout(const ACE_Time_Value& current_time,
                                        const void* arg) {
+  // the entry is kept alive by its expiry task
+  MapEntryImpl* entry = static_cast<MapEntryImpl*>(const_cast<void*>(arg));
   CacheableKeyPtr key;
-  m_entryPtr->getKeyI(key);
-  ExpEntryProperties& expProps = m_entryPtr->getExpProperties();
+  entry->getKeyI(key);
+  ExpEntryProperties& expProps = entry->getExpProperties();
   try {
     uint32_t curr_time = static_cast<uint32_t>(current_time.sec());
 
@@ -78,8 +76,8 @@ int EntryExpiryHandler::handle_timeout(const ACE_Time_Value& current_time,
            Utils::getCacheableKeyString(key)->asChar(),
            m_regionPtr->getFullPath());
   CacheImpl::expiryTaskManager->resetTask(expProps.getExpiryTaskId(), 0);
-  //  we now delete the handler in GF_Timer_Heap_ImmediateReset_T
-  // and always return success.
+  // the task is freed by the ExpiryTaskManager and the shared handler
+  // once no task refers to it, so always return success.
 
   // set the invalid taskid as we have removed the expiry task
   expProps.setExpiryTaskId(-1);
@@ -87,7 +85,7 @@ int EntryExpiryHandler::handle_timeout(const ACE_Time_Value& current_time,
 }
 
 int EntryExpiryHandler::handle_close(ACE_HANDLE, ACE_Reactor_Mask) {
-  //  we now delete the handler in GF_Timer_Heap_ImmediateReset_T
+  // the handler is shared by the expiry tasks of the region's entries
   return 0;
 }
 
@@ -38,7 +38,9 @@ namespace client {
  * @class EntryExpiryTask EntryExpiryTask.hpp
  *
  * The task object which contains the handler which gets triggered
- * when an entry expires.
+ * when an entry expires. One handler is shared by the expiry tasks of all
+ * the entries of a region that have the same action and duration; the
+ * entry is passed as the arg of handle_timeout.
  *
  * TODO: TODO: cleanup region entry nodes and handlers from expiry task
  * manager when region is destroyed
@@ -48,11 +50,12 @@ class CPPCACHE_EXPORT EntryExpiryHandler : public ACE_Event_Handler {
   /**
    * Constructor
    */
-  EntryExpiryHandler(RegionInternalPtr& rptr, MapEntryImplPtr& entryPtr,
-                     ExpirationAction::Action action, uint32_t duration);
+  EntryExpiryHandler(RegionInternalPtr& rptr, ExpirationAction::Action action,
+                     uint32_t duration);
 
-  /** This task object will be registered with the Timer Queue.
-   *  When the timer expires the handle_timeout is invoked.
+  /** This task object will be registered with the timer wheel of the
+   *  ExpiryTaskManager. When the timer expires the handle_timeout is
+   *  invoked with the MapEntryImpl of the expired entry as arg.
    */
   int handle_timeout(const ACE_Time_Value& current_time, const void* arg);
   /**
@@ -60,11 +63,13 @@ class CPPCACHE_EXPORT EntryExpiryHandler : public ACE_Event_Handler {
    */
   int handle_close(ACE_HANDLE handle, ACE_Reactor_Mask close_mask);
 
+  ExpirationAction::Action getAction() const { return m_action; }
+
+  uint32_t getDuration() const { return m_duration; }
+
  private:
   // The region which contains the entry
   RegionInternalPtr m_regionPtr;
-  // The ExpMapEntry contained in the ConcurrentMap against the key.
-  MapEntryImplPtr m_entryPtr;
   // Action to be taken on expiry
   ExpirationAction::Action m_action;
   // Duration after which the task should be reset in case of
@@ -73,6 +78,7 @@ class CPPCACHE_EXPORT EntryExpiryHandler : public ACE_Event_Handler {
   // perform the actual expiration action
   void DoTheExpirationAction(const CacheableKeyPtr& key);
 };
+typedef std::shared_ptr<EntryExpiryHandler> EntryExpiryHandlerPtr;
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -0,0 +1,92 @@
+#pragma once
+
+#ifndef GEODE_EVENTBATCH_H_
+#define GEODE_EVENTBATCH_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <mutex>
+#include <vector>
+
+#include <geode/BatchCacheListener.hpp>
+
+#include "EventId.hpp"
+
+/**
+ * @file EventBatch.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class EventBatch EventBatch.hpp
+ *
+ * The entry events of a region waiting for delivery to its
+ * BatchCacheListener, together with the ids of the notifications whose
+ * periodic ack is held until the batch is delivered or discarded. An event
+ * and the id of its notification are added, and taken, under one lock so
+ * that no id is released before its event is delivered.
+ */
+class EventBatch {
+ public:
+  /**
+   * Adds an event, and the id of its notification if the ack of that is
+   * held, and returns the number of events in the batch.
+   */
+  size_t add(const BatchCacheListener::EventPtr& event,
+             const EventIdPtr& heldEventId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events.push_back(event);
+    if (heldEventId != nullptr) {
+      m_heldEventIds.push_back(heldEventId);
+    }
+    return m_events.size();
+  }
+
+  /**
+   * Moves the events and the held notification ids out of the batch; the
+   * caller releases the ids once it delivered or discarded the events.
+   * @return false if the batch is empty
+   */
+  bool take(std::vector<BatchCacheListener::EventPtr>& events,
+            std::vector<EventIdPtr>& heldEventIds) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_events.empty()) {
+      return false;
+    }
+    events.swap(m_events);
+    heldEventIds.swap(m_heldEventIds);
+    m_events.clear();
+    m_heldEventIds.clear();
+    return true;
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::vector<BatchCacheListener::EventPtr> m_events;
+  std::vector<EventIdPtr> m_heldEventIds;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_EVENTBATCH_H_
@@ -25,6 +25,7 @@ void EventIdMap::init(int32_t expirySecs) { m_expiry = expirySecs; }
 void EventIdMap::clear() {
   GUARD_MAP;
   m_map.clear();
+  m_held.clear();
 }
 
 EventIdMapEntry EventIdMap::make(EventIdPtr eventid) {
@@ -44,23 +45,38 @@ bool EventIdMap::isDuplicate(EventSourcePtr key, EventSequencePtr value) {
   return false;
 }
 
-bool EventIdMap::put(EventSourcePtr key, EventSequencePtr value, bool onlynew) {
+bool EventIdMap::put(EventSourcePtr key, EventSequencePtr value, bool onlynew,
+                     bool hold) {
   GUARD_MAP;
 
   value->touch(m_expiry);
 
   const auto& entry = m_map.find(key);
 
-  if (entry != m_map.end()) {
-    if (onlynew && ((*value) <= (*(entry->second)))) {
-      return false;
-    } else {
-      m_map[key] = value;
-      return true;
+  if (entry != m_map.end() && onlynew && ((*value) <= (*(entry->second)))) {
+    return false;
+  }
+  m_map[key] = value;
+  if (hold) {
+    m_held[key].m_seqNums.insert(value->getSeqNum());
+  }
+  return true;
+}
+
+void EventIdMap::release(EventSourcePtr key, int64_t seqNum) {
+  GUARD_MAP;
+
+  const auto& held = m_held.find(key);
+
+  if (held != m_held.end()) {
+    auto& seqNums = held->second.m_seqNums;
+    const auto& seqNumEntry = seqNums.find(seqNum);
+    if (seqNumEntry != seqNums.end()) {
+      seqNums.erase(seqNumEntry);
+    }
+    if (seqNums.empty()) {
+      m_held.erase(held);
     }
-  } else {
-    m_map[key] = value;
-    return true;
   }
 }
 
@@ -101,6 +117,19 @@ EventIdMapEntryList EventIdMap::getUnAcked() {
       continue;
     }
 
+    // acking a sequence number acks all the earlier events of the source,
+    // so a source with held events is acked up to the first one of them
+    const auto& held = m_held.find(entry.first);
+    if (held != m_held.end()) {
+      int64_t ackable = *held->second.m_seqNums.begin() - 1;
+      if (ackable > held->second.m_ackedSeqNum) {
+        held->second.m_ackedSeqNum = ackable;
+        entries.push_back(std::make_pair(
+            entry.first, std::make_shared<EventSequence>(ackable)));
+      }
+      continue;
+    }
+
     entry.second->setAcked(true);
     entries.push_back(std::make_pair(entry.first, entry.second));
   }
@@ -120,6 +149,12 @@ uint32_t EventIdMap::clearAckedFlags(EventIdMapEntryList& entries) {
       entry->second->setAcked(false);
       cleared++;
     }
+
+    const auto& held = m_held.find(item.first);
+
+    if (held != m_held.end()) {
+      held->second.m_ackedSeqNum = -1;
+    }
   }
 
   return cleared;
@@ -22,6 +22,7 @@
 
 #include <functional>
 #include <memory>
+#include <set>
 #include <unordered_map>
 #include <vector>
 #include <utility>
@@ -67,8 +68,22 @@ class CPPCACHE_EXPORT EventIdMap {
                              dereference_equal_to<EventSourcePtr>>
       map_type;
 
+  // the events of a source put with a hold and not yet released, and the
+  // sequence number up to which getUnAcked() last acked the source
+  struct HeldEvents {
+    HeldEvents() : m_ackedSeqNum(-1) {}
+    std::multiset<int64_t> m_seqNums;
+    int64_t m_ackedSeqNum;
+  };
+
+  typedef std::unordered_map<EventSourcePtr, HeldEvents,
+                             dereference_hash<EventSourcePtr>,
+                             dereference_equal_to<EventSourcePtr>>
+      hold_map_type;
+
   int32_t m_expiry;
   map_type m_map;
+  hold_map_type m_held;
   ACE_Recursive_Thread_Mutex m_lock;
 
   // hidden
@@ -96,9 +111,16 @@ class CPPCACHE_EXPORT EventIdMap {
   /** Put an item and return true if it is new or false if it existed and was
    * updated
    * @param onlynew Only put if the sequence id does not exist or is higher
+   * @param hold If the item is put, getUnAcked() acks its source only up to
+   * the event before it until release() is called for it
    * @return true if the entry was updated or inserted otherwise false
    */
-  bool put(EventSourcePtr key, EventSequencePtr value, bool onlynew = false);
+  bool put(EventSourcePtr key, EventSequencePtr value, bool onlynew = false,
+           bool hold = false);
+
+  /** Release the hold taken by put() on the event of the source with the
+   * given sequence number */
+  void release(EventSourcePtr key, int64_t seqNum);
 
   /** Update the deadline for the entry
    * @return true if the entry exists else false
@@ -110,8 +132,10 @@ class CPPCACHE_EXPORT EventIdMap {
    */
   bool remove(EventSourcePtr key);
 
-  /** Collect all map entries who acked flag is false and set their acked flags
-   * to true */
+  /** Collect all map entries who acked flag is false and set their acked
+   * flags to true. A source with held events is collected with the sequence
+   * number before its earliest held event instead, if not acked up to it
+   * yet, and its acked flag stays false. */
   EventIdMapEntryList getUnAcked();
 
   /** Clear all acked flags in the list and return the number of entries cleared
@@ -21,6 +21,8 @@
 #include "RegionInternal.hpp"
 #include <geode/DistributedSystem.hpp>
 #include "ReadWriteLock.hpp"
+#include <algorithm>
+#include <cmath>
 #include <string>
 
 namespace apache {
@@ -29,20 +31,27 @@ namespace client {
 
 const char* EvictionController::NC_EC_Thread = "NC EC Thread";
 EvictionController::EvictionController(size_t maxHeapSize,
-                                       int32_t heapSizeDelta, CacheImpl* cache)
+                                       int32_t heapSizeDelta,
+                                       const char* heapAccounting,
+                                       CacheImpl* cache)
     : m_run(false),
       m_maxHeapSize(maxHeapSize * 1024 * 1024),
       m_heapSizeDelta(heapSizeDelta),
       m_cacheImpl(cache),
-      m_currentHeapSize(0) {
+      m_currentHeapSize(0),
+      m_heapScale(1 << HEAP_SCALE_SHIFT) {
   evictionThreadPtr = new EvictionThread(this);
+  m_accountant = HeapAccountant::create(heapAccounting);
   LOGINFO("Maximum heap size for Heap LRU set to %ld bytes", m_maxHeapSize);
   //  m_currentHeapSize =
   //  DistributedSystem::getSystemProperties()->gfHighWaterMark(),
   //  DistributedSystem::getSystemProperties()->gfMessageSize();
 }
 
-EvictionController::~EvictionController() { GF_SAFE_DELETE(evictionThreadPtr); }
+EvictionController::~EvictionController() {
+  GF_SAFE_DELETE(evictionThreadPtr);
+  GF_SAFE_DELETE(m_accountant);
+}
 
 void EvictionController::updateRegionHeapInfo(int64_t info) {
   // LOGINFO("updateRegionHeapInfo is %d", info);
@@ -57,7 +66,8 @@ int EvictionController::svc() {
   while (m_run) {
     int64_t readInfo = 0;
     readInfo = m_queue.get(1500);
-    if (readInfo == 0) continue;
+    // a sampling accountant may find the heap grown without any report
+    if (readInfo == 0 && !m_accountant->samples()) continue;
 
     processHeapInfo(readInfo, pendingEvictions);
   }
@@ -79,12 +89,17 @@ void EvictionController::processHeapInfo(int64_t& readInfo,
   // are attributed to evictions that were triggered by the
   // EvictionController
   int64_t sizeToCompare = 0;
+  int64_t reportedSize = 0;
   if (readInfo < 0 && pendingEvictions > 0) {
     pendingEvictions += readInfo;
     if (pendingEvictions < 0) pendingEvictions = 0;
     return;  // as long as you are still evicting, don't do the rest of the work
   } else {
-    sizeToCompare = m_currentHeapSize - pendingEvictions;
+    reportedSize = m_currentHeapSize - pendingEvictions;
+    sizeToCompare = m_accountant->heapSize(reportedSize);
+    if (reportedSize > 0) {
+      m_heapScale = (sizeToCompare << HEAP_SCALE_SHIFT) / reportedSize;
+    }
   }
 
   if (sizeToCompare > m_maxHeapSize) {
@@ -101,11 +116,11 @@ void EvictionController::processHeapInfo(int64_t& readInfo,
     // need to evict
     int32_t evictionPercentage =
         static_cast<int32_t>(percentage + m_heapSizeDelta);
-    int32_t bytesToEvict =
-        static_cast<int32_t>((sizeToCompare * evictionPercentage) / 100);
-    pendingEvictions += bytesToEvict;
     if (evictionPercentage > 100) evictionPercentage = 100;
-    orderEvictions(evictionPercentage);
+    // in reported bytes, which is what regions take off when they evict
+    int64_t bytesToEvict = (reportedSize * evictionPercentage) / 100;
+    pendingEvictions += bytesToEvict;
+    orderEvictions(bytesToEvict);
   }
 }
 
@@ -132,11 +147,11 @@ void EvictionController::deregisterRegion(std::string& name) {
   }
 }
 
-void EvictionController::orderEvictions(int32_t percentage) {
-  evictionThreadPtr->putEvictionInfo(percentage);
+void EvictionController::orderEvictions(int64_t bytesToEvict) {
+  evictionThreadPtr->putEvictionInfo(bytesToEvict);
 }
 
-void EvictionController::evict(int32_t percentage) {
+void EvictionController::evict(int64_t bytesToEvict) {
   // TODO:  Shouldn't we take the CacheImpl::m_regions
   // lock here? Otherwise we might invoke eviction on a region
   // that has been destroyed or is being destroyed.
@@ -153,16 +168,70 @@ void EvictionController::evict(int32_t percentage) {
     }
   }
 
+  std::vector<RegionInternal*> regions;
+  // keeps the regions alive while they evict
+  std::vector<RegionPtr> regionPtrs;
+  std::vector<std::string> names;
+  std::vector<int64_t> sizes;
+  std::vector<uint32_t> accesses;
+  std::map<std::string, uint32_t> lastAccesses;
+  int64_t totalSize = 0;
+  double totalAccesses = 0;
   for (size_t i = 0; i < regionTmpVector.size(); i++) {
     std::string str = regionTmpVector.at(i);
     RegionPtr rptr;
     m_cacheImpl->getRegion(str.c_str(), rptr);
-    if (rptr != nullptr) {
-      RegionInternal* rimpl = dynamic_cast<RegionInternal*>(rptr.get());
-      if (rimpl != nullptr) {
-        rimpl->evict(percentage);
-      }
+    if (rptr == nullptr) continue;
+    RegionInternal* rimpl = dynamic_cast<RegionInternal*>(rptr.get());
+    if (rimpl == nullptr) continue;
+    uint32_t regionAccesses = rimpl->getRegionStats()->getAccesses();
+    lastAccesses[str] = regionAccesses;
+    std::map<std::string, uint32_t>::iterator last = m_lastAccesses.find(str);
+    if (last != m_lastAccesses.end()) {
+      // unsigned difference copes with the counters wrapping around
+      regionAccesses -= last->second;
     }
+    int64_t size = rimpl->getHeapLRUSize();
+    if (size <= 0) continue;
+    regions.push_back(rimpl);
+    regionPtrs.push_back(rptr);
+    names.push_back(str);
+    sizes.push_back(size);
+    accesses.push_back(regionAccesses);
+    totalSize += size;
+    totalAccesses += regionAccesses;
+  }
+  // forget the regions that are gone
+  m_lastAccesses.swap(lastAccesses);
+  if (regions.empty()) return;
+
+  // Every region may keep a share of what remains after eviction in
+  // proportion to its accesses (plus one, so idle regions are not emptied
+  // outright); what it holds beyond its share is its excess. The bytes to
+  // evict are taken from the regions in proportion to their excess.
+  double retained =
+      static_cast<double>(std::max<int64_t>(totalSize - bytesToEvict, 0));
+  double shares = totalAccesses + static_cast<double>(regions.size());
+  std::vector<double> excess(regions.size());
+  double totalExcess = 0;
+  for (size_t i = 0; i < regions.size(); i++) {
+    double share = retained * (accesses[i] + 1.0) / shares;
+    excess[i] = std::max(static_cast<double>(sizes[i]) - share, 0.0);
+    totalExcess += excess[i];
+  }
+  if (totalExcess <= 0) return;
+  for (size_t i = 0; i < regions.size(); i++) {
+    if (excess[i] <= 0) continue;
+    double regionBytes =
+        static_cast<double>(bytesToEvict) * excess[i] / totalExcess;
+    int32_t percentage = static_cast<int32_t>(
+        std::min(std::ceil(regionBytes * 100 / sizes[i]), 100.0));
+    LOGFINE(
+        "Heap LRU evicting %d percent of region %s holding %lld bytes with "
+        "%u accesses since the last eviction",
+        percentage, names[i].c_str(),
+        static_cast<long long>(sizes[i]), accesses[i]);
+    regions[i]->evict(percentage);
   }
 }
 }  // namespace client
@@ -27,9 +27,12 @@
 #include <ace/Task.h>
 #include <geode/DataOutput.hpp>
 #include <geode/Log.hpp>
+#include <atomic>
+#include <map>
 #include <memory>
 #include "IntQueue.hpp"
 #include "EvictionThread.hpp"
+#include "HeapAccountant.hpp"
 #include <string>
 #include <vector>
 
@@ -39,20 +42,20 @@
  * system registers with the EvictionController. Everytime there is any
  * activity that changes the memory usage in the region, it puts a message
  * into a queue that the EvictionController waits on. The message contains
- * the full region name, the total size of the region (inclusive of keys and
- * values) and the total number of entries.The EvictionController thread picks
- * up the message, updates the total memory size as well as the size of the
- * region in question. It determines whether memory usage is within limits.
+ * the change in the size of the region (inclusive of keys and values). The
+ * EvictionController thread picks up the message and updates the total
+ * reported size, which its HeapAccountant turns into an estimate of the heap
+ * in use. It determines whether memory usage is within limits.
  * If so, it goes back to waiting on the queue. If memory usage is out of bounds
  * it does the following.
  *  1> Figures out the delta between specified and actual
- *  2> Determines the size percentage that needs to be evicted
- *  3> Determines the nmber of entries per region (based on size per entry) that
-       needs to be evicted. This is a slice of the total eviction that is
- needed.
-    4> Invokes a method on each region to trigger eviction of entries.The evict
-       method on the region will return the total size evicted for the entries.
-    5> Goes back and checks queue size and recalculates the heap size usage
+ *  2> Determines the number of bytes that need to be evicted
+ *  3> Shares what is to be left after eviction among the regions in
+ *     proportion to how often each was accessed since the last eviction, and
+ *     takes the bytes to evict from the regions holding more than their share
+ *  4> Invokes a method on each of those regions to evict the percentage of
+ *     its entries that matches its part of the bytes
+ *  5> Goes back and checks queue size and recalculates the heap size usage
  *
  *
  * When a region is destroyed, it deregisters itself with the EvictionController
@@ -73,7 +76,7 @@ typedef std::shared_ptr<EvictionController> EvictionControllerPtr;
 class CPPCACHE_EXPORT EvictionController : public ACE_Task_Base {
  public:
   EvictionController(size_t maxHeapSize, int32_t heapSizeDelta,
-                     CacheImpl* cache);
+                     const char* heapAccounting, CacheImpl* cache);
 
   ~EvictionController();
 
@@ -99,10 +102,22 @@ class CPPCACHE_EXPORT EvictionController : public ACE_Task_Base {
   void updateRegionHeapInfo(int64_t info);
   void registerRegion(std::string& name);
   void deregisterRegion(std::string& name);
-  void evict(int32_t percentage);
+  void evict(int64_t bytesToEvict);
+
+  /**
+   * Returns the estimated heap held by entries whose reported size is given,
+   * as of the last time the controller checked the heap.
+   */
+  inline int64_t estimatedSize(int64_t reportedSize) const {
+    return (reportedSize * m_heapScale.load(std::memory_order_relaxed)) >>
+           HEAP_SCALE_SHIFT;
+  }
 
  private:
-  void orderEvictions(int32_t percentage);
+  // fixed point fraction bits of m_heapScale
+  static const int HEAP_SCALE_SHIFT = 10;
+
+  void orderEvictions(int64_t bytesToEvict);
   void processHeapInfo(int64_t& readInfo, int64_t& pendingEvictions);
 
  private:
@@ -115,6 +130,11 @@ class CPPCACHE_EXPORT EvictionController : public ACE_Task_Base {
   VectorOfString m_regions;
   mutable ACE_RW_Thread_Mutex m_regionLock;
   EvictionThread* evictionThreadPtr;
+  HeapAccountant* m_accountant;
+  // estimated heap per reported byte
+  std::atomic<int64_t> m_heapScale;
+  // gets and puts of each region at the last eviction; eviction thread only
+  std::map<std::string, uint32_t> m_lastAccesses;
   static const char* NC_EC_Thread;
 };
 }  // namespace client
@@ -40,11 +40,12 @@ int EvictionThread::svc(void) {
 }
 
 void EvictionThread::processEvictions() {
-  int32_t percentageToEvict = 0;
-  percentageToEvict = static_cast<int32_t>(m_queue.get(1500));
-  if (percentageToEvict != 0) {
-    m_pParent->evict(percentageToEvict);
+  int64_t bytesToEvict = m_queue.get(1500);
+  if (bytesToEvict != 0) {
+    m_pParent->evict(bytesToEvict);
   }
 }
 
-void EvictionThread::putEvictionInfo(int32_t info) { m_queue.put(info); }
+void EvictionThread::putEvictionInfo(int64_t bytesToEvict) {
+  m_queue.put(bytesToEvict);
+}
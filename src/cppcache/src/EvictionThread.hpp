@@ -55,7 +55,7 @@ class CPPCACHE_EXPORT EvictionThread : public ACE_Task_Base {
   }
 
   int svc();
-  void putEvictionInfo(int32_t info);
+  void putEvictionInfo(int64_t bytesToEvict);
   void processEvictions();
 
  private:
@@ -34,7 +34,11 @@ using namespace apache::geode::client;
 
 const char* ExpiryTaskManager::NC_ETM_Thread = "NC ETM Thread";
 
-ExpiryTaskManager::ExpiryTaskManager() : m_reactorEventLoopRunning(false) {
+ExpiryTaskManager::ExpiryTaskManager()
+    : m_reactorEventLoopRunning(false),
+      m_wheelStartTime(ACE_OS::gettimeofday()),
+      m_wheelTickHandler(new WheelTickHandler(*this)),
+      m_wheelTicking(false) {
 #if defined(_WIN32)
   m_reactor = new ACE_Reactor(
       new ACE_WFMO_Reactor(nullptr, new GF_Timer_Heap_ImmediateReset()), 1);
@@ -73,15 +77,166 @@ long ExpiryTaskManager::scheduleExpiryTask(ACE_Event_Handler* handler,
   return m_reactor->schedule_timer(handler, 0, expTimeValue, intervalVal);
 }
 
+ExpiryTaskManager::id_type ExpiryTaskManager::scheduleWheelExpiryTask(
+    ACE_Event_Handler* handler, uint32_t expTime) {
+  WheelTask task;
+  task.m_handler = handler;
+  task.m_deleteHandler = true;
+  return scheduleWheelTask(task, expTime);
+}
+
+ExpiryTaskManager::id_type ExpiryTaskManager::scheduleWheelExpiryTask(
+    const std::shared_ptr<ACE_Event_Handler>& handler,
+    const std::shared_ptr<void>& arg, uint32_t expTime) {
+  WheelTask task;
+  task.m_handler = handler.get();
+  task.m_sharedHandler = handler;
+  task.m_arg = arg;
+  return scheduleWheelTask(task, expTime);
+}
+
+ExpiryTaskManager::id_type ExpiryTaskManager::scheduleWheelTask(
+    WheelTask& task, uint32_t expTime) {
+  ACE_Time_Value expiry(ACE_OS::gettimeofday() + ACE_Time_Value(expTime));
+  uint64_t tick = toWheelTick(expiry, true);
+  bool startTicking = false;
+  int32_t index;
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(m_wheelLock);
+    // the tick timer is started by the first wheel task so that a client
+    // without expiration does not wake up every tick
+    if (!m_wheelTicking) {
+      m_wheelTicking = true;
+      startTicking = true;
+    }
+    index = m_wheel.add(task);
+    m_wheel.schedule(index, tick);
+  }
+  if (startTicking) {
+    // not under m_wheelLock which the tick handler takes while the reactor
+    // may hold its timer queue lock
+    ACE_Time_Value tickInterval;
+    tickInterval.msec(WHEEL_TICK_MSEC);
+    m_reactor->schedule_timer(m_wheelTickHandler, 0, tickInterval,
+                              tickInterval);
+    LOGFINE("ExpiryTaskManager: started timer wheel with %d ms ticks",
+            WHEEL_TICK_MSEC);
+  }
+  return WHEEL_TASK_ID_BASE + index;
+}
+
+uint64_t ExpiryTaskManager::toWheelTick(const ACE_Time_Value& time,
+                                        bool roundUp) const {
+  if (time <= m_wheelStartTime) {
+    return 0;
+  }
+  ACE_Time_Value elapsed(time - m_wheelStartTime);
+  uint64_t usec = static_cast<uint64_t>(elapsed.sec()) * 1000000 +
+                  static_cast<uint64_t>(elapsed.usec());
+  uint64_t tickUsec = static_cast<uint64_t>(WHEEL_TICK_MSEC) * 1000;
+  return roundUp ? (usec + tickUsec - 1) / tickUsec : usec / tickUsec;
+}
+
 int ExpiryTaskManager::resetTask(ExpiryTaskManager::id_type id, uint32_t sec) {
+  if (id >= WHEEL_TASK_ID_BASE) {
+    return resetWheelTask(id, sec);
+  }
   ACE_Time_Value interval(sec);
   return m_reactor->reset_timer_interval(id, interval);
 }
 
 int ExpiryTaskManager::cancelTask(ExpiryTaskManager::id_type id) {
+  if (id >= WHEEL_TASK_ID_BASE) {
+    return cancelWheelTask(id);
+  }
   return m_reactor->cancel_timer(id, 0, 0);
 }
 
+int ExpiryTaskManager::resetWheelTask(ExpiryTaskManager::id_type id,
+                                      uint32_t sec) {
+  int32_t index = static_cast<int32_t>(id - WHEEL_TASK_ID_BASE);
+  ACE_Guard<ACE_Thread_Mutex> guard(m_wheelLock);
+  if (!m_wheel.contains(index)) {
+    return -1;
+  }
+  // as with the timer heap only the interval changes; it takes effect when
+  // the task expires next
+  m_wheel.payload(index).m_interval = sec;
+  return 0;
+}
+
+int ExpiryTaskManager::cancelWheelTask(ExpiryTaskManager::id_type id) {
+  int32_t index = static_cast<int32_t>(id - WHEEL_TASK_ID_BASE);
+  WheelTask task;
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(m_wheelLock);
+    if (!m_wheel.contains(index)) {
+      return -1;
+    }
+    WheelTask& current = m_wheel.payload(index);
+    if (current.m_firing) {
+      // freed by the expiry thread once the upcall returns, together with
+      // a handler it owns; the caller must not touch the handler
+      current.m_cancelled = true;
+      return -1;
+    }
+    task = m_wheel.remove(index);
+  }
+  // like the timer heap a cancelled task does not delete its handler; the
+  // shared handler and arg are released here outside the lock
+  return 0;
+}
+
+void ExpiryTaskManager::expireWheelTasks(const ACE_Time_Value& currentTime) {
+  std::vector<WheelTask> dispatched;
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(m_wheelLock);
+    m_dueTasks.clear();
+    m_wheel.advance(toWheelTick(currentTime, false), m_dueTasks);
+    if (m_dueTasks.empty()) {
+      return;
+    }
+    dispatched.reserve(m_dueTasks.size());
+    for (auto index : m_dueTasks) {
+      WheelTask& task = m_wheel.payload(index);
+      task.m_firing = true;
+      dispatched.push_back(task);
+    }
+  }
+  LOGFINER("ExpiryTaskManager: expiring %d timer wheel tasks",
+           static_cast<int>(dispatched.size()));
+
+  for (auto& task : dispatched) {
+    task.m_handler->handle_timeout(currentTime, task.m_arg.get());
+  }
+
+  // reschedule or free the whole batch under one lock acquisition, leaving
+  // the deletes and the release of shared handlers to after it
+  std::vector<WheelTask> finished;
+  ACE_Time_Value now(ACE_OS::gettimeofday());
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(m_wheelLock);
+    for (auto index : m_dueTasks) {
+      WheelTask& task = m_wheel.payload(index);
+      task.m_firing = false;
+      if (task.m_cancelled) {
+        finished.push_back(m_wheel.remove(index));
+      } else if (task.m_interval > 0) {
+        m_wheel.schedule(
+            index, toWheelTick(now + ACE_Time_Value(task.m_interval), true));
+      } else {
+        finished.push_back(m_wheel.remove(index));
+      }
+    }
+  }
+  dispatched.clear();
+  for (auto& task : finished) {
+    if (task.m_deleteHandler) {
+      delete task.m_handler;
+    }
+  }
+}
+
 int ExpiryTaskManager::svc() {
   DistributedSystemImpl::setThreadName(NC_ETM_Thread);
   LOGFINE("ExpiryTaskManager thread is running.");
@@ -99,6 +254,24 @@ void ExpiryTaskManager::stopExpiryTaskManager() {
     GF_D_ASSERT(m_reactor->reactor_event_loop_done() > 0);
     m_reactorEventLoopRunning = false;
   }
+  // no task runs any more, so the tick timer goes and the tasks left on the
+  // wheel are freed as if they had expired
+  m_reactor->cancel_timer(m_wheelTickHandler, 1);
+  std::vector<WheelTask> remaining;
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(m_wheelLock);
+    m_wheelTicking = false;
+    m_wheel.clear(remaining);
+  }
+  if (!remaining.empty()) {
+    LOGFINE("ExpiryTaskManager: freeing %d timer wheel tasks left",
+            static_cast<int>(remaining.size()));
+  }
+  for (auto& task : remaining) {
+    if (task.m_deleteHandler) {
+      delete task.m_handler;
+    }
+  }
 }
 
 void ExpiryTaskManager::begin() {
@@ -114,4 +287,6 @@ ExpiryTaskManager::~ExpiryTaskManager() {
   stopExpiryTaskManager();
   delete m_reactor;
   m_reactor = nullptr;
+  delete m_wheelTickHandler;
+  m_wheelTickHandler = nullptr;
 }
@@ -22,7 +22,11 @@
 #include <ace/Reactor.h>
 #include <ace/Task.h>
 #include <ace/Timer_Heap.h>
+#include <ace/Thread_Mutex.h>
+#include <memory>
+#include <vector>
 #include "ReadWriteLock.hpp"
+#include "TimerWheel.hpp"
 
 #include <geode/geode_globals.hpp>
 #include <geode/Log.hpp>
@@ -234,6 +238,26 @@ class CPPCACHE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
                           ACE_Time_Value intervalVal,
                           bool cancelExistingTask = false);
 
+  /**
+   * For scheduling a task on the timer wheel instead of the reactor's timer
+   * heap. Scheduling, resetting and cancelling are constant time and the
+   * tasks due in a tick are expired in one batch. The expiry time is rounded
+   * up to the wheel's tick of WHEEL_TICK_MSEC. As with scheduleExpiryTask
+   * the handler is deleted once it expires with a zero interval.
+   */
+  id_type scheduleWheelExpiryTask(ACE_Event_Handler* handler,
+                                  uint32_t expTime);
+
+  /**
+   * For scheduling a task on the timer wheel with a handler shared by many
+   * tasks. The handler gets the object pointed to by arg in handle_timeout;
+   * both are kept alive by the task until it is cancelled or expires with a
+   * zero interval.
+   */
+  id_type scheduleWheelExpiryTask(
+      const std::shared_ptr<ACE_Event_Handler>& handler,
+      const std::shared_ptr<void>& arg, uint32_t expTime);
+
   /**
    * for resetting the interval an already registered task.
    * returns '0' if successful '-1' on failure.
@@ -246,6 +270,9 @@ class CPPCACHE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
    * for cancelling an already registered task.
    * returns '0' if successful '-1' on failure.
    * id - the id assigned to the expiry task initially.
+   * A timer wheel task cancelled while its handler runs returns '-1': it
+   * is freed once the handler returns, deleting the handler if the task
+   * was scheduled to. Only after a '0' does the caller own the handler.
    */
   int cancelTask(id_type id);
   /**
@@ -255,7 +282,9 @@ class CPPCACHE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
    */
   int svc();
   /**
-   * For explicitly stopping the reactor's event loop.
+   * For explicitly stopping the reactor's event loop. Tasks still on the
+   * timer wheel are freed, deleting their handlers as if they had expired,
+   * and cancelling them afterwards fails.
    */
   void stopExpiryTaskManager();
 
@@ -263,12 +292,60 @@ class CPPCACHE_EXPORT ExpiryTaskManager : public ACE_Task_Base {
   void begin();
 
  private:
+  /** Ids of timer wheel tasks start here, below are the reactor's. */
+  static const id_type WHEEL_TASK_ID_BASE = 0x40000000;
+  /** Length of a timer wheel tick. */
+  static const int WHEEL_TICK_MSEC = 100;
+
+  struct WheelTask {
+    WheelTask()
+        : m_handler(nullptr),
+          m_interval(0),
+          m_deleteHandler(false),
+          m_firing(false),
+          m_cancelled(false) {}
+    ACE_Event_Handler* m_handler;
+    std::shared_ptr<ACE_Event_Handler> m_sharedHandler;
+    std::shared_ptr<void> m_arg;
+    uint32_t m_interval;
+    bool m_deleteHandler;
+    bool m_firing;
+    bool m_cancelled;
+  };
+
+  /** Reactor timer that moves the timer wheel forward every tick. */
+  class WheelTickHandler : public ACE_Event_Handler {
+   public:
+    explicit WheelTickHandler(ExpiryTaskManager& manager)
+        : m_manager(manager) {}
+    int handle_timeout(const ACE_Time_Value& current_time, const void* arg) {
+      m_manager.expireWheelTasks(current_time);
+      return 0;
+    }
+
+   private:
+    ExpiryTaskManager& m_manager;
+  };
+
+  id_type scheduleWheelTask(WheelTask& task, uint32_t expTime);
+  int resetWheelTask(id_type id, uint32_t sec);
+  int cancelWheelTask(id_type id);
+  void expireWheelTasks(const ACE_Time_Value& currentTime);
+  // the wheel tick the given time falls in, or the next one if rounding up
+  uint64_t toWheelTick(const ACE_Time_Value& time, bool roundUp) const;
+
   ACE_Reactor* m_reactor;
 
   bool m_reactorEventLoopRunning;  // flag to indicate if the reactor event
                                    // loop is running or not.
   ACE_Recursive_Thread_Mutex m_taskLock;  // to synchronize scheduling
                                           // of expiry tasks.
+  TimerWheel<WheelTask> m_wheel;
+  ACE_Thread_Mutex m_wheelLock;  // guards m_wheel and its tasks
+  ACE_Time_Value m_wheelStartTime;
+  WheelTickHandler* m_wheelTickHandler;
+  bool m_wheelTicking;
+  std::vector<int32_t> m_dueTasks;  // used by the expiry thread only
   static const char* NC_ETM_Thread;
 };
 }  // namespace client
@@ -152,9 +152,10 @@ class FairQueue {
     ACE_Guard<MUTEX> _guard1(m_queueLock);
 
     if (!m_closed) {
-      do {
-        m_cond.wait(&stopAt);
-        mp = popFromQueue(isClosed);
+      // an item may have been put between the caller's unlocked attempt and
+      // acquiring the lock, in which case its signal has already been missed
+      mp = popFromQueue(isClosed);
+      while (true) {
         if (mp && excludeList) {
           if (exclude(mp, excludeList)) {
             mp->close();
@@ -162,8 +163,13 @@ class FairQueue {
             deleteAction();
           }
         }
-      } while (mp == nullptr && (currTime = ACE_OS::gettimeofday()) < stopAt &&
-               !isClosed);
+        if (mp != nullptr || isClosed ||
+            (currTime = ACE_OS::gettimeofday()) >= stopAt) {
+          break;
+        }
+        m_cond.wait(&stopAt);
+        mp = popFromQueue(isClosed);
+      }
       sec = (stopAt - currTime).sec();
     }
 
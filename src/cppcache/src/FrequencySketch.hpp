@@ -0,0 +1,156 @@
+#pragma once
+
+#ifndef GEODE_FREQUENCYSKETCH_H_
+#define GEODE_FREQUENCYSKETCH_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @file FrequencySketch.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class FrequencySketch FrequencySketch.hpp
+ *
+ * Approximate access frequency of keys for the TinyLFU admission filter of
+ * LRUEntriesMap. It is a count-min sketch of four bit counters packed
+ * sixteen to a word; a key has one counter in each of four words and its
+ * frequency is the smallest of them. Once the number of recorded accesses
+ * reaches ten times the capacity all counters are halved, so the sketch
+ * follows changes in popularity.
+ *
+ * Counters are updated with relaxed atomic operations; concurrent updates
+ * are never lost but halving may race with them, which only makes the
+ * estimate slightly less exact.
+ */
+class FrequencySketch {
+ public:
+  /** Sizes the sketch for about the given number of hot keys. */
+  explicit FrequencySketch(uint32_t capacity)
+      : m_size(tableSize(capacity)),
+        m_table(new std::atomic<uint64_t>[m_size]),
+        m_sampleSize(10 * static_cast<int64_t>(std::max(capacity, 1u))),
+        m_additions(0) {
+    for (uint32_t index = 0; index < m_size; ++index) {
+      m_table[index].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /** Records an access to the key with the given hash code. */
+  void increment(uint32_t hash) {
+    hash = spread(hash);
+    uint32_t start = (hash & 3) << 2;
+    bool added = false;
+    for (uint32_t i = 0; i < 4; ++i) {
+      added |= incrementAt(indexOf(hash, i), start + i);
+    }
+    // exactly one thread sees the count reach the sample size
+    if (added && ++m_additions == m_sampleSize) {
+      reset();
+    }
+  }
+
+  /** Returns the estimated number of accesses, at most 15. */
+  uint32_t frequency(uint32_t hash) const {
+    hash = spread(hash);
+    uint32_t start = (hash & 3) << 2;
+    uint32_t frequency = 15;
+    for (uint32_t i = 0; i < 4; ++i) {
+      uint64_t word =
+          m_table[indexOf(hash, i)].load(std::memory_order_relaxed);
+      uint32_t count = static_cast<uint32_t>(word >> ((start + i) << 2)) & 15;
+      frequency = std::min(frequency, count);
+    }
+    return frequency;
+  }
+
+ private:
+  static uint32_t tableSize(uint32_t capacity) {
+    uint32_t size = 64;
+    while (size < capacity && size < (1u << 24)) {
+      size <<= 1;
+    }
+    return size;
+  }
+
+  static uint32_t spread(uint32_t hash) {
+    hash = ((hash >> 16) ^ hash) * 0x45d9f3b;
+    hash = ((hash >> 16) ^ hash) * 0x45d9f3b;
+    return (hash >> 16) ^ hash;
+  }
+
+  uint32_t indexOf(uint32_t hash, uint32_t i) const {
+    static const uint64_t SEEDS[] = {0xc3a5c85c97cb3127ULL,
+                                     0xb492b66fbe98f273ULL,
+                                     0x9ae16a3b2f90404fULL,
+                                     0xcbf29ce484222325ULL};
+    uint64_t h = (hash + SEEDS[i]) * SEEDS[i];
+    h += h >> 32;
+    return static_cast<uint32_t>(h) & (m_size - 1);
+  }
+
+  // Increments the counter at the nibble of the word unless it is at its
+  // maximum; returns whether it was incremented.
+  bool incrementAt(uint32_t index, uint32_t nibble) {
+    uint32_t shift = nibble << 2;
+    uint64_t one = static_cast<uint64_t>(1) << shift;
+    uint64_t mask = 15 * one;
+    std::atomic<uint64_t>& slot = m_table[index];
+    uint64_t word = slot.load(std::memory_order_relaxed);
+    while ((word & mask) != mask) {
+      if (slot.compare_exchange_weak(word, word + one,
+                                     std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void reset() {
+    for (uint32_t index = 0; index < m_size; ++index) {
+      uint64_t word = m_table[index].load(std::memory_order_relaxed);
+      while (!m_table[index].compare_exchange_weak(
+          word, (word >> 1) & 0x7777777777777777ULL,
+          std::memory_order_relaxed)) {
+      }
+    }
+    m_additions -= m_sampleSize / 2;
+  }
+
+  const uint32_t m_size;
+  std::unique_ptr<std::atomic<uint64_t>[]> m_table;
+  const int64_t m_sampleSize;
+  std::atomic<int64_t> m_additions;
+
+  FrequencySketch(const FrequencySketch&);
+  FrequencySketch& operator=(const FrequencySketch&);
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_FREQUENCYSKETCH_H_
@@ -0,0 +1,63 @@
+#pragma once
+
+#ifndef GEODE_GETALLBATCHES_H_
+#define GEODE_GETALLBATCHES_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <geode/VectorT.hpp>
+
+/**
+ * @file GetAllBatches.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Splits the keys a getAll sends to one server into the batches of at most
+ * batchSize keys that go out as separate GET_ALL requests. A batch size
+ * that is not positive, or no smaller than the number of keys, leaves the
+ * keys in a single batch that shares the given vector.
+ */
+inline std::vector<VectorOfCacheableKeyPtr> splitGetAllBatches(
+    const VectorOfCacheableKeyPtr& keys, int batchSize) {
+  std::vector<VectorOfCacheableKeyPtr> batches;
+  if (batchSize <= 0 || static_cast<size_t>(batchSize) >= keys->size()) {
+    batches.push_back(keys);
+    return batches;
+  }
+  size_t step = static_cast<size_t>(batchSize);
+  for (size_t start = 0; start < keys->size(); start += step) {
+    size_t end = std::min(start + step, keys->size());
+    batches.push_back(std::make_shared<VectorOfCacheableKey>(
+        keys->begin() + start, keys->begin() + end));
+  }
+  return batches;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_GETALLBATCHES_H_
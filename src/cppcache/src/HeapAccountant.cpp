@@ -0,0 +1,74 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HeapAccountant.hpp"
+
+#include <geode/Log.hpp>
+
+#include <cstring>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+// mallinfo walks the free lists of every arena, so it is not called often
+const std::chrono::seconds AllocatorSampleInterval(1);
+}  // namespace
+
+HeapAccountant* HeapAccountant::create(const char* name) {
+  if (name != nullptr && std::strcmp(name, "allocator") == 0) {
+    if (allocatorInUse() >= 0) {
+      LOGFINE("Heap LRU samples the memory allocator");
+      return new AllocatorAccountant(allocatorInUse,
+                                     AllocatorSampleInterval);
+    }
+    LOGWARN(
+        "heap-lru-accounting=allocator is not supported on this platform; "
+        "using object sizes");
+  }
+  return new ObjectSizeAccountant();
+}
+
+int64_t HeapAccountant::allocatorInUse() {
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 33)
+  struct mallinfo2 info = mallinfo2();
+#else
+  // the fields are int and wrap beyond 2GB of allocations
+  struct mallinfo info = mallinfo();
+#endif
+  // small blocks from the arenas plus blocks mapped on their own
+  return static_cast<int64_t>(info.uordblks) +
+         static_cast<int64_t>(info.hblkhd);
+#elif defined(__APPLE__)
+  malloc_statistics_t stats;
+  malloc_zone_statistics(nullptr, &stats);
+  return static_cast<int64_t>(stats.size_in_use);
+#else
+  return -1;
+#endif
+}
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,138 @@
+#pragma once
+
+#ifndef GEODE_HEAPACCOUNTANT_H_
+#define GEODE_HEAPACCOUNTANT_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/geode_globals.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @file HeapAccountant.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class HeapAccountant HeapAccountant.hpp
+ *
+ * Tells the EvictionController how much heap the cache uses. The regions
+ * report the sizes of their keys and values as they change; an accountant
+ * turns the sum of those reported sizes into the estimate that is held
+ * against heap-lru-limit. The implementation is chosen with the
+ * heap-lru-accounting system property.
+ */
+class CPPCACHE_EXPORT HeapAccountant {
+ public:
+  virtual ~HeapAccountant() {}
+
+  /**
+   * Returns the estimated bytes of heap held by the cache given the sum of
+   * the sizes reported by the heap LRU regions. Only called by the eviction
+   * controller thread.
+   */
+  virtual int64_t heapSize(int64_t reportedSize) = 0;
+
+  /**
+   * Returns true if the estimate can change while the reported size does
+   * not, so that it is worth checking even when no region reports.
+   */
+  virtual bool samples() const = 0;
+
+  /**
+   * Creates the accountant with the given heap-lru-accounting name, falling
+   * back to object sizes where the allocator cannot be sampled.
+   */
+  static HeapAccountant* create(const char* name);
+
+  /**
+   * Returns the bytes the memory allocator has handed out and not yet got
+   * back, or -1 if the platform offers no way to find out.
+   */
+  static int64_t allocatorInUse();
+};
+
+/**
+ * Takes the sizes reported by keys and values, through their objectSize,
+ * at face value.
+ */
+class CPPCACHE_EXPORT ObjectSizeAccountant : public HeapAccountant {
+ public:
+  virtual int64_t heapSize(int64_t reportedSize) { return reportedSize; }
+
+  virtual bool samples() const { return false; }
+};
+
+/**
+ * Measures the growth of the allocator's bytes in use since the cache was
+ * created, sampled at most once per interval. Between samples the reported
+ * size of whatever changed since the last one is added, so the estimate
+ * follows puts and evictions at once while sampling stays cheap. While the
+ * regions report nothing the measurement starts over, as the memory in use
+ * then is not held by entries.
+ */
+class CPPCACHE_EXPORT AllocatorAccountant : public HeapAccountant {
+ public:
+  typedef int64_t (*Sampler)();
+  typedef std::chrono::steady_clock Clock;
+
+  AllocatorAccountant(Sampler sampler, Clock::duration interval)
+      : m_sampler(sampler),
+        m_interval(interval),
+        m_baseline(sampler()),
+        m_measured(0),
+        m_reportedAtSample(0),
+        m_lastSample(Clock::now()) {}
+
+  virtual int64_t heapSize(int64_t reportedSize) {
+    Clock::time_point now = Clock::now();
+    if (now - m_lastSample >= m_interval) {
+      int64_t inUse = m_sampler();
+      if (reportedSize <= 0) {
+        m_baseline = inUse;
+      }
+      m_measured = std::max<int64_t>(inUse - m_baseline, 0);
+      m_reportedAtSample = reportedSize;
+      m_lastSample = now;
+    }
+    return std::max<int64_t>(m_measured + reportedSize - m_reportedAtSample,
+                             0);
+  }
+
+  virtual bool samples() const { return true; }
+
+ private:
+  Sampler m_sampler;
+  Clock::duration m_interval;
+  // bytes in use when the regions held nothing
+  int64_t m_baseline;
+  int64_t m_measured;
+  int64_t m_reportedAtSample;
+  Clock::time_point m_lastSample;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_HEAPACCOUNTANT_H_
@@ -0,0 +1,79 @@
+#pragma once
+
+#ifndef GEODE_INFLIGHTCOUNTER_H_
+#define GEODE_INFLIGHTCOUNTER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * @file InFlightCounter.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class InFlightCounter InFlightCounter.hpp
+ *
+ * Counts the operations that have been started but not yet completed, so
+ * that their owner can wait for the last of them before tearing down what
+ * they use.
+ */
+class InFlightCounter {
+ public:
+  InFlightCounter() : m_count(0) {}
+
+  void started() {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    ++m_count;
+  }
+
+  void completed() {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (--m_count == 0) {
+      m_none.notify_all();
+    }
+  }
+
+  /** Blocks until every started operation has completed. */
+  void waitForNone() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_none.wait(lock, [this] { return m_count == 0; });
+  }
+
+  int32_t count() {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_count;
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_none;
+  int32_t m_count;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_INFLIGHTCOUNTER_H_
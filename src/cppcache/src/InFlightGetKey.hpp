@@ -0,0 +1,63 @@
+#pragma once
+
+#ifndef GEODE_INFLIGHTGETKEY_H_
+#define GEODE_INFLIGHTGETKEY_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+
+#include <geode/CacheableKey.hpp>
+#include "UserAttributes.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Key of a get in flight in LocalRegion: the region key and, in multiuser
+ * mode, the user the value is fetched for. Gets of different users never
+ * join each other, so a user is never handed a value that was fetched with
+ * the credentials of another.
+ */
+struct InFlightGetKey {
+  InFlightGetKey(const UserAttributesPtr& user, const CacheableKeyPtr& key)
+      : m_user(user), m_key(key) {}
+
+  UserAttributesPtr m_user;
+  CacheableKeyPtr m_key;
+
+  struct Hash {
+    size_t operator()(const InFlightGetKey& key) const {
+      return std::hash<UserAttributes*>()(key.m_user.get()) * 31 +
+             static_cast<size_t>(key.m_key->hashcode());
+    }
+  };
+
+  struct Equal {
+    bool operator()(const InFlightGetKey& lhs,
+                    const InFlightGetKey& rhs) const {
+      return lhs.m_user == rhs.m_user && *lhs.m_key == *rhs.m_key;
+    }
+  };
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_INFLIGHTGETKEY_H_
@@ -69,10 +69,6 @@ bool LRUOverFlowToDiskAction::evict(const MapEntryImplPtr& mePtr) {
   }
   LRUEntryProperties& lruProps = mePtr->getLRUProperties();
   void* persistenceInfo = lruProps.getPersistenceInfo();
-  bool setInfo = false;
-  if (persistenceInfo == nullptr) {
-    setInfo = true;
-  }
   PersistenceManagerPtr pmPtr = m_regionPtr->getPersistenceManager();
   try {
     pmPtr->write(keyPtr, valuePtr, persistenceInfo);
@@ -83,9 +79,8 @@ bool LRUOverFlowToDiskAction::evict(const MapEntryImplPtr& mePtr) {
     LOGERROR("write to persistence layer failed - %s", ex.getMessage());
     return false;
   }
-  if (setInfo == true) {
-    lruProps.setPersistenceInfo(persistenceInfo);
-  }
+  // the persistence manager may have allocated or replaced the handle
+  lruProps.setPersistenceInfo(persistenceInfo);
   (m_regionPtr->getRegionStats())->incOverflows();
   (m_regionPtr->getCacheImpl())->m_cacheStats->incOverflows();
   // set value after write on disk to indicate that it is on disk.
@@ -56,14 +56,16 @@ LRUEntriesMap::LRUEntriesMap(EntryFactory* entryFactory, RegionInternal* region,
                              const LRUAction::Action& lruAction,
                              const uint32_t limit,
                              bool concurrencyChecksEnabled,
-                             const uint8_t concurrency, bool heapLRUEnabled)
+                             const uint8_t concurrency, bool heapLRUEnabled,
+                             bool admissionFilterEnabled)
     : ConcurrentEntriesMap(entryFactory, concurrencyChecksEnabled, region,
                            concurrency),
       m_lruList(),
       m_limit(limit),
       m_pmPtr(nullptr),
       m_validEntries(0),
-      m_heapLRUEnabled(heapLRUEnabled) {
+      m_heapLRUEnabled(heapLRUEnabled),
+      m_admissionFilter(nullptr) {
   m_currentMapSize = 0;
   m_action = nullptr;
   m_evictionControllerPtr = nullptr;
@@ -83,6 +85,11 @@ LRUEntriesMap::LRUEntriesMap(EntryFactory* entryFactory, RegionInternal* region,
   } else {
     m_action = new TestMapAction(this);
   }
+  if (admissionFilterEnabled) {
+    // with heap LRU the number of entries is not known up front
+    m_admissionFilter =
+        new FrequencySketch(limit != 0 ? limit : DEFAULT_ADMISSION_KEYS);
+  }
 }
 
 void LRUEntriesMap::close() {
@@ -96,9 +103,13 @@ void LRUEntriesMap::close() {
 void LRUEntriesMap::clear() {
   updateMapSize((-1 * (m_currentMapSize)));
   ConcurrentEntriesMap::clear();
+  m_lruList.clear();
 }
 
-LRUEntriesMap::~LRUEntriesMap() { delete m_action; }
+LRUEntriesMap::~LRUEntriesMap() {
+  delete m_action;
+  delete m_admissionFilter;
+}
 
 /**
  * @brief put an item in the map... if it is a new entry, then the LRU may
@@ -113,6 +124,7 @@ GfErrType LRUEntriesMap::create(const CacheableKeyPtr& key,
                                 VersionTagPtr versionTag) {
   MapSegment* segmentRPtr = segmentFor(key);
   GfErrType err = GF_NOERR;
+  recordAccess(key);
   {  // SYNCHRONIZE_SEGMENT(segmentRPtr);
     MapEntryImplPtr mePtr;
     if ((err = segmentRPtr->create(key, newValue, me, oldValue, updateCount,
@@ -146,27 +158,57 @@ GfErrType LRUEntriesMap::create(const CacheableKeyPtr& key,
     }
     updateMapSize(newSize);
   }
-  err = processLRU();
+  err = processLRU(me);
   return err;
 }
 
-GfErrType LRUEntriesMap::processLRU() {
+GfErrType LRUEntriesMap::processLRU(MapEntryImplPtr candidate) {
   GfErrType canEvict = GF_NOERR;
+  if (m_admissionFilter == nullptr) {
+    candidate = nullptr;
+  }
   while (canEvict == GF_NOERR && mustEvict()) {
-    canEvict = evictionHelper();
+    canEvict = evictionHelper(candidate);
   }
   return canEvict;
 }
 
 GfErrType LRUEntriesMap::evictionHelper() {
+  MapEntryImplPtr candidate;
+  return evictionHelper(candidate);
+}
+
+GfErrType LRUEntriesMap::evictionHelper(MapEntryImplPtr& candidate) {
   GfErrType err = GF_NOERR;
   //  ACE_Guard< ACE_Recursive_Thread_Mutex > guard( m_mutex );
   MapEntryImplPtr lruEntryPtr;
-  m_lruList.getLRUEntry(lruEntryPtr);
+  // the new entry is weighed against the victim, so it cannot be one
+  m_lruList.getLRUEntry(lruEntryPtr, candidate.get());
+  if (lruEntryPtr == nullptr && candidate != nullptr) {
+    // nothing but the new entry is left to evict
+    candidate = nullptr;
+    m_lruList.getLRUEntry(lruEntryPtr);
+  }
   if (lruEntryPtr == nullptr) {
     err = GF_ENOENT;
     return err;
   }
+  if (candidate != nullptr) {
+    // TinyLFU: a new entry whose key is not used more often than the victim
+    // is not worth keeping in its place, so it goes instead
+    CacheableKeyPtr candidateKey;
+    CacheableKeyPtr victimKey;
+    candidate->getKeyI(candidateKey);
+    lruEntryPtr->getKeyI(victimKey);
+    if (m_admissionFilter->frequency(candidateKey->hashcode()) <=
+        m_admissionFilter->frequency(victimKey->hashcode())) {
+      m_lruList.prependEntry(lruEntryPtr);
+      m_lruList.removeEntry(candidate);
+      lruEntryPtr = candidate;
+    }
+  }
+  // only the first victim is weighed against the new entry
+  candidate = nullptr;
   bool IsEvictDone = m_action->evict(lruEntryPtr);
   if (m_action->overflows() && IsEvictDone) {
     --m_validEntries;
@@ -225,11 +267,13 @@ GfErrType LRUEntriesMap::invalidate(const CacheableKeyPtr& key,
     oldValue = m_pmPtr->read(key, persistenceInfo);
     if (oldValue != nullptr) {
       m_pmPtr->destroy(key, persistenceInfo);
+      me->getLRUProperties().setPersistenceInfo(persistenceInfo);
     }
   }
   if (!isOldValueToken) {
     --m_validEntries;
     me->getLRUProperties().setEvicted();
+    m_lruList.removeEntry(me);
     newSize = CacheableToken::invalid()->objectSize();
     if (oldValue != nullptr) {
       newSize -= oldValue->objectSize();
@@ -255,6 +299,7 @@ GfErrType LRUEntriesMap::put(const CacheableKeyPtr& key,
 
   GfErrType err = GF_NOERR;
   bool segmentLocked = false;
+  recordAccess(key);
   {
     if (m_action != nullptr &&
         m_action->getType() == LRUAction::OVERFLOW_TO_DISK) {
@@ -292,6 +337,7 @@ GfErrType LRUEntriesMap::put(const CacheableKeyPtr& key,
       oldValue = m_pmPtr->read(key, persistenceInfo);
       if (oldValue != nullptr) {
         m_pmPtr->destroy(key, persistenceInfo);
+        me->getLRUProperties().setPersistenceInfo(persistenceInfo);
       }
     }
     // SpinLock& lock = segmentRPtr->getSpinLock();
@@ -349,7 +395,7 @@ GfErrType LRUEntriesMap::put(const CacheableKeyPtr& key,
     updateMapSize(newSize);
   }
 
-  err = processLRU();
+  err = processLRU(isUpdate ? nullptr : me);
 
   if (segmentLocked) {
     segmentRPtr->release();
@@ -370,6 +416,7 @@ bool LRUEntriesMap::get(const CacheableKeyPtr& key, CacheablePtr& returnPtr,
   bool doProcessLRU = false;
   MapSegment* segmentRPtr = segmentFor(key);
   bool segmentLocked = false;
+  recordAccess(key);
   if (m_action != nullptr &&
       m_action->getType() == LRUAction::OVERFLOW_TO_DISK) {
     segmentRPtr->acquire();
@@ -405,6 +452,8 @@ bool LRUEntriesMap::get(const CacheableKeyPtr& key, CacheablePtr& returnPtr,
       VersionTagPtr versionTag;
       if (GF_NOERR == segmentRPtr->put(key, tmpObj, mePtr, oldValue, 0, 0,
                                        isUpdate, versionTag, nullptr)) {
+        // the value is back in memory, so its disk copy is garbage now
+        releaseFromDisk(key, mePtr);
         // m_entriesRetrieved++;
         ++m_validEntries;
         lruProps.clearEvicted();
@@ -454,6 +503,7 @@ GfErrType LRUEntriesMap::remove(const CacheableKeyPtr& key,
     if (result != nullptr && me != nullptr) {
       LRUEntryProperties& lruProps = me->getLRUProperties();
       lruProps.setEvicted();
+      m_lruList.removeEntry(me);
       if (isEntryFound) --m_size;
       if (!CacheableToken::isToken(result)) {
         --m_validEntries;
@@ -471,6 +521,7 @@ GfErrType LRUEntriesMap::remove(const CacheableKeyPtr& key,
         result = m_pmPtr->read(key, persistenceInfo);
         if (result != nullptr) {
           m_pmPtr->destroy(key, persistenceInfo);
+          lruProps.setPersistenceInfo(persistenceInfo);
         }
       }
       if (m_evictionControllerPtr != nullptr) {
@@ -487,14 +538,23 @@ void LRUEntriesMap::updateMapSize(int64_t size) {
   // TODO: check and remove null check since this has already been done
   // by all the callers
   if (m_evictionControllerPtr != nullptr) {
+    int64_t mapSize;
     {
       std::lock_guard<spinlock_mutex> __guard(m_mapInfoLock);
       m_currentMapSize += size;
+      mapSize = m_currentMapSize;
     }
     m_evictionControllerPtr->updateRegionHeapInfo(size);
+    m_region->getRegionStats()->setHeapLRUSize(
+        m_evictionControllerPtr->estimatedSize(mapSize));
   }
 }
 
+int64_t LRUEntriesMap::getHeapLRUSize() {
+  std::lock_guard<spinlock_mutex> __guard(m_mapInfoLock);
+  return m_currentMapSize;
+}
+
 CacheablePtr LRUEntriesMap::getFromDisk(const CacheableKeyPtr& key,
                                         MapEntryImplPtr& me) const {
   void* persistenceInfo = me->getLRUProperties().getPersistenceInfo();
@@ -509,6 +569,19 @@ CacheablePtr LRUEntriesMap::getFromDisk(const CacheableKeyPtr& key,
   }
   return tmpObj;
 }
+
+void LRUEntriesMap::releaseFromDisk(const CacheableKeyPtr& key,
+                                    MapEntryImplPtr& me) {
+  LRUEntryProperties& lruProps = me->getLRUProperties();
+  void* persistenceInfo = lruProps.getPersistenceInfo();
+  try {
+    m_pmPtr->destroy(key, persistenceInfo);
+  } catch (Exception& ex) {
+    LOGERROR("destroy on the persistence layer failed - %s", ex.getMessage());
+    return;
+  }
+  lruProps.setPersistenceInfo(persistenceInfo);
+}
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -24,6 +24,7 @@
 #include <geode/geode_globals.hpp>
 #include <geode/Cache.hpp>
 #include "ConcurrentEntriesMap.hpp"
+#include "FrequencySketch.hpp"
 #include "LRUAction.hpp"
 #include "LRUList.hpp"
 #include "LRUMapEntry.hpp"
@@ -62,7 +63,7 @@ class CPPCACHE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap,
                                       private NonAssignable {
  protected:
   LRUAction* m_action;
-  LRUList<MapEntryImpl, MapEntryT<LRUMapEntry, 0, 0> > m_lruList;
+  LRUList<MapEntryImpl> m_lruList;
   uint32_t m_limit;
   PersistenceManagerPtr m_pmPtr;
   EvictionController* m_evictionControllerPtr;
@@ -71,12 +72,26 @@ class CPPCACHE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap,
   std::string m_name;
   std::atomic<uint32_t> m_validEntries;
   bool m_heapLRUEnabled;
+  // access frequencies for TinyLFU admission, nullptr when disabled
+  FrequencySketch* m_admissionFilter;
+
+  // keys tracked by the admission filter of a map without an entry limit
+  static const uint32_t DEFAULT_ADMISSION_KEYS = 1 << 14;
+
+  inline void recordAccess(const CacheableKeyPtr& key) {
+    if (m_admissionFilter != nullptr) {
+      m_admissionFilter->increment(key->hashcode());
+    }
+  }
+
+  GfErrType evictionHelper(MapEntryImplPtr& candidate);
 
  public:
   LRUEntriesMap(EntryFactory* entryFactory, RegionInternal* region,
                 const LRUAction::Action& lruAction, const uint32_t limit,
                 bool concurrencyChecksEnabled, const uint8_t concurrency = 16,
-                bool heapLRUEnabled = false);
+                bool heapLRUEnabled = false,
+                bool admissionFilterEnabled = false);
 
   virtual ~LRUEntriesMap();
 
@@ -97,10 +112,19 @@ class CPPCACHE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap,
                    MapEntryImplPtr& me);
   virtual CacheablePtr getFromDisk(const CacheableKeyPtr& key,
                                    MapEntryImplPtr& me) const;
-  GfErrType processLRU();
+  virtual void releaseFromDisk(const CacheableKeyPtr& key,
+                               MapEntryImplPtr& me);
+  /**
+   * @brief evict until the map is within its limit. With the admission
+   * filter enabled a new entry passed as candidate is evicted in place of
+   * the least recently used one if its key has been used less often.
+   */
+  GfErrType processLRU(MapEntryImplPtr candidate = nullptr);
   void processLRU(int32_t numEntriesToEvict);
   GfErrType evictionHelper();
   void updateMapSize(int64_t size);
+  /** @brief the bytes reported by the keys and values for heap LRU */
+  int64_t getHeapLRUSize();
   inline void setPersistenceManager(PersistenceManagerPtr& pmPtr) {
     m_pmPtr = pmPtr;
   }
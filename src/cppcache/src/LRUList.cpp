@@ -18,6 +18,7 @@
 #include "util/concurrent/spinlock_mutex.hpp"
 
 #include <mutex>
+#include <vector>
 
 namespace apache {
 namespace geode {
@@ -25,110 +26,116 @@ namespace client {
 
 using util::concurrent::spinlock_mutex;
 
-template <typename TEntry, typename TCreateEntry>
-LRUList<TEntry, TCreateEntry>::LRUList() : m_headLock(), m_tailLock() {
-  LRUListEntryPtr headEntry(TCreateEntry::create(nullptr));
-  headEntry->getLRUProperties().setEvicted();  // create empty evicted entry.
-  m_headNode = new LRUListNode(headEntry);
-  m_tailNode = m_headNode;
-}
+template <typename TEntry>
+LRUList<TEntry>::LRUList() : m_lock(), m_head(nullptr), m_tail(nullptr) {}
 
-template <typename TEntry, typename TCreateEntry>
-LRUList<TEntry, TCreateEntry>::~LRUList() {
-  m_tailNode = nullptr;
-  LRUListNode* next;
-  while (m_headNode != nullptr) {
-    next = m_headNode->getNextLRUListNode();
-    delete m_headNode;
-    m_headNode = next;
-  }
+template <typename TEntry>
+LRUList<TEntry>::~LRUList() {
+  clear();
 }
 
-template <typename TEntry, typename TCreateEntry>
-void LRUList<TEntry, TCreateEntry>::appendEntry(const LRUListEntryPtr& entry) {
-  std::lock_guard<spinlock_mutex> lk(m_tailLock);
-
-  LRUListNode* aNode = new LRUListNode(entry);
-  m_tailNode->setNextLRUListNode(aNode);
-  m_tailNode = aNode;
+template <typename TEntry>
+void LRUList<TEntry>::appendEntry(const LRUListEntryPtr& entry) {
+  LRUListEntryPtr previous;
+  std::lock_guard<spinlock_mutex> lk(m_lock);
+  unlink(entry.get(), previous);
+  link(entry, false);
 }
 
-template <typename TEntry, typename TCreateEntry>
-void LRUList<TEntry, TCreateEntry>::appendNode(LRUListNode* aNode) {
-  std::lock_guard<spinlock_mutex> lk(m_tailLock);
-
-  GF_D_ASSERT(aNode != nullptr);
+template <typename TEntry>
+void LRUList<TEntry>::prependEntry(const LRUListEntryPtr& entry) {
+  LRUListEntryPtr previous;
+  std::lock_guard<spinlock_mutex> lk(m_lock);
+  unlink(entry.get(), previous);
+  link(entry, true);
+}
 
-  aNode->clearNextLRUListNode();
-  m_tailNode->setNextLRUListNode(aNode);
-  m_tailNode = aNode;
+template <typename TEntry>
+void LRUList<TEntry>::removeEntry(const LRUListEntryPtr& entry) {
+  LRUListEntryPtr previous;
+  std::lock_guard<spinlock_mutex> lk(m_lock);
+  unlink(entry.get(), previous);
 }
 
-template <typename TEntry, typename TCreateEntry>
-void LRUList<TEntry, TCreateEntry>::getLRUEntry(LRUListEntryPtr& result) {
-  bool isLast = false;
-  LRUListNode* aNode;
-  while (true) {
-    aNode = getHeadNode(isLast);
-    if (aNode == nullptr) {
-      result = nullptr;
-      break;
-    }
-    aNode->getEntry(result);
-    if (isLast) {
-      break;
-    }
-    // otherwise, check if it should be discarded or put back on the list
-    // instead of returned...
-    LRUEntryProperties& lruProps = result->getLRUProperties();
-    if (!lruProps.testEvicted()) {
-      if (lruProps.testRecentlyUsed()) {
-        lruProps.clearRecentlyUsed();
-        appendNode(aNode);
-        // now try again.
-      } else {
-        delete aNode;
-        break;  // found unused entry
-      }
+template <typename TEntry>
+void LRUList<TEntry>::getLRUEntry(LRUListEntryPtr& result,
+                                  const TEntry* excluded) {
+  // entries dropped from the list are released after the lock
+  std::vector<LRUListEntryPtr> dropped;
+  std::lock_guard<spinlock_mutex> lk(m_lock);
+  TEntry* entry = m_head;
+  while (entry != nullptr) {
+    TEntry* next = static_cast<TEntry*>(propsOf(entry).m_lruNext);
+    LRUEntryProperties& lruProps = entry->getLRUProperties();
+    if (entry == excluded) {
+      // passed over, it stays where it is
+    } else if (lruProps.testEvicted()) {
+      // drop the entry to the floor ...
+      dropped.push_back(nullptr);
+      unlink(entry, dropped.back());
+    } else if (lruProps.testRecentlyUsed() && entry != m_tail) {
+      lruProps.clearRecentlyUsed();
+      unlink(entry, result);
+      link(result, false);
+      // now try again, next reaches it once more at the tail.
     } else {
-      result = nullptr;  // remove the reference to entry
-      delete aNode;      // drop the entry to the floor ...
+      unlink(entry, result);
+      return;  // found unused entry
     }
+    entry = next;
   }
+  result = nullptr;
 }
 
-template <typename TEntry, typename TCreateEntry>
-typename LRUList<TEntry, TCreateEntry>::LRUListNode*
-LRUList<TEntry, TCreateEntry>::getHeadNode(bool& isLast) {
-  std::lock_guard<spinlock_mutex> lk(m_headLock);
-
-  LRUListNode* result = m_headNode;
-  LRUListNode* nextNode;
-
-  {
-    std::lock_guard<spinlock_mutex> lk(m_tailLock);
-
-    nextNode = m_headNode->getNextLRUListNode();
-    if (nextNode == nullptr) {
-      // last one in the list...
-      isLast = true;
-      LRUListEntryPtr entry;
-      result->getEntry(entry);
-      if (entry->getLRUProperties().testEvicted()) {
-        // list is empty.
-        return nullptr;
-      } else {
-        entry->getLRUProperties().setEvicted();
-        return result;
-      }
-    }
+template <typename TEntry>
+void LRUList<TEntry>::clear() {
+  std::vector<LRUListEntryPtr> dropped;
+  std::lock_guard<spinlock_mutex> lk(m_lock);
+  while (m_head != nullptr) {
+    dropped.push_back(nullptr);
+    unlink(m_head, dropped.back());
   }
+}
 
-  isLast = false;
-  // advance head node, and return old value.
-  m_headNode = nextNode;
+template <typename TEntry>
+void LRUList<TEntry>::link(const LRUListEntryPtr& entry, bool atHead) {
+  LRUEntryProperties& lruProps = entry->getLRUProperties();
+  lruProps.m_lruSelf = entry;
+  if (m_head == nullptr) {
+    lruProps.m_lruPrev = lruProps.m_lruNext = nullptr;
+    m_head = m_tail = entry.get();
+  } else if (atHead) {
+    lruProps.m_lruPrev = nullptr;
+    lruProps.m_lruNext = m_head;
+    propsOf(m_head).m_lruPrev = entry.get();
+    m_head = entry.get();
+  } else {
+    lruProps.m_lruPrev = m_tail;
+    lruProps.m_lruNext = nullptr;
+    propsOf(m_tail).m_lruNext = entry.get();
+    m_tail = entry.get();
+  }
+}
 
-  return result;
+template <typename TEntry>
+void LRUList<TEntry>::unlink(TEntry* entry, LRUListEntryPtr& result) {
+  LRUEntryProperties& lruProps = entry->getLRUProperties();
+  if (lruProps.m_lruSelf == nullptr) {
+    return;
+  }
+  if (lruProps.m_lruPrev != nullptr) {
+    propsOf(lruProps.m_lruPrev).m_lruNext = lruProps.m_lruNext;
+  } else {
+    m_head = static_cast<TEntry*>(lruProps.m_lruNext);
+  }
+  if (lruProps.m_lruNext != nullptr) {
+    propsOf(lruProps.m_lruNext).m_lruPrev = lruProps.m_lruPrev;
+  } else {
+    m_tail = static_cast<TEntry*>(lruProps.m_lruPrev);
+  }
+  lruProps.m_lruPrev = lruProps.m_lruNext = nullptr;
+  result = std::static_pointer_cast<TEntry>(lruProps.m_lruSelf);
+  lruProps.m_lruSelf.reset();
 }
 
 }  // namespace client
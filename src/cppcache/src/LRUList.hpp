@@ -38,10 +38,16 @@ namespace client {
 
 /**
  * @brief This class encapsulates LRU specific properties for a LRUList node.
+ * It also holds the links of the entry in the (intrusive) LRUList, so that
+ * putting an entry on the list does not allocate.
  */
 class CPPCACHE_EXPORT LRUEntryProperties {
  public:
-  inline LRUEntryProperties() : m_bits(0), m_persistenceInfo(nullptr) {}
+  inline LRUEntryProperties()
+      : m_bits(0),
+        m_persistenceInfo(nullptr),
+        m_lruPrev(nullptr),
+        m_lruNext(nullptr) {}
 
   inline void setRecentlyUsed() { m_bits |= RECENTLY_USED_BITS; }
 
@@ -66,12 +72,22 @@ class CPPCACHE_EXPORT LRUEntryProperties {
   }
 
  protected:
-  // this constructor deliberately skips initializing any fields
-  inline LRUEntryProperties(bool noInit) {}
+  // this constructor deliberately skips initializing the LRU state; only
+  // the list links are cleared
+  inline LRUEntryProperties(bool noInit)
+      : m_lruPrev(nullptr), m_lruNext(nullptr) {}
 
  private:
+  template <typename TEntry>
+  friend class LRUList;
+
   std::atomic<uint32_t> m_bits;
   void* m_persistenceInfo;
+  // links of the LRUList the entry is on, guarded by the lock of the list;
+  // m_lruSelf keeps a linked entry alive and is empty when it is not linked
+  void* m_lruPrev;
+  void* m_lruNext;
+  std::shared_ptr<void> m_lruSelf;
 };
 
 using util::concurrent::spinlock_mutex;
@@ -81,75 +97,69 @@ using util::concurrent::spinlock_mutex;
  * approximate LRU order. The <code>TEntry</code> template argument
  * must provide a <code>getLRUProperties</code> method that returns an
  * object of class <code>LRUEntryProperties</code>.
+ *
+ * The list is doubly linked through the LRUEntryProperties of the entries,
+ * so entries are added, moved and removed without allocating. Entries that
+ * were used since they were appended get a second chance (CLOCK): they are
+ * moved to the tail with their recently used bit cleared instead of being
+ * returned.
  */
-template <typename TEntry, typename TCreateEntry>
+template <typename TEntry>
 class LRUList {
  protected:
   typedef std::shared_ptr<TEntry> LRUListEntryPtr;
 
-  /**
-   * @brief The entries in the LRU List are instances of LRUListNode.
-   * This maintains the evicted and recently used state for each entry.
-   */
-  class LRUListNode {
-   public:
-    inline LRUListNode(const LRUListEntryPtr& entry)
-        : m_entry(entry), m_nextLRUListNode(nullptr) {}
-
-    inline ~LRUListNode() {}
-
-    inline void getEntry(LRUListEntryPtr& result) const { result = m_entry; }
-
-    inline LRUListNode* getNextLRUListNode() const { return m_nextLRUListNode; }
-
-    inline void setNextLRUListNode(LRUListNode* next) {
-      m_nextLRUListNode = next;
-    }
-
-    inline void clearNextLRUListNode() { m_nextLRUListNode = nullptr; }
-
-   private:
-    LRUListEntryPtr m_entry;
-    LRUListNode* m_nextLRUListNode;
-
-    // disabled
-    LRUListNode(const LRUListNode&);
-    LRUListNode& operator=(const LRUListNode&);
-  };
-
  public:
   LRUList();
   ~LRUList();
 
   /**
-   * @brief add an entry to the tail of the list.
+   * @brief add an entry to the tail of the list, moving it there if it is
+   * already on the list.
    */
   void appendEntry(const LRUListEntryPtr& entry);
 
   /**
-   * @brief return the least recently used node from the list,
-   * and removing it from the list.
+   * @brief put an entry back at the head of the list, so that it is the
+   * next one returned.
    */
-  void getLRUEntry(LRUListEntryPtr& result);
+  void prependEntry(const LRUListEntryPtr& entry);
+
+  /**
+   * @brief take an entry off the list; does nothing if it is not on it.
+   */
+  void removeEntry(const LRUListEntryPtr& entry);
 
- private:
   /**
-   * @brief add a node to the tail of the list.
+   * @brief return the least recently used node from the list,
+   * and removing it from the list. The <code>excluded</code> entry, if
+   * any, is never returned and stays on the list.
    */
-  void appendNode(LRUListNode* aNode);
+  void getLRUEntry(LRUListEntryPtr& result, const TEntry* excluded = nullptr);
 
   /**
-   * @brief return the head entry in the list,
-   * and removing it from the list.
+   * @brief take all entries off the list.
    */
-  LRUListNode* getHeadNode(bool& isLast);
+  void clear();
+
+ private:
+  static LRUEntryProperties& propsOf(void* entry) {
+    return static_cast<TEntry*>(entry)->getLRUProperties();
+  }
+
+  void link(const LRUListEntryPtr& entry, bool atHead);
+
+  // unlinks the entry and hands back the reference the list held
+  void unlink(TEntry* entry, LRUListEntryPtr& result);
 
-  spinlock_mutex m_headLock;
-  spinlock_mutex m_tailLock;
+  spinlock_mutex m_lock;
 
-  LRUListNode* m_headNode;
-  LRUListNode* m_tailNode;
+  TEntry* m_head;
+  TEntry* m_tail;
 
+  // disabled
+  LRUList(const LRUList&);
+  LRUList& operator=(const LRUList&);
 };  // LRUList
 }  // namespace client
 }  // namespace geode
@@ -68,9 +68,8 @@ class CPPCACHE_EXPORT LRUMapEntry : public MapEntryImpl,
 
   virtual void cleanup(const CacheEventFlags eventFlags) {
     if (!eventFlags.isEviction()) {
-      // TODO:  this needs an implementation of doubly-linked list
-      // to remove from the list; also add this to LRUExpMapEntry since MI
-      // has been removed
+      // LRUEntriesMap unlinks removed entries from its list; any entry
+      // left linked is dropped when it reaches the head of the list
     }
   }
 
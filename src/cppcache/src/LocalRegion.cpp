@@ -31,6 +31,7 @@
 #include "TXState.hpp"
 #include "VersionTag.hpp"
 #include <vector>
+#include <mutex>
 #include <geode/PoolManager.hpp>
 
 namespace apache {
@@ -334,6 +335,100 @@ void LocalRegion::put(const CacheableKeyPtr& key, const CacheablePtr& value,
   GfErrTypeToException("Region::put", err);
 }
 
+namespace {
+// Completes a promise with the exception that GfErrTypeToException() throws
+// for the given error.
+template <typename TPromise>
+void setPromiseError(TPromise& promise, const char* operation, GfErrType err) {
+  try {
+    GfErrTypeToException(operation, err);
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+  }
+}
+}  // namespace
+
+std::future<CacheablePtr> LocalRegion::getAsync(
+    const CacheableKeyPtr& key, const UserDataPtr& aCallbackArgument) {
+  auto promise = std::make_shared<std::promise<CacheablePtr>>();
+  std::future<CacheablePtr> result = promise->get_future();
+  GfErrType err = getAsyncNoThrow(
+      key, aCallbackArgument,
+      [promise](GfErrType err, const CacheablePtr& value) {
+        if (err == GF_NOERR) {
+          promise->set_value(value);
+        } else {
+          setPromiseError(*promise, "Region::getAsync", err);
+        }
+      });
+  if (err == GF_NOTSUP) {
+    try {
+      promise->set_value(get(key, aCallbackArgument));
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  } else if (err != GF_NOERR) {
+    setPromiseError(*promise, "Region::getAsync", err);
+  }
+  return result;
+}
+
+std::future<void> LocalRegion::putAsync(const CacheableKeyPtr& key,
+                                        const CacheablePtr& value,
+                                        const UserDataPtr& aCallbackArgument) {
+  auto promise = std::make_shared<std::promise<void>>();
+  std::future<void> result = promise->get_future();
+  GfErrType err =
+      putAsyncNoThrow(key, value, aCallbackArgument, [promise](GfErrType err) {
+        if (err == GF_NOERR) {
+          promise->set_value();
+        } else {
+          setPromiseError(*promise, "Region::putAsync", err);
+        }
+      });
+  if (err == GF_NOTSUP) {
+    try {
+      put(key, value, aCallbackArgument);
+      promise->set_value();
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  } else if (err != GF_NOERR) {
+    setPromiseError(*promise, "Region::putAsync", err);
+  }
+  return result;
+}
+
+std::future<HashMapOfCacheablePtr> LocalRegion::getAllAsync(
+    const VectorOfCacheableKey& keys, const UserDataPtr& aCallbackArgument) {
+  if (keys.size() == 0) {
+    throw IllegalArgumentException("Region::getAllAsync: zero keys provided");
+  }
+  auto promise = std::make_shared<std::promise<HashMapOfCacheablePtr>>();
+  std::future<HashMapOfCacheablePtr> result = promise->get_future();
+  auto values = std::make_shared<HashMapOfCacheable>();
+  GfErrType err = getAllAsyncNoThrow(
+      keys, values, aCallbackArgument, [promise, values](GfErrType err) {
+        if (err == GF_NOERR) {
+          promise->set_value(values);
+        } else {
+          setPromiseError(*promise, "Region::getAllAsync", err);
+        }
+      });
+  if (err == GF_NOTSUP) {
+    try {
+      getAll(keys, values, nullptr, m_regionAttributes->getCachingEnabled(),
+             aCallbackArgument);
+      promise->set_value(values);
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  } else if (err != GF_NOERR) {
+    setPromiseError(*promise, "Region::getAllAsync", err);
+  }
+  return result;
+}
+
 void LocalRegion::localPut(const CacheableKeyPtr& key,
                            const CacheablePtr& value,
                            const UserDataPtr& aCallbackArgument) {
@@ -551,6 +646,26 @@ void LocalRegion::getAll(const VectorOfCacheableKey& keys,
   // handleReplay(err, nullptr);
   GfErrTypeToException("Region::getAll", err);
 }
+
+void LocalRegion::getAll(const VectorOfCacheableKey& keys,
+                         const GetAllListenerPtr& listener,
+                         bool addToLocalCache,
+                         const UserDataPtr& aCallbackArgument) {
+  if (keys.size() == 0) {
+    throw IllegalArgumentException("Region::getAll: zero keys provided");
+  }
+  if (listener == nullptr) {
+    throw IllegalArgumentException("Region::getAll: null listener provided");
+  }
+
+  int64_t sampleStartNanos = Utils::startStatOpTime();
+  GfErrType err = getAllNoThrow(keys, nullptr, nullptr, addToLocalCache,
+                                aCallbackArgument, listener);
+  Utils::updateStatOpTime(m_regionStats->getStat(),
+                          RegionStatType::getInstance()->getGetAllTimeId(),
+                          sampleStartNanos);
+  GfErrTypeToException("Region::getAll", err);
+}
 uint32_t LocalRegion::size_remote() {
   CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::size);
   if (m_regionAttributes->getCachingEnabled()) {
@@ -665,13 +780,10 @@ void LocalRegion::registerEntryExpiryTask(MapEntryImplPtr& entry) {
   // the entry will register the expiry task for that entry
   ExpEntryProperties& expProps = entry->getExpProperties();
   expProps.initStartTime();
-  RegionInternalPtr rptr =
-      std::static_pointer_cast<RegionInternal>(shared_from_this());
   uint32_t duration = getEntryExpiryDuration();
-  EntryExpiryHandler* handler =
-      new EntryExpiryHandler(rptr, entry, getEntryExpirationAction(), duration);
-  int64_t id =
-      CacheImpl::expiryTaskManager->scheduleExpiryTask(handler, duration, 0);
+  auto handler = getEntryExpiryHandler(getEntryExpirationAction(), duration);
+  int64_t id = CacheImpl::expiryTaskManager->scheduleWheelExpiryTask(
+      handler, entry, duration);
   if (Log::finestEnabled()) {
     CacheableKeyPtr key;
     entry->getKeyI(key);
@@ -684,6 +796,23 @@ void LocalRegion::registerEntryExpiryTask(MapEntryImplPtr& entry) {
   expProps.setExpiryTaskId(id);
 }
 
+std::shared_ptr<EntryExpiryHandler> LocalRegion::getEntryExpiryHandler(
+    ExpirationAction::Action action, uint32_t duration) {
+  std::lock_guard<util::concurrent::spinlock_mutex> lk(
+      m_entryExpiryHandlerLock);
+  auto handler = m_entryExpiryHandler.lock();
+  // the expiration attributes may have been changed through the
+  // AttributesMutator; tasks already scheduled keep the old handler
+  if (handler == nullptr || handler->getAction() != action ||
+      handler->getDuration() != duration) {
+    RegionInternalPtr rptr =
+        std::static_pointer_cast<RegionInternal>(shared_from_this());
+    handler = std::make_shared<EntryExpiryHandler>(rptr, action, duration);
+    m_entryExpiryHandler = handler;
+  }
+  return handler;
+}
+
 LocalRegion::~LocalRegion() {
   TryWriteGuard guard(m_rwLock, m_destroyPending);
   if (!m_destroyPending) {
@@ -831,16 +960,74 @@ GfErrType LocalRegion::getNoThrow(const CacheableKeyPtr& keyPtr,
     }
     localValue = value;
     value = nullptr;
-    // start tracking the entry
-    if (!m_regionAttributes->getConcurrencyChecksEnabled()) {
-      updateCount =
-          m_entries->addTrackerForEntry(keyPtr, value, true, false, false);
-      LOGDEBUG(
-          "Region::get: added tracking with update counter [%d] for key "
-          "[%s] with value [%s]",
-          updateCount, Utils::getCacheableKeyString(keyPtr)->asChar(),
-          Utils::getCacheableString(value)->asChar());
+  }
+
+  // join a get of the key already in flight rather than issuing another;
+  // a callback argument may change what is fetched so those gets go alone.
+  // In multiuser mode only gets of the same user are joined since the
+  // server authorizes each get with the credentials of its user.
+  bool leader = true;
+  InFlightGets::CallPtr inFlight;
+  InFlightGetKey inFlightKey(
+      TSSUserAttributesWrapper::s_geodeTSSUserAttributes->getUserAttributes(),
+      keyPtr);
+  if (aCallbackArgument == nullptr) {
+    inFlight = m_inFlightGets.join(inFlightKey, leader);
+  }
+  if (!leader) {
+    updateAccessAndModifiedTime(false);
+    m_regionStats->incMisses();
+    m_cacheImpl->m_cacheStats->incMisses();
+    m_regionStats->incCoalescedGets();
+    LOGDEBUG("Region::get: waiting for the get in flight for key [%s]",
+             Utils::getCacheableKeyString(keyPtr)->asChar());
+    std::pair<GfErrType, CacheablePtr> result = inFlight->wait();
+    value = result.second;
+    return result.first;
+  }
+
+  // hand the result to the gets that joined before exiting the function
+  struct CompleteFlight {
+   private:
+    const InFlightGetKey& m_key;
+    InFlightGets::CallPtr m_call;
+    const GfErrType& m_err;
+    const CacheablePtr& m_value;
+    LocalRegion& m_region;
+
+   public:
+    CompleteFlight(const InFlightGetKey& key,
+                   const InFlightGets::CallPtr& call, const GfErrType& err,
+                   const CacheablePtr& value, LocalRegion& region)
+        : m_key(key),
+          m_call(call),
+          m_err(err),
+          m_value(value),
+          m_region(region) {}
+    ~CompleteFlight() { complete(); }
+    void complete() {
+      if (m_call != nullptr) {
+        CacheablePtr value = m_value;
+        if (CacheableToken::isInvalid(value) ||
+            CacheableToken::isTombstone(value)) {
+          value = nullptr;
+        }
+        m_region.m_inFlightGets.complete(m_key, m_call,
+                                         std::make_pair(m_err, value));
+        m_call = nullptr;
+      }
     }
+  } _completeFlight(inFlightKey, inFlight, err, value, *this);
+
+  // start tracking the entry
+  if (cachingEnabled && !m_regionAttributes->getConcurrencyChecksEnabled()) {
+    updateCount =
+        m_entries->addTrackerForEntry(keyPtr, value, true, false, false);
+    LOGDEBUG(
+        "Region::get: added tracking with update counter [%d] for key "
+        "[%s] with value [%s]",
+        updateCount, Utils::getCacheableKeyString(keyPtr)->asChar(),
+        Utils::getCacheableString(value)->asChar());
   }
 
   // remove tracking for the entry before exiting the function
@@ -925,7 +1112,8 @@ GfErrType LocalRegion::getNoThrow(const CacheableKeyPtr& keyPtr,
           value = nullptr;
         }
         // don't do anything and  exit
-        return GF_NOERR;
+        err = GF_NOERR;
+        return err;
       }
 
       LOGDEBUG("Region::get: putLocal for key [%s] failed with error %d",
@@ -946,6 +1134,9 @@ GfErrType LocalRegion::getNoThrow(const CacheableKeyPtr& keyPtr,
     value = nullptr;
   }
 
+  // the joined gets must not wait on a listener that may itself get the key
+  _completeFlight.complete();
+
   // invokeCacheListenerForEntryEvent method has the check that if oldValue
   // is a CacheableToken then it sets it to nullptr; also determines if it
   // should be AFTER_UPDATE or AFTER_CREATE depending on oldValue, so don't
@@ -959,11 +1150,187 @@ GfErrType LocalRegion::getNoThrow(const CacheableKeyPtr& keyPtr,
   return err;
 }
 
+GfErrType LocalRegion::getAsyncNoThrow(const CacheableKeyPtr& keyPtr,
+                                       const UserDataPtr& aCallbackArgument,
+                                       const GetCompletion& done) {
+  CHECK_DESTROY_PENDING_NOTHROW(TryReadGuard);
+  if (keyPtr == nullptr) {
+    return GF_CACHE_ILLEGAL_ARGUMENT_EXCEPTION;
+  }
+  if (getTXState() != nullptr || m_loader != nullptr) {
+    return GF_NOTSUP;
+  }
+
+  bool cachingEnabled = m_regionAttributes->getCachingEnabled();
+  bool isLocal = false;
+  CacheablePtr localValue = nullptr;
+  if (cachingEnabled) {
+    MapEntryImplPtr me;
+    isLocal = m_entries->get(keyPtr, localValue, me);
+    if (isLocal &&
+        (localValue != nullptr && !CacheableToken::isInvalid(localValue))) {
+      // local hit; getNoThrow() serves it without any I/O
+      return GF_NOTSUP;
+    }
+  }
+  int updateCount = -1;
+  if (cachingEnabled && !m_regionAttributes->getConcurrencyChecksEnabled()) {
+    CacheablePtr trackedValue;
+    updateCount =
+        m_entries->addTrackerForEntry(keyPtr, trackedValue, true, false, false);
+  }
+
+  // counted before the request goes out, so that they never land after the
+  // completion has run
+  m_regionStats->incGets();
+  m_cacheImpl->m_cacheStats->incGets();
+  updateAccessAndModifiedTime(false);
+  m_regionStats->incMisses();
+  m_cacheImpl->m_cacheStats->incMisses();
+
+  auto region = std::static_pointer_cast<LocalRegion>(shared_from_this());
+  int64_t sampleStartNanos = Utils::startStatOpTime();
+  RemoteGetHandler complete =
+      [region, keyPtr, aCallbackArgument, localValue, isLocal, updateCount,
+       sampleStartNanos, done](GfErrType err, const CacheablePtr& remoteValue,
+                               const VersionTagPtr& versionTag) {
+        CacheablePtr value = remoteValue;
+        err = region->completeAsyncGet(keyPtr, value, aCallbackArgument,
+                                       localValue, isLocal, updateCount,
+                                       versionTag, err);
+        Utils::updateStatOpTime(region->m_regionStats->getStat(),
+                                RegionStatType::getInstance()->getGetTimeId(),
+                                sampleStartNanos);
+        done(err, value);
+      };
+  if (getNoThrow_remoteAsync(keyPtr, aCallbackArgument, complete) !=
+      GF_NOERR) {
+    // the synchronous path takes care of failover to other servers
+    CacheablePtr value;
+    VersionTagPtr versionTag;
+    GfErrType err =
+        getNoThrow_remote(keyPtr, value, aCallbackArgument, versionTag);
+    complete(err, value, versionTag);
+  }
+  return GF_NOERR;
+}
+
+// Same local cache handling as the tail of getNoThrow(), run from the thread
+// that received the reply.
+GfErrType LocalRegion::completeAsyncGet(
+    const CacheableKeyPtr& keyPtr, CacheablePtr& value,
+    const UserDataPtr& aCallbackArgument, const CacheablePtr& localValue,
+    bool isLocal, int updateCount, const VersionTagPtr& versionTag,
+    GfErrType err) {
+  CHECK_DESTROY_PENDING_NOTHROW(TryReadGuard);
+  bool cachingEnabled = m_regionAttributes->getCachingEnabled();
+  CacheablePtr oldValue;
+  if (err == GF_NOERR && value != nullptr && cachingEnabled &&
+      !(CacheableToken::isTombstone(value) &&
+        (localValue == nullptr || CacheableToken::isInvalid(localValue)))) {
+    if ((err = putLocal("Region::get", false, keyPtr, value, oldValue,
+                        cachingEnabled, updateCount, 0, versionTag)) !=
+        GF_NOERR) {
+      if (err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
+        if (CacheableToken::isInvalid(value) ||
+            CacheableToken::isTombstone(value)) {
+          value = nullptr;
+        }
+        return GF_NOERR;
+      }
+      LOGDEBUG("Region::getAsync: putLocal for key [%s] failed with error %d",
+               Utils::getCacheableKeyString(keyPtr)->asChar(), err);
+      err = GF_NOERR;
+      if (oldValue != nullptr && !CacheableToken::isInvalid(oldValue)) {
+        value = oldValue;
+      }
+    }
+    // putLocal() has consumed the tracking
+    updateCount = -1;
+  }
+  if (updateCount >= 0 && !m_regionAttributes->getConcurrencyChecksEnabled()) {
+    m_entries->removeTrackerForEntry(keyPtr);
+  }
+  if (err != GF_NOERR) {
+    return err;
+  }
+
+  if (CacheableToken::isInvalid(value) || CacheableToken::isTombstone(value)) {
+    value = nullptr;
+  }
+  if (value != nullptr) {
+    err = invokeCacheListenerForEntryEvent(
+        keyPtr, oldValue, value, aCallbackArgument, CacheEventFlags::NORMAL,
+        AFTER_UPDATE, isLocal);
+  }
+  return err;
+}
+
+GfErrType LocalRegion::getAllAsyncNoThrow(const VectorOfCacheableKey& keys,
+                                          const HashMapOfCacheablePtr& values,
+                                          const UserDataPtr& aCallbackArgument,
+                                          const GetAllCompletion& done) {
+  CHECK_DESTROY_PENDING_NOTHROW(TryReadGuard);
+  if (getTXState() != nullptr) {
+    return GF_NOTSUP;
+  }
+  // local hits are served right away and only the misses are sent; all the
+  // statistics are counted before any request goes out, so that they never
+  // land after the completion has run
+  bool cachingEnabled = m_regionAttributes->getCachingEnabled();
+  auto serverKeys = std::make_shared<VectorOfCacheableKey>();
+  bool regionAccessed = false;
+  for (int32_t index = 0; index < keys.size(); ++index) {
+    const CacheableKeyPtr& key = keys[index];
+    MapEntryImplPtr me;
+    CacheablePtr value;
+    m_regionStats->incGets();
+    m_cacheImpl->m_cacheStats->incGets();
+    if (cachingEnabled && m_entries->get(key, value, me) && value &&
+        !CacheableToken::isInvalid(value)) {
+      m_regionStats->incHits();
+      m_cacheImpl->m_cacheStats->incHits();
+      updateAccessAndModifiedTimeForEntry(me, false);
+      regionAccessed = true;
+      values->emplace(key, value);
+    } else {
+      serverKeys->push_back(key);
+      m_regionStats->incMisses();
+      m_cacheImpl->m_cacheStats->incMisses();
+    }
+  }
+  if (regionAccessed) {
+    updateAccessAndModifiedTime(false);
+  }
+  m_regionStats->incGetAll();
+
+  auto region = std::static_pointer_cast<LocalRegion>(shared_from_this());
+  int64_t sampleStartNanos = Utils::startStatOpTime();
+  RemoteGetAllHandler complete = [region, sampleStartNanos,
+                                  done](GfErrType err) {
+    Utils::updateStatOpTime(region->m_regionStats->getStat(),
+                            RegionStatType::getInstance()->getGetAllTimeId(),
+                            sampleStartNanos);
+    done(err);
+  };
+  if (serverKeys->size() == 0) {
+    complete(GF_NOERR);
+  } else if (getAllNoThrow_remoteAsync(serverKeys, values, cachingEnabled,
+                                       aCallbackArgument,
+                                       complete) != GF_NOERR) {
+    // the synchronous path takes care of failover to other servers
+    complete(getAllNoThrow_remote(serverKeys.get(), values, nullptr, nullptr,
+                                  cachingEnabled, aCallbackArgument));
+  }
+  return GF_NOERR;
+}
+
 GfErrType LocalRegion::getAllNoThrow(const VectorOfCacheableKey& keys,
                                      const HashMapOfCacheablePtr& values,
                                      const HashMapOfExceptionPtr& exceptions,
                                      bool addToLocalCache,
-                                     const UserDataPtr& aCallbackArgument) {
+                                     const UserDataPtr& aCallbackArgument,
+                                     const GetAllListenerPtr& listener) {
   CHECK_DESTROY_PENDING_NOTHROW(TryReadGuard);
   GfErrType err = GF_NOERR;
   CacheablePtr value;
@@ -986,7 +1353,7 @@ GfErrType LocalRegion::getAllNoThrow(const VectorOfCacheableKey& keys,
     // args);
     //		}
     err = getAllNoThrow_remote(&keys, values, exceptions, nullptr, false,
-                               aCallbackArgument);
+                               aCallbackArgument, listener);
     if (err == GF_NOERR) {
       txState->setDirty();
     }
@@ -998,6 +1365,11 @@ GfErrType LocalRegion::getAllNoThrow(const VectorOfCacheableKey& keys,
   VectorOfCacheableKey serverKeys;
   bool cachingEnabled = m_regionAttributes->getCachingEnabled();
   bool regionAccessed = false;
+  // a listener gets the cached values before any request is sent
+  HashMapOfCacheablePtr cachedValues = values;
+  if (listener != nullptr) {
+    cachedValues = std::make_shared<HashMapOfCacheable>();
+  }
 
   for (int32_t index = 0; index < keys.size(); ++index) {
     const CacheableKeyPtr& key = keys[index];
@@ -1005,14 +1377,14 @@ GfErrType LocalRegion::getAllNoThrow(const VectorOfCacheableKey& keys,
     value = nullptr;
     m_regionStats->incGets();
     m_cacheImpl->m_cacheStats->incGets();
-    if (values && cachingEnabled) {
+    if (cachedValues && cachingEnabled) {
       if (m_entries->get(key, value, me) && value &&
           !CacheableToken::isInvalid(value)) {
         m_regionStats->incHits();
         m_cacheImpl->m_cacheStats->incHits();
         updateAccessAndModifiedTimeForEntry(me, false);
         regionAccessed = true;
-        values->emplace(key, value);
+        cachedValues->emplace(key, value);
       } else {
         value = nullptr;
       }
@@ -1029,9 +1401,20 @@ GfErrType LocalRegion::getAllNoThrow(const VectorOfCacheableKey& keys,
   if (regionAccessed) {
     updateAccessAndModifiedTime(false);
   }
+  if (listener != nullptr && cachedValues->size() > 0) {
+    try {
+      listener->onValues(*cachedValues);
+    } catch (const Exception& ex) {
+      LOGERROR("Exception in GetAllListener for region %s: %s: %s",
+               getFullPath(), ex.getName(), ex.getMessage());
+    } catch (...) {
+      LOGERROR("Unknown exception in GetAllListener for region %s",
+               getFullPath());
+    }
+  }
   if (serverKeys.size() > 0) {
     err = getAllNoThrow_remote(&serverKeys, values, exceptions, nullptr,
-                               addToLocalCache, aCallbackArgument);
+                               addToLocalCache, aCallbackArgument, listener);
   }
   m_regionStats->incGetAll();
   return err;
@@ -1296,7 +1679,7 @@ class DestroyActions {
           m_region.updateAccessAndModifiedTime(true);
         }
         // update the stats
-        m_region.m_regionStats->setEntries(m_region.m_entries->size());
+        m_region.updateEntriesStats();
         m_region.m_cacheImpl->m_cacheStats->incEntries(-1);
       }
     }
@@ -1510,7 +1893,7 @@ class RemoveActions {
           m_region.updateAccessAndModifiedTime(true);
         }
         // update the stats
-        m_region.m_regionStats->setEntries(m_region.m_entries->size());
+        m_region.updateEntriesStats();
         m_region.m_cacheImpl->m_cacheStats->incEntries(-1);
       }
     }
@@ -1814,6 +2197,93 @@ GfErrType LocalRegion::putNoThrow(const CacheableKeyPtr& key,
                                    eventId);
 }
 
+GfErrType LocalRegion::putAsyncNoThrow(const CacheableKeyPtr& key,
+                                       const CacheablePtr& value,
+                                       const UserDataPtr& aCallbackArgument,
+                                       const PutCompletion& done) {
+  GfErrType err = GF_NOERR;
+  if ((err = PutActions::checkArgs(key, value)) != GF_NOERR) {
+    return err;
+  }
+  CHECK_DESTROY_PENDING_NOTHROW(TryReadGuard);
+  if (getTXState() != nullptr || m_writer != nullptr) {
+    return GF_NOTSUP;
+  }
+
+  // track the entry so that a notification arriving while the put is in
+  // flight is not overwritten by the older value; see updateNoThrow()
+  int updateCount = -1;
+  if (m_regionAttributes->getCachingEnabled() &&
+      !m_regionAttributes->getConcurrencyChecksEnabled()) {
+    CacheablePtr oldValue;
+    updateCount = m_entries->addTrackerForEntry(key, oldValue,
+                                                PutActions::s_addIfAbsent,
+                                                PutActions::s_failIfPresent,
+                                                true);
+  }
+
+  auto region = std::static_pointer_cast<LocalRegion>(shared_from_this());
+  int64_t sampleStartNanos = Utils::startStatOpTime();
+  err = putNoThrow_remoteAsync(
+      key, value, aCallbackArgument,
+      [region, key, value, aCallbackArgument, updateCount, sampleStartNanos,
+       done](GfErrType err, const VersionTagPtr& versionTag) {
+        err = region->completeAsyncPut(key, value, aCallbackArgument,
+                                       updateCount, versionTag, err);
+        Utils::updateStatOpTime(region->m_regionStats->getStat(),
+                                RegionStatType::getInstance()->getPutTimeId(),
+                                sampleStartNanos);
+        done(err);
+      });
+  if (err != GF_NOERR) {
+    if (updateCount >= 0 &&
+        !m_regionAttributes->getConcurrencyChecksEnabled()) {
+      m_entries->removeTrackerForEntry(key);
+    }
+    // the synchronous path takes care of failover to other servers
+    return GF_NOTSUP;
+  }
+  return GF_NOERR;
+}
+
+GfErrType LocalRegion::completeAsyncPut(const CacheableKeyPtr& key,
+                                        const CacheablePtr& value,
+                                        const UserDataPtr& aCallbackArgument,
+                                        int updateCount,
+                                        const VersionTagPtr& versionTag,
+                                        GfErrType err) {
+  CHECK_DESTROY_PENDING_NOTHROW(TryReadGuard);
+  if (err != GF_NOERR) {
+    if (updateCount >= 0 &&
+        !m_regionAttributes->getConcurrencyChecksEnabled()) {
+      m_entries->removeTrackerForEntry(key);
+    }
+    return err;
+  }
+
+  PutActions action(*this);
+  CacheablePtr oldValue;
+  if ((err = action.localUpdate(key, value, oldValue,
+                                m_regionAttributes->getCachingEnabled(),
+                                CacheEventFlags::NORMAL, updateCount,
+                                versionTag, nullptr, nullptr, true)) ==
+      GF_CACHE_ENTRY_UPDATED) {
+    LOGFINEST(
+        "Region::putAsync: did not change local value for key [%s] since it "
+        "has been updated by another thread while operation was in progress",
+        Utils::getCacheableKeyString(key)->asChar());
+    err = GF_NOERR;
+  } else if (err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
+    // Cache listener won't be called in this case
+    return GF_NOERR;
+  } else if (err != GF_NOERR) {
+    return err;
+  }
+  return invokeCacheListenerForEntryEvent(
+      key, oldValue, value, aCallbackArgument, CacheEventFlags::NORMAL,
+      PutActions::s_afterEventType);
+}
+
 GfErrType LocalRegion::putNoThrowTX(const CacheableKeyPtr& key,
                                     const CacheablePtr& value,
                                     const UserDataPtr& aCallbackArgument,
@@ -2487,7 +2957,7 @@ GfErrType LocalRegion::putLocal(const char* name, bool isCreate,
     m_cacheImpl->m_cacheStats->incPuts();
   } else {
     if (cachingEnabled) {
-      m_regionStats->setEntries(m_entries->size());
+      updateEntriesStats();
       m_cacheImpl->m_cacheStats->incEntries(1);
     }
     m_regionStats->incCreates();
@@ -2650,6 +3120,18 @@ GfErrType LocalRegion::invokeCacheListenerForEntryEvent(
     if (oldValue != nullptr && CacheableToken::isInvalid(oldValue)) {
       oldValue = nullptr;
     }
+    if (eventFlags.isNotification()) {
+      // resolve an update into a create the way the switch below does
+      EntryEventType batchType = type;
+      if (type == AFTER_UPDATE && oldValue == nullptr &&
+          !eventFlags.isNotificationUpdate() && !isLocal) {
+        batchType = AFTER_CREATE;
+      }
+      if (batchEntryEvent(key, oldValue, newValue, aCallbackArgument,
+                          batchType)) {
+        return err;
+      }
+    }
     EntryEvent event(shared_from_this(), key, oldValue, newValue,
                      aCallbackArgument, eventFlags.isNotification());
     const char* eventStr = "unknown";
@@ -2772,6 +3254,15 @@ GfErrType LocalRegion::invokeCacheListenerForRegionEvent(
   return err;
 }
 
+void LocalRegion::updateEntriesStats() {
+  uint32_t size = m_entries->size();
+  m_regionStats->setEntries(size);
+  if (size > 0) {
+    m_regionStats->setTableBytesPerEntry(
+        static_cast<int32_t>(m_entries->tableBytes() / size));
+  }
+}
+
 // TODO:  pass current time instead of evaluating it twice, here
 // and in region
 void LocalRegion::updateAccessAndModifiedTimeForEntry(MapEntryImplPtr& ptr,
@@ -3041,7 +3532,7 @@ GfErrType LocalRegion::getAllNoThrow_remote(
     const VectorOfCacheableKey* keys, const HashMapOfCacheablePtr& values,
     const HashMapOfExceptionPtr& exceptions,
     const VectorOfCacheableKeyPtr& resultKeys, bool addToLocalCache,
-    const UserDataPtr& aCallbackArgument) {
+    const UserDataPtr& aCallbackArgument, const GetAllListenerPtr& listener) {
   return GF_NOERR;
 }
 
@@ -3104,6 +3595,16 @@ void LocalRegion::evict(int32_t percentage) {
     lruMap->processLRU(entriesToEvict);
   }
 }
+
+int64_t LocalRegion::getHeapLRUSize() {
+  TryReadGuard guard(m_rwLock, m_destroyPending);
+  if (m_released || m_destroyPending) return 0;
+  if (m_entries != nullptr) {
+    // only invoked from EvictionController so static_cast is always safe
+    return static_cast<LRUEntriesMap*>(m_entries)->getHeapLRUSize();
+  }
+  return 0;
+}
 void LocalRegion::invokeAfterAllEndPointDisconnected() {
   if (m_listener != nullptr) {
     int64_t sampleStartNanos = Utils::startStatOpTime();
@@ -41,6 +41,7 @@
 #include <geode/CacheLoader.hpp>
 #include <geode/AttributesMutator.hpp>
 #include <geode/AttributesFactory.hpp>
+#include <geode/utils.hpp>
 
 #include "RegionInternal.hpp"
 #include "RegionStats.hpp"
@@ -50,14 +51,20 @@
 #include "CacheableToken.hpp"
 #include "ExpMapEntry.hpp"
 #include "TombstoneList.hpp"
+#include "SingleFlight.hpp"
+#include "InFlightGetKey.hpp"
 
 #include <ace/ACE.h>
 #include <ace/Hash_Map_Manager_T.h>
 #include <ace/Recursive_Thread_Mutex.h>
 
+#include <functional>
+#include <future>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include "TSSTXStateWrapper.hpp"
+#include "util/concurrent/spinlock_mutex.hpp"
 
 namespace apache {
 namespace geode {
@@ -86,6 +93,7 @@ class CreateActions;
 class DestroyActions;
 class RemoveActions;
 class InvalidateActions;
+class EntryExpiryHandler;
 
 typedef std::unordered_map<CacheableKeyPtr, std::pair<CacheablePtr, int> >
     MapOfOldValue;
@@ -164,6 +172,15 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
                    const UserDataPtr& aCallbackArgument);
   void put(const CacheableKeyPtr& key, const CacheablePtr& value,
            const UserDataPtr& aCallbackArgument = nullptr);
+  std::future<CacheablePtr> getAsync(
+      const CacheableKeyPtr& key,
+      const UserDataPtr& aCallbackArgument = nullptr);
+  std::future<void> putAsync(const CacheableKeyPtr& key,
+                             const CacheablePtr& value,
+                             const UserDataPtr& aCallbackArgument = nullptr);
+  std::future<HashMapOfCacheablePtr> getAllAsync(
+      const VectorOfCacheableKey& keys,
+      const UserDataPtr& aCallbackArgument = nullptr);
   void localPut(const CacheableKeyPtr& key, const CacheablePtr& value,
                 const UserDataPtr& aCallbackArgument = nullptr);
   void create(const CacheableKeyPtr& key, const CacheablePtr& value,
@@ -193,6 +210,9 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
   void getAll(const VectorOfCacheableKey& keys, HashMapOfCacheablePtr values,
               HashMapOfExceptionPtr exceptions, bool addToLocalCache,
               const UserDataPtr& aCallbackArgument = nullptr);
+  void getAll(const VectorOfCacheableKey& keys,
+              const GetAllListenerPtr& listener, bool addToLocalCache,
+              const UserDataPtr& aCallbackArgument = nullptr);
   void putAll(const HashMapOfCacheable& map,
               uint32_t timeout = DEFAULT_RESPONSE_TIMEOUT,
               const UserDataPtr& aCallbackArgument = nullptr);
@@ -219,7 +239,8 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
   virtual GfErrType getAllNoThrow(
       const VectorOfCacheableKey& keys, const HashMapOfCacheablePtr& values,
       const HashMapOfExceptionPtr& exceptions, bool addToLocalCache,
-      const UserDataPtr& aCallbackArgument = nullptr);
+      const UserDataPtr& aCallbackArgument = nullptr,
+      const GetAllListenerPtr& listener = nullptr);
   virtual GfErrType putNoThrow(const CacheableKeyPtr& key,
                                const CacheablePtr& value,
                                const UserDataPtr& aCallbackArgument,
@@ -228,6 +249,36 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
                                VersionTagPtr versionTag,
                                DataInput* delta = nullptr,
                                EventIdPtr eventId = nullptr);
+
+  typedef std::function<void(GfErrType, const CacheablePtr&)> GetCompletion;
+  typedef std::function<void(GfErrType)> PutCompletion;
+  typedef std::function<void(GfErrType)> GetAllCompletion;
+
+  /**
+   * Starts a get whose completion is invoked from the thread that completes
+   * the reply, or from the calling thread if the request could not be sent
+   * asynchronously. Returns GF_NOERR if the completion will be invoked,
+   * GF_NOTSUP if the get has to be done synchronously (local hit,
+   * transaction or loader), and any other error for invalid calls.
+   */
+  GfErrType getAsyncNoThrow(const CacheableKeyPtr& key,
+                            const UserDataPtr& aCallbackArgument,
+                            const GetCompletion& done);
+  /** Same contract as getAsyncNoThrow() for a put. */
+  GfErrType putAsyncNoThrow(const CacheableKeyPtr& key,
+                            const CacheablePtr& value,
+                            const UserDataPtr& aCallbackArgument,
+                            const PutCompletion& done);
+  /**
+   * Same contract as getAsyncNoThrow() for a getAll that adds the values to
+   * the local cache if caching is enabled. The values are collected in
+   * values, and the keys missing from the local cache are sent in GET_ALL
+   * requests split as for getAll().
+   */
+  GfErrType getAllAsyncNoThrow(const VectorOfCacheableKey& keys,
+                               const HashMapOfCacheablePtr& values,
+                               const UserDataPtr& aCallbackArgument,
+                               const GetAllCompletion& done);
   virtual GfErrType putNoThrowTX(const CacheableKeyPtr& key,
                                  const CacheablePtr& value,
                                  const UserDataPtr& aCallbackArgument,
@@ -335,6 +386,7 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
                                  const char* factoryFuncName);
   virtual CacheImpl* getCacheImpl() const;
   virtual void evict(int32_t percentage);
+  virtual int64_t getHeapLRUSize();
 
   virtual void acquireGlobals(bool isFailover){};
   virtual void releaseGlobals(bool isFailover){};
@@ -350,6 +402,35 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
                                       CacheablePtr& valPtr,
                                       const UserDataPtr& aCallbackArgument,
                                       VersionTagPtr& versionTag);
+
+  typedef std::function<void(GfErrType, const CacheablePtr&,
+                             const VersionTagPtr&)>
+      RemoteGetHandler;
+  typedef std::function<void(GfErrType, const VersionTagPtr&)>
+      RemoteUpdateHandler;
+  // Asynchronous variants of getNoThrow_remote() and putNoThrow_remote().
+  // They return GF_NOERR only if the handler will be invoked; regions
+  // without an asynchronous transport return GF_NOTSUP.
+  virtual GfErrType getNoThrow_remoteAsync(const CacheableKeyPtr& keyPtr,
+                                           const UserDataPtr& aCallbackArgument,
+                                           const RemoteGetHandler& handler) {
+    return GF_NOTSUP;
+  }
+  virtual GfErrType putNoThrow_remoteAsync(const CacheableKeyPtr& keyPtr,
+                                           const CacheablePtr& cvalue,
+                                           const UserDataPtr& aCallbackArgument,
+                                           const RemoteUpdateHandler& handler) {
+    return GF_NOTSUP;
+  }
+  typedef std::function<void(GfErrType)> RemoteGetAllHandler;
+  // Asynchronous variant of getAllNoThrow_remote(); the handler is invoked
+  // once the values of all the keys have been merged into values.
+  virtual GfErrType getAllNoThrow_remoteAsync(
+      const VectorOfCacheableKeyPtr& keys, const HashMapOfCacheablePtr& values,
+      bool addToLocalCache, const UserDataPtr& aCallbackArgument,
+      const RemoteGetAllHandler& handler) {
+    return GF_NOTSUP;
+  }
   virtual GfErrType putNoThrow_remote(const CacheableKeyPtr& keyPtr,
                                       const CacheablePtr& cvalue,
                                       const UserDataPtr& aCallbackArgument,
@@ -384,7 +465,8 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
       const VectorOfCacheableKey* keys, const HashMapOfCacheablePtr& values,
       const HashMapOfExceptionPtr& exceptions,
       const VectorOfCacheableKeyPtr& resultKeys, bool addToLocalCache,
-      const UserDataPtr& aCallbackArgument);
+      const UserDataPtr& aCallbackArgument,
+      const GetAllListenerPtr& listener = nullptr);
   virtual GfErrType invalidateRegionNoThrow_remote(
       const UserDataPtr& aCallbackArgument);
   virtual GfErrType destroyRegionNoThrow_remote(
@@ -444,6 +526,16 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
   PoolPtr m_attachedPool;
 
   mutable ACE_RW_Thread_Mutex m_rwLock;
+  // the handler shared by the expiry tasks of the entries, alive as long as
+  // some task refers to it
+  std::weak_ptr<EntryExpiryHandler> m_entryExpiryHandler;
+  util::concurrent::spinlock_mutex m_entryExpiryHandlerLock;
+  // gets of keys missing from the local cache, joined by concurrent gets of
+  // the same key by the same user
+  typedef SingleFlight<InFlightGetKey, std::pair<GfErrType, CacheablePtr>,
+                       InFlightGetKey::Hash, InFlightGetKey::Equal>
+      InFlightGets;
+  InFlightGets m_inFlightGets;
   void keys_internal(VectorOfCacheableKey& v);
   bool containsKey_internal(const CacheableKeyPtr& keyPtr) const;
   int removeRegion(const std::string& name);
@@ -457,16 +549,39 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
   bool invokeCacheWriterForRegionEvent(const UserDataPtr& aCallbackArgument,
                                        CacheEventFlags eventFlags,
                                        RegionEventType type);
+  GfErrType completeAsyncGet(const CacheableKeyPtr& keyPtr,
+                             CacheablePtr& value,
+                             const UserDataPtr& aCallbackArgument,
+                             const CacheablePtr& localValue, bool isLocal,
+                             int updateCount, const VersionTagPtr& versionTag,
+                             GfErrType err);
+  GfErrType completeAsyncPut(const CacheableKeyPtr& key,
+                             const CacheablePtr& value,
+                             const UserDataPtr& aCallbackArgument,
+                             int updateCount, const VersionTagPtr& versionTag,
+                             GfErrType err);
   GfErrType invokeCacheListenerForEntryEvent(
       const CacheableKeyPtr& key, CacheablePtr& oldValue,
       const CacheablePtr& newValue, const UserDataPtr& aCallbackArgument,
       CacheEventFlags eventFlags, EntryEventType type, bool isLocal = false);
+  // offers the entry event of a notification to the batch of a
+  // BatchCacheListener; returns true when the batch took it
+  virtual bool batchEntryEvent(const CacheableKeyPtr& key,
+                               const CacheablePtr& oldValue,
+                               const CacheablePtr& newValue,
+                               const UserDataPtr& aCallbackArgument,
+                               EntryEventType type) {
+    return false;
+  }
   GfErrType invokeCacheListenerForRegionEvent(
       const UserDataPtr& aCallbackArgument, CacheEventFlags eventFlags,
       RegionEventType type);
+  void updateEntriesStats();
   // functions related to expirations.
   void updateAccessAndModifiedTimeForEntry(MapEntryImplPtr& ptr, bool modified);
   void registerEntryExpiryTask(MapEntryImplPtr& entry);
+  std::shared_ptr<EntryExpiryHandler> getEntryExpiryHandler(
+      ExpirationAction::Action action, uint32_t duration);
   void subregions_internal(const bool recursive, VectorOfRegion& sr);
   void entries_internal(VectorOfRegionEntry& me, const bool recursive);
 
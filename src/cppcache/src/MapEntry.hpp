@@ -33,6 +33,7 @@
 #include "RegionInternal.hpp"
 #include "CacheableToken.hpp"
 #include "VersionStamp.hpp"
+#include "ArenaValue.hpp"
 #include <ace/OS.h>
 #include <utility>
 
@@ -190,20 +191,59 @@ class CPPCACHE_EXPORT MapEntry {
 class MapEntryImpl : public MapEntry,
                      public std::enable_shared_from_this<MapEntryImpl> {
  public:
-  virtual ~MapEntryImpl() {}
+  virtual ~MapEntryImpl() {
+    if (m_arenaHandle != ValueArena::NO_HANDLE) {
+      ArenaValue::release(m_arenaId, m_arenaHandle);
+    }
+  }
 
   inline void getKeyI(CacheableKeyPtr& result) const { result = m_key; }
 
   inline void getValueI(CacheablePtr& result) const {
     // If value is destroyed, then this returns nullptr
-    if (CacheableToken::isDestroyed(m_value)) {
+    if (m_arenaHandle != ValueArena::NO_HANDLE) {
+      result = ArenaValue::unpack(m_arenaId, m_arenaHandle, m_arenaLength);
+    } else if (CacheableToken::isDestroyed(m_value)) {
       result = nullptr;
     } else {
       result = m_value;
     }
   }
 
-  inline void setValueI(const CacheablePtr& value) { m_value = value; }
+  /**
+   * Peeks at the value without deserializing one held in an arena, for
+   * callers that only look for tokens. Returns false if getValueI() would
+   * give nullptr, and otherwise sets token to the token the entry holds or
+   * to nullptr for an actual value; arena values are never tokens.
+   */
+  inline bool peekValueI(CacheablePtr& token) const {
+    token = nullptr;
+    if (m_arenaHandle != ValueArena::NO_HANDLE) {
+      return true;
+    }
+    if (m_value == nullptr || CacheableToken::isDestroyed(m_value)) {
+      return false;
+    }
+    if (CacheableToken::isToken(m_value)) {
+      token = m_value;
+    }
+    return true;
+  }
+
+  inline void setValueI(const CacheablePtr& value) {
+    if (m_arenaHandle != ValueArena::NO_HANDLE) {
+      ArenaValue::release(m_arenaId, m_arenaHandle);
+      m_arenaHandle = ValueArena::NO_HANDLE;
+    }
+    // a packed value is kept as its arena handle rather than as an object
+    if (ArenaValue::isPacked(value) &&
+        static_cast<ArenaValue*>(value.get())
+            ->take(m_arenaId, m_arenaHandle, m_arenaLength)) {
+      m_value = nullptr;
+    } else {
+      m_value = value;
+    }
+  }
 
   virtual void getKey(CacheableKeyPtr& result) const { getKeyI(result); }
 
@@ -234,12 +274,20 @@ class MapEntryImpl : public MapEntry,
 
  protected:
   inline explicit MapEntryImpl(bool noInit)
-      : MapEntry(true), m_value(nullptr), m_key(nullptr) {}
+      : MapEntry(true),
+        m_value(nullptr),
+        m_key(nullptr),
+        m_arenaHandle(ValueArena::NO_HANDLE) {}
 
-  inline MapEntryImpl(const CacheableKeyPtr& key) : MapEntry(), m_key(key) {}
+  inline MapEntryImpl(const CacheableKeyPtr& key)
+      : MapEntry(), m_key(key), m_arenaHandle(ValueArena::NO_HANDLE) {}
 
   CacheablePtr m_value;
   CacheableKeyPtr m_key;
+  // the value of a region with arena storage, in place of m_value
+  uint32_t m_arenaHandle;
+  uint16_t m_arenaId;
+  uint16_t m_arenaLength;
 
  private:
   // disabled
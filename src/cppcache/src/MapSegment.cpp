@@ -18,7 +18,6 @@
 #include "MapEntry.hpp"
 #include "TrackedMapEntry.hpp"
 #include "RegionInternal.hpp"
-#include "TableOfPrimes.hpp"
 #include "Utils.hpp"
 #include "ThinClientPoolDM.hpp"
 #include "ThinClientRegion.hpp"
@@ -27,12 +26,14 @@
 #include "ace/Time_Value.h"
 
 #include <mutex>
-#include "util/concurrent/spinlock_mutex.hpp"
+#include "util/concurrent/passive_rw_mutex.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+using util::concurrent::shared_lock_guard;
+
 #define _VERSION_TAG_NULL_CHK \
   (versionTag != nullptr && versionTag.get() != nullptr)
 bool MapSegment::boolVal = false;
@@ -43,22 +44,25 @@ MapSegment::~MapSegment() {
 
 void MapSegment::open(RegionInternal* region, const EntryFactory* entryFactory,
                       uint32_t size, std::atomic<int32_t>* destroyTrackers,
-                      bool concurrencyChecksEnabled) {
+                      bool concurrencyChecksEnabled,
+                      std::atomic<int64_t>* tableBytes,
+                      const ValueArenaPtr& valueArena) {
   m_map = new CacheableKeyHashMap();
-  uint32_t mapSize = TableOfPrimes::nextLargerPrime(size, m_primeIndex);
-  LOGFINER("Initializing MapSegment with size %d (given size %d).", mapSize,
-           size);
-  m_map->open(mapSize);
+  m_map->setBytesCounter(tableBytes);
+  m_map->open(size);
+  LOGFINER("Initializing MapSegment with capacity %d (given size %d).",
+           static_cast<int>(m_map->capacity()), size);
   m_entryFactory = entryFactory;
   m_region = region;
   m_numDestroyTrackers = destroyTrackers;
   m_concurrencyChecksEnabled = concurrencyChecksEnabled;
+  m_valueArena = valueArena;
 }
 
 void MapSegment::close() { m_map->close(); }
 
 void MapSegment::clear() {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   m_map->unbind_all();
 }
 
@@ -73,17 +77,13 @@ GfErrType MapSegment::create(const CacheableKeyPtr& key,
   int64_t taskid = -1;
   TombstoneExpiryHandler* handler = nullptr;
   GfErrType err = GF_NOERR;
+  CacheablePtr storedValue = packValue(newValue);
   {
-    std::lock_guard<spinlock_mutex> lk(m_spinlock);
-    // if size is greater than 75 percent of prime, rehash
-    uint32_t mapSize = TableOfPrimes::getPrime(m_primeIndex);
-    if (((m_map->current_size() * 75) / 100) > mapSize) {
-      rehash();
-    }
+    std::lock_guard<passive_rw_mutex> lk(m_mapLock);
     MapEntryPtr entry;
     int status;
     if ((status = m_map->find(key, entry)) == -1) {
-      if ((err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+      if ((err = putNoEntry(key, storedValue, me, updateCount, destroyTracker,
                             versionTag)) != GF_NOERR) {
         return err;
       }
@@ -104,11 +104,11 @@ GfErrType MapSegment::create(const CacheableKeyPtr& key,
         }
         // good case; go ahead with the create
         if (oldValue == nullptr) {
-          err = putForTrackedEntry(key, newValue, entry, entryImpl, updateCount,
-                                   versionStamp);
+          err = putForTrackedEntry(key, storedValue, entry, entryImpl,
+                                   updateCount, versionStamp);
         } else {
           unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
-          err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+          err = putNoEntry(key, storedValue, me, updateCount, destroyTracker,
                            versionTag, &versionStamp);
         }
 
@@ -122,9 +122,9 @@ GfErrType MapSegment::create(const CacheableKeyPtr& key,
       }
     }
   }
-  if (taskid != -1) {
-    CacheImpl::expiryTaskManager->cancelTask(taskid);
-    if (handler != nullptr) delete handler;
+  if (taskid != -1 &&
+      CacheImpl::expiryTaskManager->cancelTask(taskid) == 0) {
+    delete handler;
   }
   return err;
 }
@@ -140,13 +140,9 @@ GfErrType MapSegment::put(const CacheableKeyPtr& key,
   int64_t taskid = -1;
   TombstoneExpiryHandler* handler = nullptr;
   GfErrType err = GF_NOERR;
+  CacheablePtr storedValue = delta == nullptr ? packValue(newValue) : newValue;
   {
-    std::lock_guard<spinlock_mutex> lk(m_spinlock);
-    // if size is greater than 75 percent of prime, rehash
-    uint32_t mapSize = TableOfPrimes::getPrime(m_primeIndex);
-    if (((m_map->current_size() * 75) / 100) > mapSize) {
-      rehash();
-    }
+    std::lock_guard<passive_rw_mutex> lk(m_mapLock);
     MapEntryPtr entry;
     int status;
     if ((status = m_map->find(key, entry)) == -1) {
@@ -155,7 +151,7 @@ GfErrType MapSegment::put(const CacheableKeyPtr& key,
       }
       // entry hence ask for full object
       isUpdate = false;
-      err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+      err = putNoEntry(key, storedValue, me, updateCount, destroyTracker,
                        versionTag);
     } else {
       MapEntryImplPtr entryImpl = entry->getImplPtr();
@@ -180,12 +176,13 @@ GfErrType MapSegment::put(const CacheableKeyPtr& key,
       }
       if (CacheableToken::isTombstone(meOldValue)) {
         unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
-        err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+        err = putNoEntry(key, storedValue, me, updateCount, destroyTracker,
                          versionTag, &versionStamp);
         meOldValue = nullptr;
         isUpdate = false;
-      } else if ((err = putForTrackedEntry(key, newValue, entry, entryImpl,
-                                           updateCount, versionStamp, delta)) ==
+      } else if ((err = putForTrackedEntry(
+                      key, delta == nullptr ? storedValue : newValue, entry,
+                      entryImpl, updateCount, versionStamp, delta)) ==
                  GF_NOERR) {
         me = entryImpl;
         oldValue = meOldValue;
@@ -193,9 +190,9 @@ GfErrType MapSegment::put(const CacheableKeyPtr& key,
       }
     }
   }
-  if (taskid != -1) {
-    CacheImpl::expiryTaskManager->cancelTask(taskid);
-    if (handler != nullptr) delete handler;
+  if (taskid != -1 &&
+      CacheImpl::expiryTaskManager->cancelTask(taskid) == 0) {
+    delete handler;
   }
   return err;
 }
@@ -203,7 +200,7 @@ GfErrType MapSegment::put(const CacheableKeyPtr& key,
 GfErrType MapSegment::invalidate(const CacheableKeyPtr& key,
                                  MapEntryImplPtr& me, CacheablePtr& oldValue,
                                  VersionTagPtr versionTag, bool& isTokenAdded) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   int status;
   isTokenAdded = false;
   GfErrType err = GF_NOERR;
@@ -328,20 +325,19 @@ GfErrType MapSegment::remove(const CacheableKeyPtr& key, CacheablePtr& oldValue,
     bool expTaskSet = false;
     GfErrType err;
     {
-      std::lock_guard<spinlock_mutex> lk(m_spinlock);
+      std::lock_guard<passive_rw_mutex> lk(m_mapLock);
       err = removeWhenConcurrencyEnabled(key, oldValue, me, updateCount,
                                          versionTag, afterRemote, isEntryFound,
                                          id, handler, expTaskSet);
     }
 
-    if (!expTaskSet) {
-      CacheImpl::expiryTaskManager->cancelTask(id);
+    if (!expTaskSet && CacheImpl::expiryTaskManager->cancelTask(id) == 0) {
       delete handler;
     }
     return err;
   }
 
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   CacheablePtr value;
   if ((status = m_map->unbind(key, entry)) == -1) {
     // didn't unbind, probably no entry...
@@ -390,7 +386,7 @@ bool MapSegment::unguardedRemoveActualEntryWithoutCancelTask(
 
 bool MapSegment::removeActualEntry(const CacheableKeyPtr& key,
                                    bool cancelTask) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   return unguardedRemoveActualEntry(key, cancelTask);
 }
 /**
@@ -398,7 +394,7 @@ bool MapSegment::removeActualEntry(const CacheableKeyPtr& key,
  */
 bool MapSegment::getEntry(const CacheableKeyPtr& key, MapEntryImplPtr& result,
                           CacheablePtr& value) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  shared_lock_guard<passive_rw_mutex> lk(m_mapLock);
   int status;
   MapEntryPtr entry;
   if ((status = m_map->find(key, entry)) == -1) {
@@ -409,12 +405,13 @@ bool MapSegment::getEntry(const CacheableKeyPtr& key, MapEntryImplPtr& result,
 
   // If the value is a tombstone return not found
   MapEntryImplPtr mePtr = entry->getImplPtr();
-  mePtr->getValueI(value);
-  if (value == nullptr || CacheableToken::isTombstone(value)) {
+  CacheablePtr token;
+  if (!mePtr->peekValueI(token) || CacheableToken::isTombstone(token)) {
     result = nullptr;
     value = nullptr;
     return false;
   }
+  mePtr->getValueI(value);
   result = mePtr;
   return true;
 }
@@ -423,31 +420,28 @@ bool MapSegment::getEntry(const CacheableKeyPtr& key, MapEntryImplPtr& result,
  * @brief return true if there exists an entry for the key.
  */
 bool MapSegment::containsKey(const CacheableKeyPtr& key) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  shared_lock_guard<passive_rw_mutex> lk(m_mapLock);
   MapEntryPtr mePtr;
   int status;
   if ((status = m_map->find(key, mePtr)) == -1) {
     return false;
   }
   // If the value is a tombstone return not found
-  CacheablePtr value;
-  MapEntryImplPtr mePtr1 = mePtr->getImplPtr();
-  mePtr1->getValueI(value);
-  if (value != nullptr && CacheableToken::isTombstone(value)) return false;
-
-  return true;
+  CacheablePtr token;
+  mePtr->getImplPtr()->peekValueI(token);
+  return !CacheableToken::isTombstone(token);
 }
 
 /**
  * @brief return the all the keys in the provided list.
  */
 void MapSegment::keys(VectorOfCacheableKey& result) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  shared_lock_guard<passive_rw_mutex> lk(m_mapLock);
   for (CacheableKeyHashMap::iterator iter = m_map->begin();
        iter != m_map->end(); iter++) {
-    CacheablePtr valuePtr;
-    (*iter).int_id_->getImplPtr()->getValueI(valuePtr);
-    if (!CacheableToken::isTombstone(valuePtr)) {
+    CacheablePtr token;
+    (*iter).int_id_->getImplPtr()->peekValueI(token);
+    if (!CacheableToken::isTombstone(token)) {
       result.push_back((*iter).ext_id_);
     }
   }
@@ -457,16 +451,16 @@ void MapSegment::keys(VectorOfCacheableKey& result) {
  * @brief return all the entries in the provided list.
  */
 void MapSegment::entries(VectorOfRegionEntry& result) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  shared_lock_guard<passive_rw_mutex> lk(m_mapLock);
   for (CacheableKeyHashMap::iterator iter = m_map->begin();
        iter != m_map->end(); iter++) {
     CacheableKeyPtr keyPtr;
-    CacheablePtr valuePtr;
+    CacheablePtr token;
     MapEntryImplPtr me = ((*iter).int_id_)->getImplPtr();
-    me->getValueI(valuePtr);
-    if (valuePtr != nullptr && !CacheableToken::isTombstone(valuePtr)) {
-      if (CacheableToken::isInvalid(valuePtr)) {
-        valuePtr = nullptr;
+    if (me->peekValueI(token) && !CacheableToken::isTombstone(token)) {
+      CacheablePtr valuePtr;
+      if (!CacheableToken::isInvalid(token)) {
+        me->getValueI(valuePtr);
       }
       me->getKeyI(keyPtr);
       RegionEntryPtr rePtr = m_region->createRegionEntry(keyPtr, valuePtr);
@@ -479,31 +473,54 @@ void MapSegment::entries(VectorOfRegionEntry& result) {
  * @brief return all values in the provided list.
  */
 void MapSegment::values(VectorOfCacheable& result) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
-  for (CacheableKeyHashMap::iterator iter = m_map->begin();
-       iter != m_map->end(); iter++) {
-    CacheablePtr valuePtr;
-    CacheableKeyPtr keyPtr;
-    MapEntryPtr entry;
-    int status;
-
-    keyPtr = (*iter).ext_id_;
-    (*iter).int_id_->getValue(valuePtr);
-    status = m_map->find(keyPtr, entry);
-
-    if (status != -1) {
-      MapEntryImplPtr entryImpl = entry->getImplPtr();
+  // positions in result of the values to read back from disk; that writes
+  // the entries, so it is done under the exclusive lock after the scan
+  std::vector<std::pair<size_t, MapEntryImplPtr>> overflowed;
+  {
+    shared_lock_guard<passive_rw_mutex> lk(m_mapLock);
+    for (CacheableKeyHashMap::iterator iter = m_map->begin();
+         iter != m_map->end(); iter++) {
+      CacheablePtr valuePtr;
+      MapEntryImplPtr entryImpl = (*iter).int_id_->getImplPtr();
+      entryImpl->getValueI(valuePtr);
       if (valuePtr != nullptr && !CacheableToken::isInvalid(valuePtr) &&
           !CacheableToken::isDestroyed(valuePtr) &&
           !CacheableToken::isTombstone(valuePtr)) {
-        if (CacheableToken::isOverflowed(valuePtr)) {  // get Value from disc.
-          valuePtr = getFromDisc(keyPtr, entryImpl);
-          entryImpl->setValueI(valuePtr);
+        if (CacheableToken::isOverflowed(valuePtr)) {
+          overflowed.push_back(std::make_pair(result.size(), entryImpl));
         }
         result.push_back(valuePtr);
       }
     }
   }
+  if (overflowed.empty()) {
+    return;
+  }
+  {
+    std::lock_guard<passive_rw_mutex> lk(m_mapLock);
+    for (auto& item : overflowed) {
+      MapEntryImplPtr& entryImpl = item.second;
+      CacheablePtr valuePtr;
+      entryImpl->getValueI(valuePtr);
+      if (CacheableToken::isOverflowed(valuePtr)) {  // get Value from disc.
+        CacheableKeyPtr keyPtr;
+        entryImpl->getKeyI(keyPtr);
+        valuePtr = getFromDisc(keyPtr, entryImpl);
+        if (valuePtr != nullptr) {
+          entryImpl->setValueI(valuePtr);
+          releaseFromDisc(keyPtr, entryImpl);
+        }
+      }
+      result[item.first] = valuePtr;
+    }
+  }
+  // drop the values that were removed between the two locks
+  for (auto item = overflowed.rbegin(); item != overflowed.rend(); ++item) {
+    const CacheablePtr& valuePtr = result[item->first];
+    if (valuePtr == nullptr || CacheableToken::isToken(valuePtr)) {
+      result.erase(result.begin() + item->first);
+    }
+  }
 }
 
 // This function will not get called if concurrency checks are enabled. The
@@ -513,7 +530,7 @@ int MapSegment::addTrackerForEntry(const CacheableKeyPtr& key,
                                    CacheablePtr& oldValue, bool addIfAbsent,
                                    bool failIfPresent, bool incUpdateCount) {
   if (m_concurrencyChecksEnabled) return -1;
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   MapEntryPtr entry;
   MapEntryPtr newEntry;
   int status;
@@ -560,7 +577,7 @@ int MapSegment::addTrackerForEntry(const CacheableKeyPtr& key,
 // changes takes care of the version and no need for tracking the entry
 void MapSegment::removeTrackerForEntry(const CacheableKeyPtr& key) {
   if (m_concurrencyChecksEnabled) return;
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   MapEntryPtr entry;
   int status;
   if ((status = m_map->find(key, entry)) != -1) {
@@ -575,7 +592,7 @@ void MapSegment::removeTrackerForEntry(const CacheableKeyPtr& key) {
 void MapSegment::addTrackerForAllEntries(
     MapOfUpdateCounters& updateCounterMap) {
   if (m_concurrencyChecksEnabled) return;
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   MapEntryPtr newEntry;
   CacheableKeyPtr key;
   for (CacheableKeyHashMap::iterator iter = m_map->begin();
@@ -594,36 +611,10 @@ void MapSegment::addTrackerForAllEntries(
 // changes takes care of the version and no need for tracking the entry
 void MapSegment::removeDestroyTracking() {
   if (m_concurrencyChecksEnabled) return;
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   m_destroyedKeys.clear();
 }
 
-/**
- * @brief replace the existing hash map with one that is wider
- *   to reduce collision chains.
- */
-void MapSegment::rehash() {  // Only called from put, segment must already be
-                             // locked...
-
-  uint32_t newMapSize = TableOfPrimes::getPrime(++m_primeIndex);
-  LOGFINER("Rehashing MapSegment to size %d.", newMapSize);
-  CacheableKeyHashMap* newMap = new CacheableKeyHashMap();
-  newMap->open(newMapSize);
-
-  // copy all entries into newMap..
-  for (CacheableKeyHashMap::iterator iter = m_map->begin();
-       iter != m_map->end(); ++iter) {
-    newMap->bind((*iter).ext_id_, (*iter).int_id_);
-  }
-
-  // plug newMap into real member.
-  CacheableKeyHashMap* oldMap = m_map;
-  m_map = newMap;
-  // clean up the old map.
-  delete oldMap;
-  m_rehashCount++;
-}
-
 CacheablePtr MapSegment::getFromDisc(CacheableKeyPtr key,
                                      MapEntryImplPtr& entryImpl) {
   LocalRegion* lregion = static_cast<LocalRegion*>(m_region);
@@ -631,6 +622,13 @@ CacheablePtr MapSegment::getFromDisc(CacheableKeyPtr key,
   return em->getFromDisk(key, entryImpl);
 }
 
+void MapSegment::releaseFromDisc(CacheableKeyPtr key,
+                                 MapEntryImplPtr& entryImpl) {
+  LocalRegion* lregion = static_cast<LocalRegion*>(m_region);
+  EntriesMap* em = lregion->getEntryMap();
+  em->releaseFromDisk(key, entryImpl);
+}
+
 GfErrType MapSegment::putForTrackedEntry(
     const CacheableKeyPtr& key, const CacheablePtr& newValue,
     MapEntryPtr& entry, MapEntryImplPtr& entryImpl, int updateCount,
@@ -711,17 +709,17 @@ GfErrType MapSegment::putForTrackedEntry(
   }
 }
 void MapSegment::reapTombstones(std::map<uint16_t, int64_t>& gcVersions) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   m_tombstoneList->reapTombstones(gcVersions);
 }
 void MapSegment::reapTombstones(CacheableHashSetPtr removedKeys) {
-  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::lock_guard<passive_rw_mutex> lk(m_mapLock);
   m_tombstoneList->reapTombstones(removedKeys);
 }
 
 GfErrType MapSegment::isTombstone(CacheableKeyPtr key, MapEntryImplPtr& me,
                                   bool& result) {
-  CacheablePtr value;
+  CacheablePtr token;
   MapEntryPtr entry;
   MapEntryImplPtr mePtr;
   if (m_map->find(key, entry) == -1) {
@@ -735,13 +733,12 @@ GfErrType MapSegment::isTombstone(CacheableKeyPtr key, MapEntryImplPtr& me,
     return GF_NOERR;
   }
 
-  mePtr->getValueI(value);
-  if (!value) {
+  if (!mePtr->peekValueI(token)) {
     result = false;
     return GF_NOERR;
   }
 
-  if (CacheableToken::isTombstone(value)) {
+  if (CacheableToken::isTombstone(token)) {
     if (m_tombstoneList->exists(key)) {
       MapEntryPtr entry;
       if (m_map->find(key, entry) != -1) {
@@ -29,8 +29,8 @@
 #include "MapWithLock.hpp"
 #include "CacheableToken.hpp"
 #include <geode/Delta.hpp>
+#include <geode/utils.hpp>
 
-#include <ace/Hash_Map_Manager.h>
 #include <ace/Functor_T.h>
 #include <ace/Null_Mutex.h>
 #include <ace/Thread_Mutex.h>
@@ -41,39 +41,23 @@
 #include "TombstoneList.hpp"
 #include <unordered_map>
 
-#include "util/concurrent/spinlock_mutex.hpp"
-
-ACE_BEGIN_VERSIONED_NAMESPACE_DECL
-
-template <>
-class ACE_Hash<apache::geode::client::CacheableKeyPtr> {
- public:
-  u_long operator()(const apache::geode::client::CacheableKeyPtr& key) {
-    return key->hashcode();
-  }
-};
-
-template <>
-class ACE_Equal_To<apache::geode::client::CacheableKeyPtr> {
- public:
-  bool operator()(const apache::geode::client::CacheableKeyPtr& key1,
-                  const apache::geode::client::CacheableKeyPtr& key2) {
-    return key1->operator==(*key2);
-  }
-};
-ACE_END_VERSIONED_NAMESPACE_DECL
+#include "OpenHashMap.hpp"
+#include "ArenaValue.hpp"
+#include "util/concurrent/passive_rw_mutex.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+using util::concurrent::passive_rw_mutex;
+
 class RegionInternal;
-typedef ::ACE_Hash_Map_Manager_Ex<
-    CacheableKeyPtr, MapEntryPtr, ::ACE_Hash<CacheableKeyPtr>,
-    ::ACE_Equal_To<CacheableKeyPtr>, ::ACE_Null_Mutex>
+typedef OpenHashMap<CacheableKeyPtr, MapEntryPtr,
+                    dereference_hash<CacheableKeyPtr>,
+                    dereference_equal_to<CacheableKeyPtr>>
     CacheableKeyHashMap;
 
-/** @brief type wrapper around the ACE map implementation. */
+/** @brief type wrapper around the open addressing map implementation. */
 class CPPCACHE_EXPORT MapSegment {
  private:
   // contain
@@ -83,9 +67,8 @@ class CPPCACHE_EXPORT MapSegment {
   const EntryFactory* m_entryFactory;
   RegionInternal* m_region;
 
-  // index of the current prime in the primes table
-  uint32_t m_primeIndex;
-  spinlock_mutex m_spinlock;
+  // held shared by the lookups and exclusively by everything else
+  passive_rw_mutex m_mapLock;
   ACE_Recursive_Thread_Mutex m_segmentMutex;
 
   bool m_concurrencyChecksEnabled;
@@ -95,10 +78,11 @@ class CPPCACHE_EXPORT MapSegment {
   std::atomic<int32_t>* m_numDestroyTrackers;
   MapOfUpdateCounters m_destroyedKeys;
 
-  uint32_t m_rehashCount;
-  void rehash();
   TombstoneListPtr m_tombstoneList;
 
+  // shared by the segments of a region with arena storage, else null
+  ValueArenaPtr m_valueArena;
+
   // increment update counter of the given entry and return true if entry
   // was rebound
   inline bool incrementUpdateCount(const CacheableKeyPtr& key,
@@ -176,6 +160,16 @@ class CPPCACHE_EXPORT MapSegment {
     return GF_NOERR;
   }
 
+  // the form of the value kept in the entry; serialized outside the lock
+  // since it is the bulk of the work. A delta received for the entry is
+  // applied to its deserialized value and put back without packing it again.
+  inline CacheablePtr packValue(const CacheablePtr& value) const {
+    if (m_valueArena == nullptr) {
+      return value;
+    }
+    return ArenaValue::pack(m_valueArena, value);
+  }
+
   GfErrType putForTrackedEntry(const CacheableKeyPtr& key,
                                const CacheablePtr& newValue, MapEntryPtr& entry,
                                MapEntryImplPtr& entryImpl, int updateCount,
@@ -183,6 +177,7 @@ class CPPCACHE_EXPORT MapSegment {
                                DataInput* delta = nullptr);
 
   CacheablePtr getFromDisc(CacheableKeyPtr key, MapEntryImplPtr& entryImpl);
+  void releaseFromDisc(CacheableKeyPtr key, MapEntryImplPtr& entryImpl);
 
   GfErrType removeWhenConcurrencyEnabled(
       const CacheableKeyPtr& key, CacheablePtr& oldValue, MapEntryImplPtr& me,
@@ -195,13 +190,11 @@ class CPPCACHE_EXPORT MapSegment {
       : m_map(nullptr),
         m_entryFactory(nullptr),
         m_region(nullptr),
-        m_primeIndex(0),
-        m_spinlock(),
+        m_mapLock(),
         m_segmentMutex(),
         m_concurrencyChecksEnabled(false),
         m_numDestroyTrackers(nullptr),
-        m_rehashCount(0)  // COVERITY  --> 30303 Uninitialized scalar field
-  {
+        m_valueArena(nullptr) {
     m_tombstoneList = std::make_shared<TombstoneList>(this);
   }
 
@@ -218,7 +211,9 @@ class CPPCACHE_EXPORT MapSegment {
    */
   void open(RegionInternal* region, const EntryFactory* entryFactory,
             uint32_t size, std::atomic<int32_t>* destroyTrackers,
-            bool concurrencyChecksEnabled);
+            bool concurrencyChecksEnabled,
+            std::atomic<int64_t>* tableBytes = nullptr,
+            const ValueArenaPtr& valueArena = nullptr);
 
   void close();
   void clear();
@@ -279,7 +274,7 @@ class CPPCACHE_EXPORT MapSegment {
    */
   void values(VectorOfCacheable& result);
 
-  inline uint32_t rehashCount() { return m_rehashCount; }
+  inline uint32_t rehashCount() { return m_map->rehashCount(); }
 
   int addTrackerForEntry(const CacheableKeyPtr& key, CacheablePtr& oldValue,
                          bool addIfAbsent, bool failIfPresent,
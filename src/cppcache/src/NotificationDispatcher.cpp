@@ -0,0 +1,173 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "NotificationDispatcher.hpp"
+#include <functional>
+#include <string>
+#include <geode/Log.hpp>
+#include "CacheImpl.hpp"
+#include "TcrEndpoint.hpp"
+#include "TcrMessage.hpp"
+
+using namespace apache::geode::client;
+
+const char* NotificationDispatcher::NC_Dispatcher = "NC Dispatcher";
+
+NotificationDispatcher::NotificationEvent::~NotificationEvent() {
+  // only set if the event was dropped without being processed
+  if (m_msg != nullptr && m_msg->isEventAckHeld()) {
+    m_endpoint->releaseEventAck(m_msg->getEventId());
+  }
+  GF_SAFE_DELETE(m_msg);
+}
+
+NotificationDispatcher::Worker::Worker(NotificationDispatcher* dispatcher)
+    : m_queue(true), m_task(nullptr), m_dispatcher(dispatcher) {}
+
+NotificationDispatcher::Worker::~Worker() { GF_SAFE_DELETE(m_task); }
+
+int NotificationDispatcher::Worker::run(volatile bool& isRunning) {
+  while (isRunning) {
+    NotificationEvent* event = m_queue.getUntil(0, 100000);
+    if (event != nullptr) {
+      m_dispatcher->process(event);
+    }
+  }
+  return 0;
+}
+
+NotificationDispatcher::NotificationDispatcher(CacheImpl* cache,
+                                               int32_t numThreads)
+    : m_cache(cache),
+      m_workers(),
+      m_running(false),
+      m_pending(0),
+      m_pendingLock(),
+      m_idleCond(m_pendingLock) {
+  for (int32_t i = 0; i < numThreads; i++) {
+    m_workers.push_back(new Worker(this));
+  }
+}
+
+NotificationDispatcher::~NotificationDispatcher() {
+  stop();
+  for (std::vector<Worker*>::iterator iter = m_workers.begin();
+       iter != m_workers.end(); ++iter) {
+    delete *iter;
+  }
+}
+
+void NotificationDispatcher::start() {
+  if (m_running) {
+    return;
+  }
+  m_running = true;
+  for (std::vector<Worker*>::iterator iter = m_workers.begin();
+       iter != m_workers.end(); ++iter) {
+    Worker* worker = *iter;
+    worker->m_queue.open();
+    worker->m_task = new Task<Worker>(worker, &Worker::run, NC_Dispatcher);
+    worker->m_task->start();
+  }
+  LOGFINE("Started %d subscription event dispatcher threads",
+          static_cast<int32_t>(m_workers.size()));
+}
+
+void NotificationDispatcher::stop() {
+  if (!m_running) {
+    return;
+  }
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+    m_running = false;
+  }
+  for (std::vector<Worker*>::iterator iter = m_workers.begin();
+       iter != m_workers.end(); ++iter) {
+    Worker* worker = *iter;
+    worker->m_task->stop();
+    GF_SAFE_DELETE(worker->m_task);
+    // events still queued at shutdown are dropped
+    m_cache->m_cacheStats->incNotificationDispatchQueueSize(
+        -static_cast<int32_t>(worker->m_queue.size()));
+    worker->m_queue.close();
+  }
+  ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+  m_pending = 0;
+  m_idleCond.broadcast();
+  LOGFINE("Stopped subscription event dispatcher threads");
+}
+
+bool NotificationDispatcher::dispatch(TcrEndpoint* endpoint, TcrMessage* msg) {
+  CacheableKeyPtr key = msg->getKey();
+  if (key == nullptr) {
+    waitForIdle();
+    return false;
+  }
+
+  std::string regionName = msg->getRegionName();
+  size_t hash = std::hash<std::string>()(regionName) * 31 +
+                static_cast<uint32_t>(key->hashcode());
+  Worker* worker = m_workers[hash % m_workers.size()];
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+    if (!m_running) {
+      return false;
+    }
+    m_pending++;
+  }
+  m_cache->m_cacheStats->incNotificationDispatchQueueSize(1);
+  NotificationEvent* event = new NotificationEvent(endpoint, msg);
+  if (!worker->m_queue.put(event)) {
+    // queue closed by a concurrent stop; the caller keeps the message
+    event->m_msg = nullptr;
+    delete event;
+    m_cache->m_cacheStats->incNotificationDispatchQueueSize(-1);
+    eventDone();
+    return false;
+  }
+  return true;
+}
+
+void NotificationDispatcher::waitForIdle() {
+  ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+  while (m_running && m_pending > 0) {
+    m_idleCond.wait();
+  }
+}
+
+void NotificationDispatcher::process(NotificationEvent* event) {
+  m_cache->m_cacheStats->incNotificationDispatchQueueSize(-1);
+  TcrMessage* msg = event->m_msg;
+  event->m_msg = nullptr;
+  try {
+    event->m_endpoint->processNotification(msg, true);
+  } catch (const Exception& ex) {
+    LOGERROR("Exception while dispatching subscription event: %s: %s",
+             ex.getName(), ex.getMessage());
+  } catch (...) {
+    LOGERROR("Unexpected exception while dispatching subscription event");
+  }
+  delete event;
+  m_cache->m_cacheStats->incNotificationsDispatched();
+  eventDone();
+}
+
+void NotificationDispatcher::eventDone() {
+  ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+  if (m_pending > 0 && --m_pending == 0) {
+    m_idleCond.broadcast();
+  }
+}
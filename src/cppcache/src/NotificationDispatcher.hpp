@@ -0,0 +1,107 @@
+#pragma once
+
+#ifndef GEODE_NOTIFICATIONDISPATCHER_H_
+#define GEODE_NOTIFICATIONDISPATCHER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/geode_globals.hpp>
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+#include <vector>
+#include "Queue.hpp"
+#include "Task.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+class TcrEndpoint;
+class TcrMessage;
+
+/**
+ * Processes subscription events on a set of worker threads instead of the
+ * endpoint receiver threads, so that a slow listener does not hold up the
+ * subscription channel.
+ *
+ * Events are hashed on region name and key to a worker, so the events for a
+ * given key are still applied in the order they were received. Events that
+ * do not carry a key (region clear or destroy) and markers are barriers: the
+ * receiver waits for every queued event to be processed and then handles
+ * them itself.
+ */
+class CPPCACHE_EXPORT NotificationDispatcher {
+ public:
+  NotificationDispatcher(CacheImpl* cache, int32_t numThreads);
+  ~NotificationDispatcher();
+
+  void start();
+  void stop();
+
+  /**
+   * Queues the event to its worker, which will then own the message.
+   * Returns false if the caller should process the event itself, either
+   * because it is a barrier or because the dispatcher is stopped.
+   */
+  bool dispatch(TcrEndpoint* endpoint, TcrMessage* msg);
+
+  /** Waits until every queued event has been processed. */
+  void waitForIdle();
+
+ private:
+  struct NotificationEvent {
+    TcrEndpoint* m_endpoint;
+    TcrMessage* m_msg;
+
+    NotificationEvent(TcrEndpoint* endpoint, TcrMessage* msg)
+        : m_endpoint(endpoint), m_msg(msg) {}
+    ~NotificationEvent();
+  };
+
+  class Worker {
+   public:
+    Worker(NotificationDispatcher* dispatcher);
+    ~Worker();
+
+    int run(volatile bool& isRunning);
+
+    Queue<NotificationEvent> m_queue;
+    Task<Worker>* m_task;
+
+   private:
+    NotificationDispatcher* m_dispatcher;
+  };
+
+  void process(NotificationEvent* event);
+  void eventDone();
+
+  static const char* NC_Dispatcher;
+
+  CacheImpl* m_cache;
+  std::vector<Worker*> m_workers;
+  volatile bool m_running;
+  int32_t m_pending;
+  ACE_Thread_Mutex m_pendingLock;
+  ACE_Condition_Thread_Mutex m_idleCond;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_NOTIFICATIONDISPATCHER_H_
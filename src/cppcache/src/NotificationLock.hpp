@@ -0,0 +1,69 @@
+#pragma once
+
+#ifndef GEODE_NOTIFICATIONLOCK_H_
+#define GEODE_NOTIFICATIONLOCK_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <ace/RW_Thread_Mutex.h>
+
+#include "TcrMessage.hpp"
+
+/**
+ * @file NotificationLock.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class NotificationLock NotificationLock.hpp
+ *
+ * Serializes the subscription events applied to a region. An event a
+ * receiver thread applies itself holds the lock exclusively, as do events
+ * that carry no key (region clear or destroy) and the release of the
+ * region. Events the NotificationDispatcher applies for a key hold it
+ * shared: the dispatcher already applies the events of a key one at a time
+ * and in order, so only events for different keys run concurrently.
+ */
+class NotificationLock {
+ public:
+  /** Acquires the lock for applying the event. */
+  void acquire(const TcrMessage& msg, bool dispatched) {
+    if (!dispatched || msg.getKeyRef() == nullptr) {
+      m_lock.acquire_write();
+    } else {
+      m_lock.acquire_read();
+    }
+  }
+
+  void acquireExclusive() { m_lock.acquire_write(); }
+
+  void release() { m_lock.release(); }
+
+ private:
+  ACE_RW_Thread_Mutex m_lock;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_NOTIFICATIONLOCK_H_
@@ -0,0 +1,402 @@
+#pragma once
+
+#ifndef GEODE_OPENHASHMAP_H_
+#define GEODE_OPENHASHMAP_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @file OpenHashMap.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class OpenHashMap OpenHashMap.hpp
+ *
+ * Hash map with open addressing and linear probing. Keys and values are
+ * stored inline in one array of slots together with the hash code of the
+ * key, so a lookup compares cached hash codes along a short run of adjacent
+ * slots and calls the equality functor only on a hash match. Removal shifts
+ * the following entries back instead of leaving tombstones.
+ *
+ * When the table is three quarters full it is doubled incrementally: the
+ * entries stay in the old table and every insert afterwards moves a few
+ * runs of them to the new one, so no single operation pays for copying the
+ * whole map. Lookups check both tables until the move is complete.
+ *
+ * The map offers the subset of the ACE_Hash_Map_Manager_Ex interface that
+ * MapSegment uses, including its return codes. It is not synchronized.
+ */
+template <typename K, typename V, typename Hash, typename Equal>
+class OpenHashMap {
+ public:
+  /** Occupied slots yield their key as ext_id_ and value as int_id_. */
+  struct Slot {
+    Slot() : m_hash(0) {}
+    // zero for an empty slot
+    uint32_t m_hash;
+    K ext_id_;
+    V int_id_;
+  };
+
+  class iterator {
+   public:
+    iterator(OpenHashMap* map, bool inOld, size_t index)
+        : m_map(map), m_inOld(inOld), m_index(index) {
+      skipEmpty();
+    }
+    Slot& operator*() const { return table()[m_index]; }
+    Slot* operator->() const { return &table()[m_index]; }
+    iterator& operator++() {
+      ++m_index;
+      skipEmpty();
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator current(*this);
+      ++*this;
+      return current;
+    }
+    bool operator==(const iterator& other) const {
+      return m_inOld == other.m_inOld && m_index == other.m_index;
+    }
+    bool operator!=(const iterator& other) const { return !(*this == other); }
+
+   private:
+    std::vector<Slot>& table() const {
+      return m_inOld ? m_map->m_oldTable : m_map->m_table;
+    }
+    void skipEmpty() {
+      while (true) {
+        std::vector<Slot>& slots = table();
+        while (m_index < slots.size() && slots[m_index].m_hash == 0) {
+          ++m_index;
+        }
+        if (m_index < slots.size() || !m_inOld) {
+          return;
+        }
+        m_inOld = false;
+        m_index = 0;
+      }
+    }
+
+    OpenHashMap* m_map;
+    bool m_inOld;
+    size_t m_index;
+  };
+
+  /** Number of old table entries moved by an insert while resizing. */
+  static const size_t MIGRATE_STEP = 16;
+
+  OpenHashMap()
+      : m_size(0), m_migrateCursor(0), m_migrated(0), m_rehashCount(0),
+        m_bytesCounter(nullptr) {}
+
+  ~OpenHashMap() { close(); }
+
+  /**
+   * Counter to which the bytes allocated for slots are added, shared by the
+   * maps of an entries map.
+   */
+  void setBytesCounter(std::atomic<int64_t>* counter) {
+    m_bytesCounter = counter;
+  }
+
+  /** Allocates room for the given number of entries. */
+  int open(size_t size) {
+    size_t capacity = 16;
+    while (capacity * 3 / 4 < size) {
+      capacity <<= 1;
+    }
+    allocate(m_table, capacity);
+    return 0;
+  }
+
+  /** Removes all entries and releases the slots. */
+  int close() {
+    release(m_table);
+    release(m_oldTable);
+    m_size = 0;
+    return 0;
+  }
+
+  /** Returns 0 and sets the value if the key is present, -1 if not. */
+  int find(const K& key, V& value) const {
+    const Slot* slot = lookup(key, hashOf(key));
+    if (slot == nullptr) {
+      return -1;
+    }
+    value = slot->int_id_;
+    return 0;
+  }
+
+  /** Adds the entry unless the key is present. Returns 0 if added, 1 if not. */
+  int bind(const K& key, const V& value) {
+    uint32_t hash = hashOf(key);
+    if (lookup(key, hash) != nullptr) {
+      return 1;
+    }
+    insert(key, value, hash);
+    return 0;
+  }
+
+  /**
+   * Replaces the value of the key or adds the entry. Returns 0 if added and
+   * 1 if replaced.
+   */
+  int rebind(const K& key, const V& value) {
+    uint32_t hash = hashOf(key);
+    Slot* slot = lookup(key, hash);
+    if (slot != nullptr) {
+      slot->int_id_ = value;
+      return 1;
+    }
+    insert(key, value, hash);
+    return 0;
+  }
+
+  /** Removes the key. Returns 0 if it was present and -1 if not. */
+  int unbind(const K& key) {
+    V value;
+    return unbind(key, value);
+  }
+
+  /** Removes the key and hands back its value. Returns -1 if absent. */
+  int unbind(const K& key, V& value) {
+    uint32_t hash = hashOf(key);
+    if (remove(m_table, key, hash, value) ||
+        (!m_oldTable.empty() && remove(m_oldTable, key, hash, value))) {
+      --m_size;
+      return 0;
+    }
+    return -1;
+  }
+
+  /** Removes all entries keeping the current capacity. */
+  int unbind_all() {
+    release(m_oldTable);
+    size_t capacity = m_table.size();
+    release(m_table);
+    allocate(m_table, capacity);
+    m_size = 0;
+    return 0;
+  }
+
+  size_t current_size() const { return m_size; }
+
+  /** Number of slots of the current table. */
+  size_t capacity() const { return m_table.size(); }
+
+  /** Number of times the table has been doubled. */
+  uint32_t rehashCount() const { return m_rehashCount; }
+
+  /** Bytes held by the slots of the map. */
+  size_t bytes() const {
+    return (m_table.capacity() + m_oldTable.capacity()) * sizeof(Slot);
+  }
+
+  /**
+   * Iteration covers the entries not yet moved out of the old table and
+   * then the current one. Replacing the value of a present key does not
+   * invalidate iterators; adding or removing entries does.
+   */
+  iterator begin() { return iterator(this, !m_oldTable.empty(), 0); }
+
+  iterator end() { return iterator(this, false, m_table.size()); }
+
+ private:
+  static uint32_t hashOf(const K& key) {
+    // spread the bits of hash codes that are often sequential
+    uint32_t hash = static_cast<uint32_t>(Hash()(key));
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash | 0x80000000;
+  }
+
+  static Slot* find(std::vector<Slot>& table, const K& key, uint32_t hash) {
+    if (table.empty()) {
+      return nullptr;
+    }
+    size_t mask = table.size() - 1;
+    for (size_t index = hash & mask; table[index].m_hash != 0;
+         index = (index + 1) & mask) {
+      Slot& slot = table[index];
+      if (slot.m_hash == hash && Equal()(slot.ext_id_, key)) {
+        return &slot;
+      }
+    }
+    return nullptr;
+  }
+
+  Slot* lookup(const K& key, uint32_t hash) const {
+    OpenHashMap* self = const_cast<OpenHashMap*>(this);
+    Slot* slot = find(self->m_table, key, hash);
+    if (slot == nullptr && !m_oldTable.empty()) {
+      slot = find(self->m_oldTable, key, hash);
+    }
+    return slot;
+  }
+
+  static void place(std::vector<Slot>& table, K&& key, V&& value,
+                    uint32_t hash) {
+    size_t mask = table.size() - 1;
+    size_t index = hash & mask;
+    while (table[index].m_hash != 0) {
+      index = (index + 1) & mask;
+    }
+    Slot& slot = table[index];
+    slot.m_hash = hash;
+    slot.ext_id_ = std::move(key);
+    slot.int_id_ = std::move(value);
+  }
+
+  void insert(const K& key, const V& value, uint32_t hash) {
+    if (m_table.empty()) {
+      open(m_size + 1);
+    } else if ((m_size + 1) > m_table.size() * 3 / 4) {
+      startResize();
+    }
+    if (!m_oldTable.empty()) {
+      migrate(MIGRATE_STEP);
+    }
+    place(m_table, K(key), V(value), hash);
+    ++m_size;
+  }
+
+  // Removes the slot at the index and shifts back the entries after it
+  // that would otherwise become unreachable.
+  static void erase(std::vector<Slot>& table, size_t hole) {
+    size_t mask = table.size() - 1;
+    size_t index = hole;
+    while (true) {
+      index = (index + 1) & mask;
+      Slot& slot = table[index];
+      if (slot.m_hash == 0) {
+        break;
+      }
+      size_t home = slot.m_hash & mask;
+      // the entry may move back if its home is not in (hole, index]
+      bool reachable = hole <= index ? (hole < home && home <= index)
+                                     : (hole < home || home <= index);
+      if (!reachable) {
+        table[hole] = std::move(slot);
+        hole = index;
+      }
+    }
+    Slot& emptied = table[hole];
+    emptied.m_hash = 0;
+    emptied.ext_id_ = K();
+    emptied.int_id_ = V();
+  }
+
+  static bool remove(std::vector<Slot>& table, const K& key, uint32_t hash,
+                     V& value) {
+    Slot* slot = find(table, key, hash);
+    if (slot == nullptr) {
+      return false;
+    }
+    value = std::move(slot->int_id_);
+    erase(table, static_cast<size_t>(slot - table.data()));
+    return true;
+  }
+
+  void startResize() {
+    if (!m_oldTable.empty()) {
+      migrate(m_oldTable.size());
+    }
+    size_t capacity = m_table.size() * 2;
+    m_oldTable.swap(m_table);
+    allocate(m_table, capacity);
+    // start after an empty slot so that no run of entries is split
+    m_migrateCursor = 0;
+    while (m_oldTable[m_migrateCursor].m_hash != 0) {
+      ++m_migrateCursor;
+    }
+    m_migrated = 0;
+    ++m_rehashCount;
+  }
+
+  // Moves at least the given number of entries from the old table, always
+  // stopping at an empty slot so the runs left behind are whole.
+  void migrate(size_t count) {
+    size_t mask = m_oldTable.size() - 1;
+    size_t moved = 0;
+    while (m_migrated < m_oldTable.size()) {
+      Slot& slot = m_oldTable[m_migrateCursor];
+      m_migrateCursor = (m_migrateCursor + 1) & mask;
+      ++m_migrated;
+      if (slot.m_hash == 0) {
+        if (moved >= count) {
+          return;
+        }
+        continue;
+      }
+      place(m_table, std::move(slot.ext_id_), std::move(slot.int_id_),
+            slot.m_hash);
+      slot.m_hash = 0;
+      slot.ext_id_ = K();
+      slot.int_id_ = V();
+      ++moved;
+    }
+    release(m_oldTable);
+  }
+
+  void allocate(std::vector<Slot>& table, size_t capacity) {
+    table.resize(capacity);
+    if (m_bytesCounter != nullptr) {
+      *m_bytesCounter += table.capacity() * sizeof(Slot);
+    }
+  }
+
+  void release(std::vector<Slot>& table) {
+    if (m_bytesCounter != nullptr) {
+      *m_bytesCounter -= table.capacity() * sizeof(Slot);
+    }
+    std::vector<Slot>().swap(table);
+  }
+
+  OpenHashMap(const OpenHashMap&);
+  OpenHashMap& operator=(const OpenHashMap&);
+
+  std::vector<Slot> m_table;
+  // the table being moved from while resizing, else empty
+  std::vector<Slot> m_oldTable;
+  size_t m_size;
+  size_t m_migrateCursor;
+  // number of old table slots visited
+  size_t m_migrated;
+  uint32_t m_rehashCount;
+  std::atomic<int64_t>* m_bytesCounter;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_OPENHASHMAP_H_
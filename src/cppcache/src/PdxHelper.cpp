@@ -35,9 +35,65 @@
 #include "CacheRegionHelper.hpp"
 #include <geode/Cache.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace apache {
 namespace geode {
 namespace client {
+
+namespace {
+/**
+ * Writers of objects without preserved data are reset and reused by the
+ * thread that serialized them. A nested object takes the next writer, so
+ * a thread keeps as many as its deepest nesting, up to MAX_WRITERS.
+ */
+class RemoteWriterStack {
+ public:
+  static const size_t MAX_WRITERS = 8;
+
+  static PdxRemoteWriterPtr acquire(DataOutput& output,
+                                    const PdxTypePtr& localPdxType,
+                                    const char* pdxClassName) {
+    std::vector<PdxRemoteWriterPtr>& writers = get();
+    PdxRemoteWriterPtr writer;
+    if (writers.empty()) {
+      writer = std::make_shared<PdxRemoteWriter>();
+    } else {
+      writer = std::move(writers.back());
+      writers.pop_back();
+    }
+    writer->reset(output, localPdxType, pdxClassName);
+    return writer;
+  }
+
+  static void release(PdxRemoteWriterPtr& writer) {
+    std::vector<PdxRemoteWriterPtr>& writers = get();
+    // toData may have kept a reference to the writer
+    if (writer.use_count() == 1 && writers.size() < MAX_WRITERS) {
+      writers.push_back(std::move(writer));
+    }
+  }
+
+ private:
+  static std::vector<PdxRemoteWriterPtr>& get() {
+    static thread_local std::vector<PdxRemoteWriterPtr> writers;
+    return writers;
+  }
+};
+
+/**
+ * Whether the fields listed by the object are laid out as in the type, as
+ * they are when the type was collected from the object's own toData.
+ */
+bool hasLayoutOf(const PdxTypePtr& pdxType,
+                 const PdxAutoSerializableBase& object) {
+  return pdxType->getTotalFields() == object.getPdxFieldCount() &&
+         pdxType->getNumberOfVarLenFields() ==
+             object.getPdxVariableLengthFieldCount();
+}
+}  // namespace
+
 uint8_t PdxHelper::PdxHeader = 8;
 
 PdxHelper::PdxHelper() {}
@@ -56,6 +112,48 @@ CacheImpl* PdxHelper::getCacheImpl() {
   return CacheRegionHelper::getCacheImpl(cache.get());
 }
 
+int32_t PdxHelper::writeAutoSerializable(DataOutput& output,
+                                         PdxAutoSerializableBase& object,
+                                         int32_t typeId) {
+  static thread_local std::vector<int32_t> cachedOffsets;
+  // borrowed so that a field writing a nested object gets its own
+  std::vector<int32_t> offsets;
+  offsets.swap(cachedOffsets);
+  offsets.clear();
+
+  int32_t startPositionOffset = output.getBufferLength();
+  output.advanceCursor(PdxHelper::PdxHeader);
+  object.writePdxFields(output, startPositionOffset + PdxHelper::PdxHeader,
+                        offsets);
+
+  // see PdxLocalWriter::calculateLenWithOffsets
+  int32_t totalOffsets =
+      offsets.empty() ? 0 : static_cast<int32_t>(offsets.size()) - 1;
+  int32_t len = output.getBufferLength() - startPositionOffset -
+                PdxHelper::PdxHeader + totalOffsets;
+  if (len > 0xff) {
+    len += (len + totalOffsets <= 0xffff) ? totalOffsets : totalOffsets * 3;
+  }
+  uint8_t* start = const_cast<uint8_t*>(output.getBuffer()) +
+                   startPositionOffset;
+  PdxHelper::writeInt32(start, len);
+  PdxHelper::writeInt32(start + 4, typeId);
+
+  // see PdxLocalWriter::writeOffsets
+  for (int i = static_cast<int>(offsets.size()) - 1; i > 0; i--) {
+    if (len <= 0xff) {
+      output.write(static_cast<uint8_t>(offsets[i]));
+    } else if (len <= 0xffff) {
+      output.writeInt(static_cast<uint16_t>(offsets[i]));
+    } else {
+      output.writeInt(static_cast<uint32_t>(offsets[i]));
+    }
+  }
+
+  cachedOffsets.swap(offsets);
+  return startPositionOffset;
+}
+
 void PdxHelper::serializePdx(DataOutput& output,
                              const PdxSerializable& pdxObject) {
   serializePdx(
@@ -130,27 +228,40 @@ void PdxHelper::serializePdx(DataOutput& output,
     // local writer.
 
     PdxRemotePreservedDataPtr pd = PdxTypeRegistry::getPreserveData(pdxObject);
-
-    // now always remotewriter as we have API Read/WriteUnreadFields
-    // so we don't know whether user has used those or not;; Can we do some
-    // trick here?
-    PdxRemoteWriterPtr prw = nullptr;
-
-    if (pd != nullptr) {
-      PdxTypePtr mergedPdxType =
-          PdxTypeRegistry::getPdxType(pd->getMergedTypeId());
-      prw = std::make_shared<PdxRemoteWriter>(output, mergedPdxType, pd);
+    auto autoObject =
+        dynamic_cast<PdxAutoSerializableBase*>(pdxObject.get());
+    int32_t startPositionOffset = 0;
+
+    if (pd == nullptr && autoObject != nullptr &&
+        hasLayoutOf(localPdxType, *autoObject)) {
+      startPositionOffset = writeAutoSerializable(output, *autoObject,
+                                                  localPdxType->getTypeId());
     } else {
-      prw = std::make_shared<PdxRemoteWriter>(output, pdxClassname);
+      // now always remotewriter as we have API Read/WriteUnreadFields
+      // so we don't know whether user has used those or not;; Can we do
+      // some trick here?
+      PdxRemoteWriterPtr prw = nullptr;
+
+      if (pd != nullptr) {
+        PdxTypePtr mergedPdxType =
+            PdxTypeRegistry::getPdxType(pd->getMergedTypeId());
+        prw = std::make_shared<PdxRemoteWriter>(output, mergedPdxType, pd);
+      } else {
+        prw = RemoteWriterStack::acquire(output, localPdxType, pdxClassname);
+      }
+      pdxObject->toData(std::dynamic_pointer_cast<PdxWriter>(prw));
+      prw->endObjectWriting();
+      startPositionOffset = prw->getStartPositionOffset();
+      if (pd == nullptr) {
+        RemoteWriterStack::release(prw);
+      }
     }
-    pdxObject->toData(std::dynamic_pointer_cast<PdxWriter>(prw));
-    prw->endObjectWriting();
 
     //[ToDo] need to write bytes for stats
     CacheImpl* cacheImpl = PdxHelper::getCacheImpl();
     if (cacheImpl != nullptr) {
-      uint8_t* stPos = const_cast<uint8_t*>(output.getBuffer()) +
-                       prw->getStartPositionOffset();
+      uint8_t* stPos =
+          const_cast<uint8_t*>(output.getBuffer()) + startPositionOffset;
       int pdxLen = PdxHelper::readInt32(stPos);
       cacheImpl->m_cacheStats->incPdxSerialization(
           pdxLen + 1 + 2 * 4);  // pdxLen + 93 DSID + len + typeID
@@ -177,7 +288,15 @@ PdxSerializablePtr PdxHelper::deserializePdx(DataInput& dataInput,
              pType->getPdxClassName(), pType->isLocal());
 
     pdxObjectptr = SerializationRegistry::getPdxType(pdxClassname);
-    if (pType->isLocal())  // local type no need to read Unread data
+    auto autoObject =
+        dynamic_cast<PdxAutoSerializableBase*>(pdxObjectptr.get());
+    if (pType->isLocal() && autoObject != nullptr &&
+        hasLayoutOf(pType, *autoObject)) {
+      // what PdxLocalReader does, without a reader
+      int32_t startPosition = dataInput.getBytesRead();
+      autoObject->readPdxFields(dataInput);
+      dataInput.reset(startPosition + length);
+    } else if (pType->isLocal())  // local type no need to read Unread data
     {
       PdxLocalReaderPtr plr =
           std::make_shared<PdxLocalReader>(dataInput, pType, length);
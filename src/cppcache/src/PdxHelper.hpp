@@ -27,6 +27,7 @@
  */
 
 #include <geode/DataOutput.hpp>
+#include <geode/PdxAutoSerializable.hpp>
 #include "EnumInfo.hpp"
 #include "PdxType.hpp"
 #include "CacheImpl.hpp"
@@ -53,6 +54,15 @@ class PdxHelper {
   static void serializePdx(DataOutput& output,
                            const PdxSerializablePtr& pdxObject);
 
+  /**
+   * Writes the object straight to output, producing the bytes a
+   * PdxLocalWriter would for the type with typeId, and returns the offset
+   * of the PDX header in output.
+   */
+  static int32_t writeAutoSerializable(DataOutput& output,
+                                       PdxAutoSerializableBase& object,
+                                       int32_t typeId);
+
   static PdxSerializablePtr deserializePdx(DataInput& dataInput,
                                            bool forceDeserialize);
 
@@ -26,6 +26,7 @@
 #include "CacheImpl.hpp"
 #include "Utils.hpp"
 #include <algorithm>
+#include <mutex>
 
 /* adongre  - Coverity II
  * CID 29255: Calling risky function (SECURE_CODING)[VERY RISKY]. Using
@@ -47,6 +48,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+using util::concurrent::spinlock_mutex;
+
 int8_t PdxInstanceImpl::m_BooleanDefaultBytes[] = {0};
 int8_t PdxInstanceImpl::m_ByteDefaultBytes[] = {0};
 int8_t PdxInstanceImpl::m_ShortDefaultBytes[] = {0, 0};
@@ -84,6 +87,7 @@ PdxInstanceImpl::PdxInstanceImpl(
   m_buffer = nullptr;
   m_bufferLength = 0;
   m_typeId = 0;
+  m_fieldOffsetsValid = false;
 
   m_pdxType->InitializeType();  // to generate static position map
 }
@@ -93,6 +97,7 @@ PdxInstanceImpl::PdxInstanceImpl() {
   m_buffer = nullptr;
   m_bufferLength = 0;
   m_typeId = 0;
+  m_fieldOffsetsValid = false;
 }
 
 void PdxInstanceImpl::writeField(PdxWriterPtr writer, const char* fieldName,
@@ -774,8 +779,10 @@ int32_t PdxInstanceImpl::hashcode() const {
 }
 
 void PdxInstanceImpl::updatePdxStream(uint8_t* newPdxStream, int len) {
+  std::lock_guard<spinlock_mutex> guard(m_fieldOffsetsLock);
   m_buffer = DataInput::getBufferCopy(newPdxStream, len);
   m_bufferLength = len;
+  m_fieldOffsetsValid = false;
 }
 
 PdxTypePtr PdxInstanceImpl::getPdxType() const {
@@ -804,32 +811,68 @@ bool PdxInstanceImpl::hasField(const char* fieldname) {
   return (pft != nullptr);
 }
 
-void PdxInstanceImpl::getField(const char* fieldname, bool& value) const {
+int32_t PdxInstanceImpl::getFieldIndex(const char* fieldname) const {
   PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
+  return pt->getFieldIndex(fieldname);
+}
 
+int32_t PdxInstanceImpl::getFieldIndexOrThrow(const char* fieldname) const {
+  PdxTypePtr pt = getPdxType();
+  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
   VERIFY_PDX_INSTANCE_FIELD_THROW;
+  return pft->getSequenceId();
+}
 
+int32_t PdxInstanceImpl::getFieldOffset(int32_t fieldIndex) const {
+  if (!m_fieldOffsetsValid.load(std::memory_order_acquire)) {
+    std::lock_guard<spinlock_mutex> guard(m_fieldOffsetsLock);
+    if (!m_fieldOffsetsValid.load(std::memory_order_relaxed)) {
+      initFieldOffsets();
+      m_fieldOffsetsValid.store(true, std::memory_order_release);
+    }
+  }
+  if (fieldIndex < 0 ||
+      fieldIndex >= static_cast<int32_t>(m_fieldOffsets.size())) {
+    char excpStr[256] = {0};
+    ACE_OS::snprintf(excpStr, 256, "PdxInstance doesn't has field index %d ",
+                     fieldIndex);
+    throw IllegalStateException(excpStr);
+  }
+  return m_fieldOffsets[fieldIndex];
+}
+
+void PdxInstanceImpl::initFieldOffsets() const {
+  m_fieldOffsets.clear();
+  if (m_buffer == nullptr) {
+    return;
+  }
+  PdxTypePtr pt = getPdxType();
+  int32_t totalFields = pt->getTotalFields();
+  m_fieldOffsets.reserve(totalFields);
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
+  for (int32_t i = 0; i < totalFields; i++) {
+    m_fieldOffsets.push_back(getOffset(dataInput, pt, i));
+  }
+}
 
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+void PdxInstanceImpl::getField(const char* fieldname, bool& value) const {
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, bool& value) const {
+  DataInput dataInput(m_buffer, m_bufferLength);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readBoolean(&value);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname,
                                signed char& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
 
+void PdxInstanceImpl::getField(int32_t fieldIndex, signed char& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   int8_t tmp = 0;
   dataInput.read(&tmp);
   value = (signed char)tmp;
@@ -837,98 +880,86 @@ void PdxInstanceImpl::getField(const char* fieldname,
 
 void PdxInstanceImpl::getField(const char* fieldname,
                                unsigned char& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
 
+void PdxInstanceImpl::getField(int32_t fieldIndex, unsigned char& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   int8_t tmp = 0;
   dataInput.read(&tmp);
   value = static_cast<unsigned char>(tmp);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, int16_t& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, int16_t& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readInt(&value);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, int32_t& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
-  DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
 
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+void PdxInstanceImpl::getField(int32_t fieldIndex, int32_t& value) const {
+  DataInput dataInput(m_buffer, m_bufferLength);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readInt(&value);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, int64_t& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, int64_t& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readInt(&value);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, float& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, float& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readFloat(&value);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, double& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, double& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readDouble(&value);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, wchar_t& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, wchar_t& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   uint16_t temp = 0;
   dataInput.readInt(&temp);
   value = static_cast<wchar_t>(temp);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, char& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, char& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   uint16_t temp = 0;
   dataInput.readInt(&temp);
   value = static_cast<char>(temp);
@@ -936,25 +967,25 @@ void PdxInstanceImpl::getField(const char* fieldname, char& value) const {
 
 void PdxInstanceImpl::getField(const char* fieldname, bool** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, bool** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readBooleanArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, signed char** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, signed char** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   int8_t* temp = nullptr;
   dataInput.readByteArray(&temp, length);
   *value = (signed char*)temp;
@@ -962,13 +993,13 @@ void PdxInstanceImpl::getField(const char* fieldname, signed char** value,
 
 void PdxInstanceImpl::getField(const char* fieldname, unsigned char** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, unsigned char** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   int8_t* temp = nullptr;
   dataInput.readByteArray(&temp, length);
   *value = reinterpret_cast<unsigned char*>(temp);
@@ -976,109 +1007,107 @@ void PdxInstanceImpl::getField(const char* fieldname, unsigned char** value,
 
 void PdxInstanceImpl::getField(const char* fieldname, int16_t** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, int16_t** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readShortArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, int32_t** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, int32_t** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readIntArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, int64_t** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, int64_t** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readLongArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, float** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, float** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readFloatArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, double** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, double** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readDoubleArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, wchar_t** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, wchar_t** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readWideCharArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, char** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, char** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readCharArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, wchar_t** value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, wchar_t** value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   wchar_t* temp = nullptr;
   dataInput.readWideString(&temp);
   *value = temp;
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, char** value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, char** value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   char* temp = nullptr;
   dataInput.readString(&temp);
   *value = temp;
@@ -1086,62 +1115,61 @@ void PdxInstanceImpl::getField(const char* fieldname, char** value) const {
 
 void PdxInstanceImpl::getField(const char* fieldname, wchar_t*** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, wchar_t*** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readWideStringArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname, char*** value,
                                int32_t& length) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, length);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, char*** value,
+                               int32_t& length) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readStringArray(value, length);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname,
                                CacheableDatePtr& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex,
+                               CacheableDatePtr& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   value = CacheableDate::create();
   value->fromData(dataInput);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname,
                                CacheablePtr& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, CacheablePtr& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readObject(value);
 }
 
 void PdxInstanceImpl::getField(const char* fieldname,
                                CacheableObjectArrayPtr& value) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex,
+                               CacheableObjectArrayPtr& value) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   value = CacheableObjectArray::create();
   value->fromData(dataInput);
 }
@@ -1149,13 +1177,14 @@ void PdxInstanceImpl::getField(const char* fieldname,
 void PdxInstanceImpl::getField(const char* fieldname, int8_t*** value,
                                int32_t& arrayLength,
                                int32_t*& elementLength) const {
-  PdxTypePtr pt = getPdxType();
-  PdxFieldTypePtr pft = pt->getPdxField(fieldname);
-  VERIFY_PDX_INSTANCE_FIELD_THROW;
+  getField(getFieldIndexOrThrow(fieldname), value, arrayLength, elementLength);
+}
+
+void PdxInstanceImpl::getField(int32_t fieldIndex, int8_t*** value,
+                               int32_t& arrayLength,
+                               int32_t*& elementLength) const {
   DataInput dataInput(m_buffer, m_bufferLength);
-  int pos = getOffset(dataInput, pt, pft->getSequenceId());
-  dataInput.reset();
-  dataInput.advanceCursor(pos);
+  dataInput.advanceCursor(getFieldOffset(fieldIndex));
   dataInput.readArrayOfByteArrays(value, arrayLength, &elementLength);
 }
 
@@ -26,8 +26,10 @@
 #include "PdxType.hpp"
 #include "PdxLocalWriter.hpp"
 #include <geode/PdxFieldTypes.hpp>
+#include <atomic>
 #include <vector>
 #include <map>
+#include "util/concurrent/spinlock_mutex.hpp"
 
 namespace apache {
 namespace geode {
@@ -424,6 +426,410 @@ class CPPCACHE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
   virtual void getField(const char* fieldname,
                         CacheableObjectArrayPtr& value) const;
 
+  /**
+   * Returns the index of the named field for the getField overloads taking
+   * a field index. Indices are shared by all the instances serialized with
+   * the same version of the PDX type, so the lookup by name can be done once
+   * for many instances.
+   * @param fieldname the name of the field
+   * @return the index of the field or -1 if PdxInstance doesn't has the
+   * named field.
+   */
+  virtual int32_t getFieldIndex(const char* fieldname) const;
+
+  /**
+   * Reads the field at the given index and set its value in bool type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with bool type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, bool& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in signed char type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with signed char type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, signed char& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in unsigned char type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with unsigned char type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, unsigned char& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in int16_t type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with int16_t type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, int16_t& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in int32_t type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with int32_t type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, int32_t& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in int64_t type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with int64_t type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, int64_t& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in float type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with float type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, float& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in double type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with double type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, double& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in wchar_t type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with wchar_t type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, wchar_t& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in char type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with char type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, char& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in bool array type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with bool array type.
+   * @param length length is set with number of bool elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, bool** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in signed char array
+   * type out param. Unlike the overload taking the field name it does not look
+   * the field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with signed char array type.
+   * @param length length is set with number of signed char elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, signed char** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in unsigned char array
+   * type out param. Unlike the overload taking the field name it does not look
+   * the field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with unsigned char array type.
+   * @param length length is set with number of unsigned char elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, unsigned char** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in int16_t array type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with int16_t array type.
+   * @param length length is set with number of int16_t elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, int16_t** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in int32_t array type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with int32_t array type.
+   * @param length length is set with number of int32_t elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, int32_t** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in int64_t array type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with int64_t array type.
+   * @param length length is set with number of int64_t elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, int64_t** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in float array type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with float array type.
+   * @param length length is set with number of float elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, float** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in double array type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with double array type.
+   * @param length length is set with number of double elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, double** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in wchar_t array type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with wchar_t array type.
+   * @param length length is set with number of wchar_t* elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, wchar_t** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in char array type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with char array type.
+   * @param length length is set with number of char* elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, char** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in wchar_t* type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with wchar_t type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, wchar_t** value) const;
+
+  /**
+   * Reads the field at the given index and set its value in char* type out
+   * param. Unlike the overload taking the field name it does not look the field
+   * up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with char* type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, char** value) const;
+
+  /**
+   * Reads the field at the given index and set its value in wchar_t* array type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with wchar_t* array type.
+   * @param length length is set with number of wchar_t** elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, wchar_t*** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in char* array type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with char* array type.
+   * @param length length is set with number of char** elements.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, char*** value,
+                        int32_t& length) const;
+
+  /**
+   * Reads the field at the given index and set its value in CacheableDatePtr
+   * type out param. Unlike the overload taking the field name it does not look
+   * the field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with CacheableDatePtr type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, CacheableDatePtr& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in array of byte
+   * arrays type out param. Unlike the overload taking the field name it does
+   * not look the field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with array of byte arrays type.
+   * @param arrayLength arrayLength is set to the number of byte arrays.
+   * @param elementLength elementLength is set to individual byte array lengths.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, int8_t*** value,
+                        int32_t& arrayLength, int32_t*& elementLength) const;
+
+  /**
+   * Reads the field at the given index and set its value in CacheablePtr type
+   * out param. Unlike the overload taking the field name it does not look the
+   * field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with CacheablePtr type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex, CacheablePtr& value) const;
+
+  /**
+   * Reads the field at the given index and set its value in
+   * CacheableObjectArrayPtr type out param. Unlike the overload taking the
+   * field name it does not look the field up.
+   * @param fieldIndex index of the field as returned by getFieldIndex.
+   * @param value value of the field to be set with CacheableObjectArrayPtr
+   * type.
+   * @throws IllegalStateException if PdxInstance doesn't has a field at
+   * fieldIndex.
+   *
+   * @see PdxInstance#getFieldIndex
+   */
+  virtual void getField(int32_t fieldIndex,
+                        CacheableObjectArrayPtr& value) const;
+
   /**
    * Set the existing named field to the given value.
    * The setField method has copy-on-write semantics.
@@ -1055,6 +1461,7 @@ class CPPCACHE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
     LOGDEBUG("PdxInstanceImpl::m_bufferLength = %d ", m_bufferLength);
     m_typeId = typeId;
     m_pdxType = nullptr;
+    m_fieldOffsetsValid = false;
   }
 
   PdxInstanceImpl(FieldVsValues fieldVsValue, PdxTypePtr pdxType);
@@ -1073,11 +1480,22 @@ class CPPCACHE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
   int m_typeId;
   PdxTypePtr m_pdxType;
   FieldVsValues m_updatedFields;
+  // positions of the fields in m_buffer indexed by sequence id, decoded from
+  // the offset table on the first getField
+  mutable std::vector<int32_t> m_fieldOffsets;
+  mutable std::atomic<bool> m_fieldOffsetsValid;
+  mutable util::concurrent::spinlock_mutex m_fieldOffsetsLock;
 
   std::vector<PdxFieldTypePtr> getIdentityPdxFields(PdxTypePtr pt) const;
 
   int getOffset(DataInput& dataInput, PdxTypePtr pt, int sequenceId) const;
 
+  int32_t getFieldIndexOrThrow(const char* fieldname) const;
+
+  int32_t getFieldOffset(int32_t fieldIndex) const;
+
+  void initFieldOffsets() const;
+
   int getRawHashCode(PdxTypePtr pt, PdxFieldTypePtr pField,
                      DataInput& dataInput) const;
 
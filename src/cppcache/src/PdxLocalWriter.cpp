@@ -118,6 +118,18 @@ void PdxLocalWriter::initialize() {
   m_dataOutput->advanceCursor(PdxHelper::PdxHeader);
 }
 
+void PdxLocalWriter::reset(DataOutput& output, const PdxTypePtr& pdxType,
+                           const char* pdxClassName) {
+  m_dataOutput = &output;
+  m_pdxType = pdxType;
+  m_offsets.clear();
+  m_currentOffsetIndex = 0;
+  m_preserveData = nullptr;
+  m_pdxClassName = pdxClassName;
+  m_domainClassName = nullptr;
+  initialize();
+}
+
 void PdxLocalWriter::addOffset() {
   // bufferLen gives lenght which has been written to DataOutput
   // m_startPositionOffset: from where pdx header length starts
@@ -61,6 +61,13 @@ class PdxLocalWriter : public PdxWriter,
 
   void initialize();
 
+  /**
+   * Prepares the writer to write another object of the type to output, as
+   * if it had just been constructed with the same arguments.
+   */
+  void reset(DataOutput& output, const PdxTypePtr& pdxType,
+             const char* pdxClassName);
+
   virtual void addOffset();
 
   virtual void endObjectWriting();
@@ -28,6 +28,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+char PdxRemoteReader::s_emptyString[1] = {static_cast<char>(0)};
+
 PdxRemoteReader::~PdxRemoteReader() {
   // TODO Auto-generated destructor stub
 }
@@ -343,8 +345,7 @@ char* PdxRemoteReader::readString(const char* fieldName) {
       return PdxLocalReader::readString(fieldName);
     }
     case -1: {
-      static char emptyString[] = {static_cast<char>(0)};
-      return emptyString;
+      return s_emptyString;
     }
     default: {
       // sequence id read field and then update
@@ -357,8 +358,7 @@ char* PdxRemoteReader::readString(const char* fieldName) {
         PdxLocalReader::resettoPdxHead();
         return retVal;
       } else {
-        static char emptyString[] = {static_cast<char>(0)};
-        return emptyString;
+        return s_emptyString;
       }
     }
   }
@@ -31,6 +31,12 @@ class PdxRemoteReader : public PdxLocalReader {
   int32_t m_currentIndex;
 
  public:
+  /**
+   * The empty string readString() returns for a field missing from the
+   * remote type. It is shared, so it must not be freed.
+   */
+  static char s_emptyString[1];
+
   PdxRemoteReader(DataInput& dataInput, PdxTypePtr remoteType, int32_t pdxLen)
       : PdxLocalReader(dataInput, remoteType, pdxLen) {
     m_currentIndex = 0;
@@ -81,6 +81,15 @@ PdxRemoteWriter::PdxRemoteWriter(DataOutput& output, const char* pdxClassName)
 
 PdxRemoteWriter::~PdxRemoteWriter() {}
 
+void PdxRemoteWriter::reset(DataOutput& output, const PdxTypePtr& localPdxType,
+                            const char* pdxClassName) {
+  PdxLocalWriter::reset(output, localPdxType, pdxClassName);
+  m_remoteTolocalMap = nullptr;
+  m_preserveDataIdx = 0;
+  m_currentDataIdx = -1;
+  m_remoteTolocalMapLength = 0;
+}
+
 void PdxRemoteWriter::endObjectWriting() {
   writePreserveData();
   // write header
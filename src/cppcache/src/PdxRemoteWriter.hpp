@@ -53,6 +53,13 @@ class PdxRemoteWriter : public PdxLocalWriter {
 
   PdxRemoteWriter(DataOutput& output, const char* pdxClassName);
 
+  /**
+   * Prepares the writer to write another object with no preserved data,
+   * whose local type the caller has already looked up.
+   */
+  void reset(DataOutput& output, const PdxTypePtr& localPdxType,
+             const char* pdxClassName);
+
   virtual void endObjectWriting();
 
   virtual bool isFieldWritingStarted();
@@ -24,6 +24,7 @@
 #include "PdxFieldType.hpp"
 #include <geode/CacheableBuiltins.hpp>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <list>
 #include <string>
@@ -37,7 +38,7 @@ namespace apache {
 namespace geode {
 namespace client {
 
-typedef std::map<std::string, PdxFieldTypePtr> NameVsPdxType;
+typedef std::unordered_map<std::string, PdxFieldTypePtr> NameVsPdxType;
 class PdxType;
 typedef std::shared_ptr<PdxType> PdxTypePtr;
 /* adongre
@@ -181,6 +182,15 @@ class PdxType : public Serializable,
     return nullptr;
   }
 
+  /** Returns the sequence id of the named field or -1 if there is none. */
+  int32_t getFieldIndex(const char* fieldName) {
+    NameVsPdxType::iterator iter = m_fieldNameVsPdxType.find(fieldName);
+    if (iter != m_fieldNameVsPdxType.end()) {
+      return (*iter).second->getSequenceId();
+    }
+    return -1;
+  }
+
   bool isLocal() const { return m_isLocal; }
 
   void setLocal(bool local) { m_isLocal = local; }
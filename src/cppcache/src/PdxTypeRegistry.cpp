@@ -24,10 +24,30 @@
 #include "PdxTypeRegistry.hpp"
 #include "SerializationRegistry.hpp"
 
+#include <cstring>
+#include <string>
+#include <utility>
+
 namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+/**
+ * Local types looked up by one thread, keyed by the address of the class
+ * name passed in. Class names are usually literals, so the address is
+ * stable; the name is kept as well to detect a reused address.
+ */
+struct LocalTypeCache {
+  static const size_t MAX_TYPES = 256;
+
+  LocalTypeCache() : m_version(0) {}
+
+  uint32_t m_version;
+  std::unordered_map<const char*, std::pair<std::string, PdxTypePtr>> m_types;
+};
+}  // namespace
+
 TypeIdVsPdxType* PdxTypeRegistry::typeIdToPdxType = nullptr;
 
 TypeIdVsPdxType* PdxTypeRegistry::remoteTypeIdToMergedPdxType = nullptr;
@@ -39,6 +59,10 @@ TypeNameVsPdxType* PdxTypeRegistry::localTypeToPdxType = nullptr;
 // *PdxTypeRegistry::preserveData = nullptr;
 PreservedHashMap PdxTypeRegistry::preserveData;
 
+std::atomic<size_t> PdxTypeRegistry::preserveDataSize(0);
+
+std::atomic<uint32_t> PdxTypeRegistry::localTypesVersion(0);
+
 CacheableHashMapPtr PdxTypeRegistry::enumToInt = nullptr;
 
 CacheableHashMapPtr PdxTypeRegistry::intToEnum = nullptr;
@@ -157,10 +181,13 @@ void PdxTypeRegistry::clear() {
     if (enumToInt != nullptr) enumToInt->clear();
 
     if (pdxTypeToTypeIdMap != nullptr) pdxTypeToTypeIdMap->clear();
+
+    ++localTypesVersion;
   }
   {
     WriteGuard guard(getPreservedDataLock());
     preserveData.clear();
+    preserveDataSize = 0;
   }
 }
 
@@ -190,15 +217,36 @@ void PdxTypeRegistry::addLocalPdxType(const char* localType,
 }
 
 PdxTypePtr PdxTypeRegistry::getLocalPdxType(const char* localType) {
-  ReadGuard guard(g_readerWriterLock);
+  static thread_local LocalTypeCache cache;
+  // read before the map so that a clear() racing with this lookup drops
+  // what gets cached below on the next call
+  uint32_t version = localTypesVersion;
+  if (cache.m_version != version) {
+    cache.m_types.clear();
+    cache.m_version = version;
+  }
+  const auto& cached = cache.m_types.find(localType);
+  if (cached != cache.m_types.end() &&
+      cached->second.first.compare(localType) == 0) {
+    return cached->second.second;
+  }
+
   PdxTypePtr localTypePtr = nullptr;
-  TypeNameVsPdxType::iterator it;
-  it = localTypeToPdxType->find(localType);
-  if (it != localTypeToPdxType->end()) {
+  {
+    ReadGuard guard(g_readerWriterLock);
+    TypeNameVsPdxType::iterator it;
+    it = localTypeToPdxType->find(localType);
+    if (it == localTypeToPdxType->end()) {
+      return nullptr;
+    }
     localTypePtr = (*it).second;
-    return localTypePtr;
   }
-  return nullptr;
+  // types are never replaced once added, so only those found are cached
+  if (cache.m_types.size() >= LocalTypeCache::MAX_TYPES) {
+    cache.m_types.clear();
+  }
+  cache.m_types[localType] = std::make_pair(localType, localTypePtr);
+  return localTypePtr;
 }
 
 void PdxTypeRegistry::setMergedType(int32_t remoteTypeId,
@@ -242,6 +290,7 @@ void PdxTypeRegistry::setPreserveData(PdxSerializablePtr obj,
         id);
     preserveData.emplace(obj, pData);
   }
+  preserveDataSize = preserveData.size();
 
   LOGDEBUG(
       "PdxTypeRegistry::setPreserveData Successfully inserted new entry in "
@@ -250,6 +299,10 @@ void PdxTypeRegistry::setPreserveData(PdxSerializablePtr obj,
 
 PdxRemotePreservedDataPtr PdxTypeRegistry::getPreserveData(
     PdxSerializablePtr pdxobj) {
+  // objects only have preserved data if they were read from a newer type
+  if (preserveDataSize == 0) {
+    return nullptr;
+  }
   ReadGuard guard(getPreservedDataLock());
   const auto& iter = preserveData.find((pdxobj));
   if (iter != preserveData.end()) {
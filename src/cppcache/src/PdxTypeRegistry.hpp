@@ -20,6 +20,7 @@
 #ifndef GEODE_PDXTYPEREGISTRY_H_
 #define GEODE_PDXTYPEREGISTRY_H_
 
+#include <atomic>
 #include <unordered_map>
 #include <map>
 
@@ -68,6 +69,9 @@ class CPPCACHE_EXPORT PdxTypeRegistry {
   // static CacheableHashMapPtr preserveData;
   static PreservedHashMap preserveData;
 
+  // size of preserveData, read without the lock by getPreserveData
+  static std::atomic<size_t> preserveDataSize;
+
   static ACE_RW_Thread_Mutex g_readerWriterLock;
 
   static ACE_RW_Thread_Mutex g_preservedDataLock;
@@ -80,6 +84,9 @@ class CPPCACHE_EXPORT PdxTypeRegistry {
 
   static CacheableHashMapPtr intToEnum;
 
+  // bumped by clear() so that threads drop their cached local types
+  static std::atomic<uint32_t> localTypesVersion;
+
  public:
   PdxTypeRegistry();
 
@@ -101,7 +108,11 @@ class CPPCACHE_EXPORT PdxTypeRegistry {
 
   static void addLocalPdxType(const char* localType, PdxTypePtr pdxType);
 
-  // newly added
+  /**
+   * Returns the local type registered for the class name, or nullptr.
+   * Types found are cached per thread by the address of the name; a lookup
+   * found in the cache does not take the registry lock.
+   */
   static PdxTypePtr getLocalPdxType(const char* localType);
 
   static void setMergedType(int32_t remoteTypeId, PdxTypePtr mergedType);
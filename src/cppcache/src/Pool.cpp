@@ -99,6 +99,13 @@ RegionServicePtr Pool::createSecureUserCache(PropertiesPtr credentials) {
 bool Pool::getPRSingleHopEnabled() const {
   return m_attrs->getPRSingleHopEnabled();
 }
+bool Pool::getMultiplexedConnections() const {
+  return m_attrs->getMultiplexedConnections();
+}
+bool Pool::getLazyDeserialization() const {
+  return m_attrs->getLazyDeserialization();
+}
+int Pool::getGetAllBatchSize() const { return m_attrs->getGetAllBatchSize(); }
 // void Pool::releaseThreadLocalConnection(){}
 
 int Pool::getPendingEventCount() const {
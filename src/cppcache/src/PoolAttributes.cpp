@@ -41,6 +41,9 @@ PoolAttributes::PoolAttributes()
       m_subsEnabled(PoolFactory::DEFAULT_SUBSCRIPTION_ENABLED),
       m_multiuserSecurityMode(PoolFactory::DEFAULT_MULTIUSER_SECURE_MODE),
       m_isPRSingleHopEnabled(PoolFactory::DEFAULT_PR_SINGLE_HOP_ENABLED),
+      m_isMultiplexedConn(PoolFactory::DEFAULT_MULTIPLEXED_CONNECTIONS),
+      m_isLazyDeserialization(PoolFactory::DEFAULT_LAZY_DESERIALIZATION),
+      m_getAllBatchSize(PoolFactory::DEFAULT_GETALL_BATCH_SIZE),
       m_serverGrp(PoolFactory::DEFAULT_SERVER_GROUP) {}
 
 PoolAttributesPtr PoolAttributes::clone() {
@@ -69,6 +72,9 @@ bool PoolAttributes::operator==(const PoolAttributes& other) const {
   if (m_subsEnabled != other.m_subsEnabled) return false;
   if (m_multiuserSecurityMode != other.m_multiuserSecurityMode) return false;
   if (m_isPRSingleHopEnabled != other.m_isPRSingleHopEnabled) return false;
+  if (m_isMultiplexedConn != other.m_isMultiplexedConn) return false;
+  if (m_isLazyDeserialization != other.m_isLazyDeserialization) return false;
+  if (m_getAllBatchSize != other.m_getAllBatchSize) return false;
 
   if (0 !=
       compareStringAttribute(const_cast<char*>(m_serverGrp.c_str()),
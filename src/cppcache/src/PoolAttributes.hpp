@@ -107,6 +107,22 @@ class PoolAttributes {
 
   void setPRSingleHopEnabled(bool enabled) { m_isPRSingleHopEnabled = enabled; }
 
+  bool getMultiplexedConnections() const { return m_isMultiplexedConn; }
+
+  void setMultiplexedConnections(bool enabled) {
+    m_isMultiplexedConn = enabled;
+  }
+
+  bool getLazyDeserialization() const { return m_isLazyDeserialization; }
+
+  void setLazyDeserialization(bool enabled) {
+    m_isLazyDeserialization = enabled;
+  }
+
+  int getGetAllBatchSize() const { return m_getAllBatchSize; }
+
+  void setGetAllBatchSize(int batchSize) { m_getAllBatchSize = batchSize; }
+
   void setSubscriptionAckInterval(int ackInterval) {
     m_subsAckInterval = ackInterval;
   }
@@ -145,6 +161,9 @@ class PoolAttributes {
   bool m_subsEnabled;
   bool m_multiuserSecurityMode;
   bool m_isPRSingleHopEnabled;
+  bool m_isMultiplexedConn;
+  bool m_isLazyDeserialization;
+  int m_getAllBatchSize;
 
   std::string m_serverGrp;
   std::vector<std::string> m_initLocList;
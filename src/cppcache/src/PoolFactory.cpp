@@ -110,6 +110,15 @@ void PoolFactory::reset() { m_attrs = PoolAttributesPtr(new PoolAttributes); }
 void PoolFactory::setPRSingleHopEnabled(bool enabled) {
   m_attrs->setPRSingleHopEnabled(enabled);
 }
+void PoolFactory::setMultiplexedConnections(bool enabled) {
+  m_attrs->setMultiplexedConnections(enabled);
+}
+void PoolFactory::setLazyDeserialization(bool enabled) {
+  m_attrs->setLazyDeserialization(enabled);
+}
+void PoolFactory::setGetAllBatchSize(int batchSize) {
+  m_attrs->setGetAllBatchSize(batchSize);
+}
 
 PoolPtr PoolFactory::create(const char* name) {
   ThinClientPoolDMPtr poolDM;
@@ -145,9 +145,23 @@ StatisticsType* PoolStatType::getStatType() {
     m_stats[26] = factory->createLongCounter(
         "queryExecutionTime",
         "Total time spent while processing queryExecution", "nanoseconds");
+    m_stats[27] = factory->createLongCounter(
+        "connectionCheckouts",
+        "Total number of times a pool connection was checked out.",
+        "checkouts");
+    m_stats[28] = factory->createLongCounter(
+        "idleListCheckouts",
+        "Total number of checkouts served from a server's idle connection list "
+        "without taking the pool lock.",
+        "checkouts");
+    m_stats[29] = factory->createLongCounter(
+        "connectionCheckoutTime",
+        "Total time (nanoseconds) spent checking out pool connections, "
+        "including waits and connection creation.",
+        "nanoseconds");
 
     statsType = factory->createType("PoolStatistics",
-                                    "Statistics for this pool", m_stats, 27);
+                                    "Statistics for this pool", m_stats, 30);
 
     m_locatorsId = statsType->nameToId("locators");
     m_serversId = statsType->nameToId("servers");
@@ -178,6 +192,9 @@ StatisticsType* PoolStatType::getStatType() {
         statsType->nameToId("processedDeltaMessagesTime");
     m_queryExecutionsId = statsType->nameToId("queryExecutions");
     m_queryExecutionTimeId = statsType->nameToId("queryExecutionTime");
+    m_connectionCheckoutsId = statsType->nameToId("connectionCheckouts");
+    m_idleListCheckoutsId = statsType->nameToId("idleListCheckouts");
+    m_connectionCheckoutTimeId = statsType->nameToId("connectionCheckoutTime");
   }
 
   return statsType;
@@ -218,7 +235,10 @@ PoolStatType::PoolStatType()
       m_deltaMessageFailuresId(0),
       m_processedDeltaMessagesTimeId(0),
       m_queryExecutionsId(0),
-      m_queryExecutionTimeId(0) {
+      m_queryExecutionTimeId(0),
+      m_connectionCheckoutsId(0),
+      m_idleListCheckoutsId(0),
+      m_connectionCheckoutTimeId(0) {
   memset(m_stats, 0, sizeof(m_stats));
 }
 
@@ -263,6 +283,9 @@ PoolStats::PoolStats(const char* poolName) {
       poolStatType->getProcessedDeltaMessagesTimeId();
   m_queryExecutionsId = poolStatType->getQueryExecutionId();
   m_queryExecutionTimeId = poolStatType->getQueryExecutionTimeId();
+  m_connectionCheckoutsId = poolStatType->getConnectionCheckoutsId();
+  m_idleListCheckoutsId = poolStatType->getIdleListCheckoutsId();
+  m_connectionCheckoutTimeId = poolStatType->getConnectionCheckoutTimeId();
   getStats()->setInt(m_locatorsId, 0);
   getStats()->setInt(m_serversId, 0);
   getStats()->setInt(m_subsServsId, 0);
@@ -290,6 +313,9 @@ PoolStats::PoolStats(const char* poolName) {
   getStats()->setInt(m_processedDeltaMessagesTimeId, 0);
   getStats()->setInt(m_queryExecutionsId, 0);
   getStats()->setLong(m_queryExecutionTimeId, 0);
+  getStats()->setLong(m_connectionCheckoutsId, 0);
+  getStats()->setLong(m_idleListCheckoutsId, 0);
+  getStats()->setLong(m_connectionCheckoutTimeId, 0);
 
   StatisticsManager::getExistingInstance()->forceSample();
 }
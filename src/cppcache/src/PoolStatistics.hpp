@@ -144,6 +144,12 @@ class PoolStats {
   void incQueryExecutionTimeId(int64_t value) {  // counter
     getStats()->incLong(m_queryExecutionTimeId, value);
   }
+  void incConnectionCheckouts() {  // counter
+    getStats()->incLong(m_connectionCheckoutsId, 1);
+  }
+  void incIdleListCheckouts() {  // counter
+    getStats()->incLong(m_idleListCheckoutsId, 1);
+  }
   inline apache::geode::statistics::Statistics* getStats() {
     return m_poolStats;
   }
@@ -179,6 +185,9 @@ class PoolStats {
   int32_t m_processedDeltaMessagesTimeId;
   int32_t m_queryExecutionsId;
   int32_t m_queryExecutionTimeId;
+  int32_t m_connectionCheckoutsId;
+  int32_t m_idleListCheckoutsId;
+  int32_t m_connectionCheckoutTimeId;
 };
 
 class PoolStatType {
@@ -196,7 +205,7 @@ class PoolStatType {
 
  private:
   PoolStatType();
-  statistics::StatisticDescriptor* m_stats[27];
+  statistics::StatisticDescriptor* m_stats[30];
 
   int32_t m_locatorsId;
   int32_t m_serversId;
@@ -225,6 +234,9 @@ class PoolStatType {
   int32_t m_processedDeltaMessagesTimeId;
   int32_t m_queryExecutionsId;
   int32_t m_queryExecutionTimeId;
+  int32_t m_connectionCheckoutsId;
+  int32_t m_idleListCheckoutsId;
+  int32_t m_connectionCheckoutTimeId;
 
  public:
   int32_t getLocatorsId() { return m_locatorsId; }
@@ -265,6 +277,9 @@ class PoolStatType {
   }
   int32_t getQueryExecutionId() { return m_queryExecutionsId; }
   int32_t getQueryExecutionTimeId() { return m_queryExecutionTimeId; }
+  int32_t getConnectionCheckoutsId() { return m_connectionCheckoutsId; }
+  int32_t getIdleListCheckoutsId() { return m_idleListCheckoutsId; }
+  int32_t getConnectionCheckoutTimeId() { return m_connectionCheckoutTimeId; }
 };
 }  // namespace client
 }  // namespace geode
@@ -338,6 +338,18 @@ class CPPCACHE_EXPORT ProxyRegion : public Region {
     return get(createKey(key), callbackArg);
   }
 
+  /**
+   * Multiuser pools cannot multiplex requests, so this is served
+   * synchronously.
+   * @see Region::getAsync
+   */
+  virtual std::future<CacheablePtr> getAsync(
+      const CacheableKeyPtr& key,
+      const UserDataPtr& aCallbackArgument = nullptr) {
+    GuardUserAttribures gua(m_proxyCache);
+    return m_realRegion->getAsync(key, aCallbackArgument);
+  }
+
   /** Places a new value into an entry in this region with the specified key,
    * providing a user-defined parameter
    * object to any <code>CacheWriter</code> invoked in the process.
@@ -386,6 +398,18 @@ class CPPCACHE_EXPORT ProxyRegion : public Region {
     return m_realRegion->put(key, value, aCallbackArgument);
   }
 
+  /**
+   * Multiuser pools cannot multiplex requests, so this is served
+   * synchronously.
+   * @see Region::putAsync
+   */
+  virtual std::future<void> putAsync(
+      const CacheableKeyPtr& key, const CacheablePtr& value,
+      const UserDataPtr& aCallbackArgument = nullptr) {
+    GuardUserAttribures gua(m_proxyCache);
+    return m_realRegion->putAsync(key, value, aCallbackArgument);
+  }
+
   /** Convenience method allowing both key and value to be a const char* */
   template <class KEYTYPE, class VALUETYPE>
   inline void put(const KEYTYPE& key, const VALUETYPE& value,
@@ -1368,6 +1392,29 @@ class CPPCACHE_EXPORT ProxyRegion : public Region {
                          aCallbackArgument);
   }
 
+  /**
+   * @see Region::getAll
+   */
+  virtual void getAll(const VectorOfCacheableKey& keys,
+                      const GetAllListenerPtr& listener,
+                      bool addToLocalCache = false,
+                      const UserDataPtr& aCallbackArgument = nullptr) {
+    GuardUserAttribures gua(m_proxyCache);
+    m_realRegion->getAll(keys, listener, false, aCallbackArgument);
+  }
+
+  /**
+   * Multiuser pools cannot multiplex requests, so this is served
+   * synchronously.
+   * @see Region::getAllAsync
+   */
+  virtual std::future<HashMapOfCacheablePtr> getAllAsync(
+      const VectorOfCacheableKey& keys,
+      const UserDataPtr& aCallbackArgument = nullptr) {
+    GuardUserAttribures gua(m_proxyCache);
+    return m_realRegion->getAllAsync(keys, aCallbackArgument);
+  }
+
   /**
    * Executes the query on the server based on the predicate.
    * Valid only for a Native Client region.
@@ -0,0 +1,120 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ReceiveBufferPool.hpp"
+#include <mutex>
+
+using namespace apache::geode::client;
+using apache::geode::util::concurrent::spinlock_mutex;
+
+namespace {
+// Every buffer is preceded by a header holding its size class, padded so
+// that the returned pointer keeps the alignment of the allocation.
+const size_t HEADER_SIZE = 16;
+const int32_t UNPOOLED = -1;
+
+inline int32_t& sizeClassOf(char* block) {
+  return *reinterpret_cast<int32_t*>(block);
+}
+}  // namespace
+
+const size_t ReceiveBufferPool::MIN_SIZE_CLASS;
+const size_t ReceiveBufferPool::MAX_SIZE_CLASS;
+const size_t ReceiveBufferPool::MAX_CACHED_BYTES_PER_CLASS;
+
+ReceiveBufferPool& ReceiveBufferPool::getInstance() {
+  // never destroyed so that buffers still in flight at exit can be released
+  static ReceiveBufferPool* instance = new ReceiveBufferPool();
+  return *instance;
+}
+
+int ReceiveBufferPool::sizeClassFor(size_t size) {
+  if (size > MAX_SIZE_CLASS) {
+    return UNPOOLED;
+  }
+  int sizeClass = 0;
+  while (classSize(sizeClass) < size) {
+    sizeClass++;
+  }
+  return sizeClass;
+}
+
+char* ReceiveBufferPool::allocate(size_t size) {
+  int sizeClass = sizeClassFor(size);
+  char* block = nullptr;
+  if (sizeClass == UNPOOLED) {
+    block = new char[HEADER_SIZE + size];
+  } else {
+    SizeClass& sc = getInstance().m_classes[sizeClass];
+    {
+      std::lock_guard<spinlock_mutex> guard(sc.m_lock);
+      if (!sc.m_free.empty()) {
+        block = sc.m_free.back();
+        sc.m_free.pop_back();
+      }
+    }
+    if (block == nullptr) {
+      block = new char[HEADER_SIZE + classSize(sizeClass)];
+    }
+  }
+  sizeClassOf(block) = sizeClass;
+  return block + HEADER_SIZE;
+}
+
+void ReceiveBufferPool::release(const void* buffer) {
+  if (buffer == nullptr) {
+    return;
+  }
+  char* block =
+      const_cast<char*>(static_cast<const char*>(buffer)) - HEADER_SIZE;
+  int sizeClass = sizeClassOf(block);
+  if (sizeClass != UNPOOLED) {
+    SizeClass& sc = getInstance().m_classes[sizeClass];
+    size_t maxCached = MAX_CACHED_BYTES_PER_CLASS / classSize(sizeClass);
+    std::lock_guard<spinlock_mutex> guard(sc.m_lock);
+    if (sc.m_free.size() < maxCached) {
+      sc.m_free.push_back(block);
+      return;
+    }
+  }
+  delete[] block;
+}
+
+size_t ReceiveBufferPool::getCachedBytes() {
+  ReceiveBufferPool& pool = getInstance();
+  size_t cached = 0;
+  for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+    std::lock_guard<spinlock_mutex> guard(pool.m_classes[i].m_lock);
+    cached += pool.m_classes[i].m_free.size() * classSize(i);
+  }
+  return cached;
+}
+
+void ReceiveBufferPool::clear() {
+  ReceiveBufferPool& pool = getInstance();
+  for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+    std::vector<char*> blocks;
+    {
+      std::lock_guard<spinlock_mutex> guard(pool.m_classes[i].m_lock);
+      blocks.swap(pool.m_classes[i].m_free);
+    }
+    for (std::vector<char*>::iterator iter = blocks.begin();
+         iter != blocks.end(); ++iter) {
+      char* block = *iter;
+      delete[] block;
+    }
+  }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#ifndef GEODE_RECEIVEBUFFERPOOL_H_
+#define GEODE_RECEIVEBUFFERPOOL_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <vector>
+#include <geode/geode_globals.hpp>
+#include "NonCopyable.hpp"
+#include "util/concurrent/spinlock_mutex.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Pool of buffers that messages and message chunks are read into from the
+ * server connections.
+ *
+ * Buffers are grouped in power of two size classes, each with its own free
+ * list, so replies of similar size reuse the same memory instead of going
+ * through the allocator for every message. Requests larger than the biggest
+ * size class are allocated and freed directly. Every buffer returned by
+ * allocate() must be given back with release(), never with delete[].
+ */
+class CPPCACHE_EXPORT ReceiveBufferPool : private NonCopyable,
+                                          private NonAssignable {
+ public:
+  static const size_t MIN_SIZE_CLASS = 256;
+  static const size_t MAX_SIZE_CLASS = 1024 * 1024;
+  /** Upper bound on the free memory cached by a single size class. */
+  static const size_t MAX_CACHED_BYTES_PER_CLASS = 4 * 1024 * 1024;
+
+  /** Returns a buffer of at least size bytes. */
+  static char* allocate(size_t size);
+
+  /** Returns a buffer obtained from allocate(); nullptr is ignored. */
+  static void release(const void* buffer);
+
+  /** Bytes currently held in the free lists. */
+  static size_t getCachedBytes();
+
+  /** Frees every cached buffer. */
+  static void clear();
+
+ private:
+  struct SizeClass {
+    util::concurrent::spinlock_mutex m_lock;
+    std::vector<char*> m_free;
+  };
+
+  static const int NUM_SIZE_CLASSES = 13;  // 256 bytes to 1 MB
+
+  ReceiveBufferPool() {}
+
+  static ReceiveBufferPool& getInstance();
+  static int sizeClassFor(size_t size);
+  static size_t classSize(int sizeClass) { return MIN_SIZE_CLASS << sizeClass; }
+
+  SizeClass m_classes[NUM_SIZE_CLASSES];
+};
+
+/**
+ * Releases a receive buffer when going out of scope, in the manner of
+ * DeleteArray.
+ */
+template <typename T>
+class ReleaseReceiveBuffer {
+ private:
+  T*& m_p;
+  bool m_cond;
+
+ public:
+  ReleaseReceiveBuffer(T*& p) : m_p(p), m_cond(true) {}
+
+  inline void noDelete() { m_cond = false; }
+
+  ~ReleaseReceiveBuffer() {
+    if (m_cond) {
+      ReceiveBufferPool::release(m_p);
+      m_p = nullptr;
+    }
+  }
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_RECEIVEBUFFERPOOL_H_
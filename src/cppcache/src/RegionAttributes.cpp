@@ -66,6 +66,7 @@ RegionAttributes::RegionAttributes()
       m_persistenceManager(nullptr),
       m_poolName(nullptr),
       m_isClonable(false),
+      m_isArenaStorageEnabled(false),
       m_isConcurrencyChecksEnabled(true) {}
 
 RegionAttributes::RegionAttributes(const RegionAttributes& rhs)
@@ -96,6 +97,7 @@ RegionAttributes::RegionAttributes(const RegionAttributes& rhs)
       m_persistenceProperties(rhs.m_persistenceProperties),
       m_persistenceManager(rhs.m_persistenceManager),
       m_isClonable(rhs.m_isClonable),
+      m_isArenaStorageEnabled(rhs.m_isArenaStorageEnabled),
       m_isConcurrencyChecksEnabled(rhs.m_isConcurrencyChecksEnabled) {
   if (rhs.m_cacheLoaderLibrary != nullptr) {
     size_t len = strlen(rhs.m_cacheLoaderLibrary) + 1;
@@ -745,6 +747,10 @@ void RegionAttributes::setCloningEnabled(bool isClonable) {
   m_isClonable = isClonable;
 }
 
+void RegionAttributes::setArenaStorageEnabled(bool enable) {
+  m_isArenaStorageEnabled = enable;
+}
+
 void RegionAttributes::setConcurrencyChecksEnabled(bool enable) {
   m_isConcurrencyChecksEnabled = enable;
 }
@@ -210,6 +210,11 @@ RegionFactoryPtr RegionFactory::setCloningEnabled(bool isClonable) {
   m_attributeFactory->setCloningEnabled(isClonable);
   return shared_from_this();
 }
+
+RegionFactoryPtr RegionFactory::setArenaStorageEnabled(bool enable) {
+  m_attributeFactory->setArenaStorageEnabled(enable);
+  return shared_from_this();
+}
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -164,7 +164,9 @@ class RegionInternal : public Region {
                                   const HashMapOfCacheablePtr& values,
                                   const HashMapOfExceptionPtr& exceptions,
                                   bool addToLocalCache,
-                                  const UserDataPtr& aCallbackArgument) = 0;
+                                  const UserDataPtr& aCallbackArgument,
+                                  const GetAllListenerPtr& listener =
+                                      nullptr) = 0;
   virtual GfErrType putNoThrow(const CacheableKeyPtr& key,
                                const CacheablePtr& value,
                                const UserDataPtr& aCallbackArgument,
@@ -227,6 +229,7 @@ class RegionInternal : public Region {
   virtual bool cacheEnabled() = 0;
   virtual bool isDestroyed() const = 0;
   virtual void evict(int32_t percentage) = 0;
+  virtual int64_t getHeapLRUSize() = 0;
   virtual CacheImpl* getCacheImpl() const = 0;
   virtual TombstoneListPtr getTombstoneList();
 
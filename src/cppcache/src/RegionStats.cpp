@@ -156,7 +156,21 @@ StatisticsType* RegionStatType::getStatType() {
         "removeAllTime",
         "Total time spent doing removeAlls operations for this region",
         "Nanoseconds", !largerIsBetter);
-    statsType = factory->createType(statsName, statsDesc, m_stats, 25);
+    m_stats[25] = factory->createIntGauge(
+        "tableBytesPerEntry",
+        "The bytes held by the entries table of this region per cache entry",
+        "bytes", !largerIsBetter);
+    m_stats[26] = factory->createLongGauge(
+        "heapLRUSize",
+        "The estimated bytes of heap held by the keys and values of this "
+        "region, as counted for heap LRU eviction",
+        "bytes", !largerIsBetter);
+    m_stats[27] = factory->createIntCounter(
+        "coalescedGets",
+        "The total number of gets for this region that missed the cache and "
+        "waited for the reply to the same key requested by another thread",
+        "entries", largerIsBetter);
+    statsType = factory->createType(statsName, statsDesc, m_stats, 28);
   }
 
   m_destroysId = statsType->nameToId("destroys");
@@ -185,6 +199,9 @@ StatisticsType* RegionStatType::getStatType() {
       statsType->nameToId("cacheListenerCallsCompleted");
   m_ListenerCallTimeId = statsType->nameToId("cacheListenerCallTime");
   m_clearsId = statsType->nameToId("clears");
+  m_tableBytesPerEntryId = statsType->nameToId("tableBytesPerEntry");
+  m_heapLRUSizeId = statsType->nameToId("heapLRUSize");
+  m_coalescedGetsId = statsType->nameToId("coalescedGets");
 
   return statsType;
 }
@@ -222,7 +239,10 @@ RegionStatType::RegionStatType()
       m_WriterCallTimeId(0),
       m_ListenerCallsCompletedId(0),
       m_ListenerCallTimeId(0),
-      m_clearsId(0) {}
+      m_clearsId(0),
+      m_tableBytesPerEntryId(0),
+      m_heapLRUSizeId(0),
+      m_coalescedGetsId(0) {}
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -267,6 +287,9 @@ RegionStats::RegionStats(const char* regionName) {
   m_ListenerCallsCompletedId = regStatType->getListenerCallsCompletedId();
   m_ListenerCallTimeId = regStatType->getListenerCallTimeId();
   m_clearsId = regStatType->getClearsId();
+  m_tableBytesPerEntryId = regStatType->getTableBytesPerEntryId();
+  m_heapLRUSizeId = regStatType->getHeapLRUSizeId();
+  m_coalescedGetsId = regStatType->getCoalescedGetsId();
 
   m_regionStats->setInt(m_destroysId, 0);
   m_regionStats->setInt(m_createsId, 0);
@@ -293,6 +316,9 @@ RegionStats::RegionStats(const char* regionName) {
   m_regionStats->setInt(m_ListenerCallsCompletedId, 0);
   m_regionStats->setInt(m_ListenerCallTimeId, 0);
   m_regionStats->setInt(m_clearsId, 0);
+  m_regionStats->setInt(m_tableBytesPerEntryId, 0);
+  m_regionStats->setLong(m_heapLRUSizeId, 0);
+  m_regionStats->setInt(m_coalescedGetsId, 0);
 }
 
 RegionStats::~RegionStats() {
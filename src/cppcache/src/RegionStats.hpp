@@ -62,6 +62,10 @@ class CPPCACHE_EXPORT RegionStats {
 
   inline void incMisses() { m_regionStats->incInt(m_missesId, 1); }
 
+  inline void incCoalescedGets() {
+    m_regionStats->incInt(m_coalescedGetsId, 1);
+  }
+
   inline void incOverflows() { m_regionStats->incInt(m_overflowsId, 1); }
 
   inline void incRetrieves() { m_regionStats->incInt(m_retrievesId, 1); }
@@ -74,6 +78,20 @@ class CPPCACHE_EXPORT RegionStats {
     m_regionStats->setInt(m_entriesId, entries);
   }
 
+  inline void setTableBytesPerEntry(int32_t bytes) {
+    m_regionStats->setInt(m_tableBytesPerEntryId, bytes);
+  }
+
+  inline void setHeapLRUSize(int64_t bytes) {
+    m_regionStats->setLong(m_heapLRUSizeId, bytes);
+  }
+
+  // gets and puts so far; wraps around like the counters do
+  inline uint32_t getAccesses() {
+    return static_cast<uint32_t>(m_regionStats->getInt(m_getsId)) +
+           static_cast<uint32_t>(m_regionStats->getInt(m_putsId));
+  }
+
   inline void incLoaderCallsCompleted() {
     m_regionStats->incInt(m_LoaderCallsCompletedId, 1);
   }
@@ -120,6 +138,9 @@ class CPPCACHE_EXPORT RegionStats {
   int32_t m_ListenerCallsCompletedId;
   int32_t m_ListenerCallTimeId;
   int32_t m_clearsId;
+  int32_t m_tableBytesPerEntryId;
+  int32_t m_heapLRUSizeId;
+  int32_t m_coalescedGetsId;
 };
 
 class RegionStatType {
@@ -137,7 +158,7 @@ class RegionStatType {
 
  private:
   RegionStatType();
-  statistics::StatisticDescriptor* m_stats[25];
+  statistics::StatisticDescriptor* m_stats[28];
 
   int32_t m_destroysId;
   int32_t m_createsId;
@@ -164,6 +185,9 @@ class RegionStatType {
   int32_t m_ListenerCallsCompletedId;
   int32_t m_ListenerCallTimeId;
   int32_t m_clearsId;
+  int32_t m_tableBytesPerEntryId;
+  int32_t m_heapLRUSizeId;
+  int32_t m_coalescedGetsId;
 
  public:
   inline int32_t getDestroysId() { return m_destroysId; }
@@ -221,6 +245,12 @@ class RegionStatType {
   inline int32_t getListenerCallTimeId() { return m_ListenerCallTimeId; }
 
   inline int32_t getClearsId() { return m_clearsId; }
+
+  inline int32_t getTableBytesPerEntryId() { return m_tableBytesPerEntryId; }
+
+  inline int32_t getHeapLRUSizeId() { return m_heapLRUSizeId; }
+
+  inline int32_t getCoalescedGetsId() { return m_coalescedGetsId; }
 };
 }  // namespace client
 }  // namespace geode
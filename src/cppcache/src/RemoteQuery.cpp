@@ -54,9 +54,24 @@ SelectResultsPtr RemoteQuery::execute(CacheableVectorPtr paramList,
   return execute(timeout, "Query::execute", m_tccdm, paramList);
 }
 
-SelectResultsPtr RemoteQuery::execute(uint32_t timeout, const char* func,
-                                      ThinClientBaseDM* tcdm,
-                                      CacheableVectorPtr paramList) {
+ColumnarStructSetPtr RemoteQuery::executeColumnar(uint32_t timeout) {
+  return executeColumnar(nullptr, timeout);
+}
+
+ColumnarStructSetPtr RemoteQuery::executeColumnar(CacheableVectorPtr paramList,
+                                                  uint32_t timeout) {
+  GuardUserAttribures gua;
+  if (m_proxyCache != nullptr) {
+    gua.setProxyCache(m_proxyCache);
+  }
+  auto columns = std::make_shared<ColumnarStructSetImpl>();
+  execute(timeout, "Query::executeColumnar", m_tccdm, paramList, columns);
+  return columns;
+}
+
+SelectResultsPtr RemoteQuery::execute(
+    uint32_t timeout, const char* func, ThinClientBaseDM* tcdm,
+    CacheableVectorPtr paramList, const ColumnarStructSetImplPtr& columns) {
   if ((timeout * 1000) >= 0x7fffffff) {
     char exMsg[1024];
     ACE_OS::snprintf(exMsg, 1023,
@@ -72,7 +87,8 @@ SelectResultsPtr RemoteQuery::execute(uint32_t timeout, const char* func,
   /*get the start time for QueryExecutionTime stat*/
   int64_t sampleStartNanos = Utils::startStatOpTime();
   TcrMessageReply reply(true, tcdm);
-  ChunkedQueryResponse* resultCollector = (new ChunkedQueryResponse(reply));
+  ChunkedQueryResponse* resultCollector =
+      (new ChunkedQueryResponse(reply, columns));
   reply.setChunkedResultHandler(
       static_cast<TcrChunkedResult*>(resultCollector));
   GfErrType err = executeNoThrow(timeout, reply, func, tcdm, paramList);
@@ -85,7 +101,19 @@ SelectResultsPtr RemoteQuery::execute(uint32_t timeout, const char* func,
   const std::vector<CacheableStringPtr>& fieldNameVec =
       resultCollector->getStructFieldNames();
   size_t sizeOfFieldNamesVec = fieldNameVec.size();
-  if (sizeOfFieldNamesVec == 0) {
+  if (columns != nullptr) {
+    columns->setFieldNames(fieldNameVec);
+    if (!columns->isComplete()) {
+      char exMsg[1024];
+      ACE_OS::snprintf(exMsg, 1023,
+                       "%s: Number of values coming from "
+                       "server has to be exactly divisible by field count",
+                       func);
+      throw MessageException(exMsg);
+    }
+    LOGFINEST("%s: created ColumnarStructSet with %d rows for query: %s",
+              func, columns->size(), m_queryString.c_str());
+  } else if (sizeOfFieldNamesVec == 0) {
     LOGFINEST("%s: creating ResultSet for query: %s", func,
               m_queryString.c_str());
     sr = std::make_shared<ResultSetImpl>(values);
@@ -32,6 +32,7 @@
 #include "CacheImpl.hpp"
 #include "ThinClientBaseDM.hpp"
 #include "ProxyCache.hpp"
+#include "ColumnarStructSetImpl.hpp"
 #include <string>
 
 /**
@@ -62,11 +63,20 @@ class CPPCACHE_EXPORT RemoteQuery : public Query {
   SelectResultsPtr execute(CacheableVectorPtr paramList = nullptr,
                            uint32_t timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
 
+  ColumnarStructSetPtr executeColumnar(
+      uint32_t timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
+
+  ColumnarStructSetPtr executeColumnar(
+      CacheableVectorPtr paramList,
+      uint32_t timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
+
   // executes a query using a given distribution manager
   // used by Region.query() and Region.getAll()
+  // the values are decoded into columns, and nullptr is returned, if
+  // columns is given
   SelectResultsPtr execute(uint32_t timeout, const char* func,
-                           ThinClientBaseDM* tcdm,
-                           CacheableVectorPtr paramList);
+                           ThinClientBaseDM* tcdm, CacheableVectorPtr paramList,
+                           const ColumnarStructSetImplPtr& columns = nullptr);
 
   // nothrow version of execute()
   GfErrType executeNoThrow(uint32_t timeout, TcrMessageReply& reply,
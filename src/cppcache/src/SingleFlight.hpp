@@ -0,0 +1,131 @@
+#pragma once
+
+#ifndef GEODE_SINGLEFLIGHT_H_
+#define GEODE_SINGLEFLIGHT_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @file SingleFlight.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class SingleFlight SingleFlight.hpp
+ *
+ * Coalesces concurrent calls for the same key into one. The first caller
+ * to join for a key leads: it does the work and completes the call with
+ * its result. Callers that join while the call is in flight wait for that
+ * result instead of repeating the work. Once completed the call is removed,
+ * so the next caller for the key leads a new one.
+ *
+ * The map of calls in flight is guarded by one mutex, held only to join
+ * and complete; waiters block on the call itself.
+ */
+template <typename K, typename V, typename Hash, typename Equal>
+class SingleFlight {
+ public:
+  class Call {
+   public:
+    Call() : m_done(false), m_waiters(0) {}
+
+    /** Blocks until the leader completes the call and returns its result. */
+    V wait() {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      ++m_waiters;
+      m_completed.wait(lock, [this] { return m_done; });
+      return m_result;
+    }
+
+    /** Number of callers that waited, or are waiting, for the result. */
+    int waiters() {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_waiters;
+    }
+
+   private:
+    void complete(const V& result) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_result = result;
+        m_done = true;
+      }
+      m_completed.notify_all();
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_completed;
+    bool m_done;
+    int m_waiters;
+    V m_result;
+
+    friend class SingleFlight;
+  };
+
+  typedef std::shared_ptr<Call> CallPtr;
+
+  /**
+   * Returns the call in flight for the key, starting one if there is none.
+   * leader is set when the call was started here, in which case the caller
+   * must complete it, also on failure, or the waiters block forever.
+   */
+  CallPtr join(const K& key, bool& leader) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CallPtr& call = m_calls[key];
+    leader = (call == nullptr);
+    if (leader) {
+      call = std::make_shared<Call>();
+    }
+    return call;
+  }
+
+  /** Hands the result to the waiters of the call led for the key. */
+  void complete(const K& key, const CallPtr& call, const V& result) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto pos = m_calls.find(key);
+      if (pos != m_calls.end() && pos->second == call) {
+        m_calls.erase(pos);
+      }
+    }
+    call->complete(result);
+  }
+
+  /** Number of calls in flight. */
+  size_t size() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_calls.size();
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::unordered_map<K, CallPtr, Hash, Equal> m_calls;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SINGLEFLIGHT_H_
@@ -82,12 +82,15 @@ const char StatsFileSizeLimit[] = "archive-file-size-limit";
 const char StatsDiskSpaceLimit[] = "archive-disk-space-limit";
 const char HeapLRULimit[] = "heap-lru-limit";
 const char HeapLRUDelta[] = "heap-lru-delta";
+const char HeapLRUAccounting[] = "heap-lru-accounting";
+const char LruAdmissionFilter[] = "lru-admission-filter";
 const char MaxSocketBufferSize[] = "max-socket-buffer-size";
 const char PingInterval[] = "ping-interval";
 const char RedundancyMonitorInterval[] = "redundancy-monitor-interval";
 const char DisableShufflingEndpoint[] = "disable-shuffling-of-endpoints";
 const char NotifyAckInterval[] = "notify-ack-interval";
 const char NotifyDupCheckLife[] = "notify-dupcheck-life";
+const char NotifyDispatchThreads[] = "notify-dispatch-threads";
 const char DurableClientId[] = "durable-client-id";
 const char DurableTimeout[] = "durable-timeout";
 const char ConnectTimeout[] = "connect-timeout";
@@ -107,6 +110,7 @@ const char SslKeystorePassword[] =
 const char ThreadPoolSize[] = "max-fe-threads";
 const char SuspendedTxTimeout[] = "suspended-tx-timeout";
 const char DisableChunkHandlerThread[] = "disable-chunk-handler-thread";
+const char ChunkProcessorThreads[] = "chunk-processor-threads";
 const char OnClientDisconnectClearPdxTypeIds[] =
     "on-client-disconnect-clear-pdxType-Ids";
 const char TombstoneTimeoutInMSec[] = "tombstone-timeout";
@@ -153,12 +157,15 @@ const uint32_t DefaultStatsDiskSpaceLimit = 0;  // = unlimited
 const uint32_t DefaultMaxQueueSize = 80000;
 const uint32_t DefaultHeapLRULimit = 0;  // = unlimited, disabled when it is 0
 const int32_t DefaultHeapLRUDelta = 10;  // = unlimited, disabled when it is 0
+const char DefaultHeapLRUAccounting[] = "object-size";
+const bool DefaultLruAdmissionFilter = false;
 
 const int32_t DefaultMaxSocketBufferSize = 65 * 1024;
 const int32_t DefaultPingInterval = 10;
 const int32_t DefaultRedundancyMonitorInterval = 10;
 const int32_t DefaultNotifyAckInterval = 1;
 const int32_t DefaultNotifyDupCheckLife = 300;
+const int32_t DefaultNotifyDispatchThreads = 0;
 const char DefaultSecurityPrefix[] = "security-";
 const char DefaultAuthIniLoaderFactory[] = "security-client-auth-factory";
 const char DefaultAuthIniLoaderLibrary[] = "security-client-auth-library";
@@ -169,6 +176,7 @@ const uint32_t DefaultSuspendedTxTimeout = 30;
 const uint32_t DefaultTombstoneTimeout = 480000;
 // not disable; all region api will use chunk handler thread
 const bool DefaultDisableChunkHandlerThread = false;
+const int32_t DefaultChunkProcessorThreads = 1;
 const bool DefaultReadTimeoutUnitInMillis = false;
 const bool DefaultOnClientDisconnectClearPdxTypeIds = false;
 }  // namespace
@@ -197,11 +205,14 @@ SystemProperties::SystemProperties(const PropertiesPtr& propertiesPtr,
       m_javaConnectionPoolSize(DefaultJavaConnectionPoolSize),
       m_heapLRULimit(DefaultHeapLRULimit),
       m_heapLRUDelta(DefaultHeapLRUDelta),
+      m_heapLRUAccounting(nullptr),
+      m_lruAdmissionFilter(DefaultLruAdmissionFilter),
       m_maxSocketBufferSize(DefaultMaxSocketBufferSize),
       m_pingInterval(DefaultPingInterval),
       m_redundancyMonitorInterval(DefaultRedundancyMonitorInterval),
       m_notifyAckInterval(DefaultNotifyAckInterval),
       m_notifyDupCheckLife(DefaultNotifyDupCheckLife),
+      m_notifyDispatchThreads(DefaultNotifyDispatchThreads),
       m_AuthIniLoaderLibrary(nullptr),
       m_AuthIniLoaderFactory(nullptr),
       m_securityClientDhAlgo(nullptr),
@@ -224,11 +235,14 @@ SystemProperties::SystemProperties(const PropertiesPtr& propertiesPtr,
       m_suspendedTxTimeout(DefaultSuspendedTxTimeout),
       m_tombstoneTimeoutInMSec(DefaultTombstoneTimeout),
       m_disableChunkHandlerThread(DefaultDisableChunkHandlerThread),
+      m_chunkProcessorThreads(DefaultChunkProcessorThreads),
       m_readTimeoutUnitInMillis(DefaultReadTimeoutUnitInMillis),
       m_onClientDisconnectClearPdxTypeIds(
           DefaultOnClientDisconnectClearPdxTypeIds) {
   processProperty(ConflateEvents, DefaultConflateEvents);
 
+  processProperty(HeapLRUAccounting, DefaultHeapLRUAccounting);
+
   processProperty(DurableClientId, DefaultDurableClientId);
 
   processProperty(SslKeyStore, DefaultSslKeyStore);
@@ -310,6 +324,7 @@ SystemProperties::~SystemProperties() {
   // adongre: Added for Ticket #758
   GF_SAFE_DELETE_ARRAY(m_sslKeystorePassword);
   GF_SAFE_DELETE_ARRAY(m_conflateEvents);
+  GF_SAFE_DELETE_ARRAY(m_heapLRUAccounting);
 }
 
 void SystemProperties::throwError(const char* msg) {
@@ -377,6 +392,16 @@ void SystemProperties::processProperty(const char* property,
       throwError(
           ("SystemProperties: non-integer " + prop + "=" + value).c_str());
     }
+  } else if (prop == NotifyDispatchThreads) {
+    char* end;
+    long si = strtol(value, &end, 10);
+    if (!*end && si >= 0) {
+      m_notifyDispatchThreads = si;
+    } else {
+      throwError(("SystemProperties: non-integer or negative " + prop + "=" +
+                  value)
+                     .c_str());
+    }
 
   } else if (prop == StatisticsSampleInterval) {
     char* end;
@@ -685,6 +710,26 @@ void SystemProperties::processProperty(const char* property,
       throwError(
           ("SystemProperties: non-integer " + prop + "=" + value).c_str());
     }
+  } else if (prop == HeapLRUAccounting) {
+    std::string val = value;
+    if (val != "object-size" && val != "allocator") {
+      throwError(("SystemProperties: unknown " + prop + "=" + val).c_str());
+    }
+    if (m_heapLRUAccounting != nullptr) {
+      delete[] m_heapLRUAccounting;
+    }
+    size_t len = val.size() + 1;
+    m_heapLRUAccounting = new char[len];
+    ACE_OS::strncpy(m_heapLRUAccounting, value, len);
+  } else if (prop == LruAdmissionFilter) {
+    std::string val = value;
+    if (val == "false") {
+      m_lruAdmissionFilter = false;
+    } else if (val == "true") {
+      m_lruAdmissionFilter = true;
+    } else {
+      throwError(("SystemProperties: non-boolean " + prop + "=" + val).c_str());
+    }
   } else if (prop == SuspendedTxTimeout) {
     char* end;
     uint32_t si = strtoul(value, &end, 10);
@@ -718,6 +763,16 @@ void SystemProperties::processProperty(const char* property,
     } else {
       throwError(("SystemProperties: non-boolean " + prop + "=" + val).c_str());
     }
+  } else if (prop == ChunkProcessorThreads) {
+    char* end;
+    long si = strtol(value, &end, 10);
+    if (!*end && si > 0) {
+      m_chunkProcessorThreads = si;
+    } else {
+      throwError(("SystemProperties: non-integer or non-positive " + prop +
+                  "=" + value)
+                     .c_str());
+    }
   } else if (prop == OnClientDisconnectClearPdxTypeIds) {
     std::string val = value;
     if (val == "false") {
@@ -793,6 +848,10 @@ void SystemProperties::logSettings() {
   settings += "\n  disable-chunk-handler-thread = ";
   settings += disableChunkHandlerThread() ? "true" : "false";
 
+  ACE_OS::snprintf(buf, 2048, "%" PRIi32, chunkProcessorThreads());
+  settings += "\n  chunk-processor-threads = ";
+  settings += buf;
+
   settings += "\n  disable-shuffling-of-endpoints = ";
   settings += isEndpointShufflingDisabled() ? "true" : "false";
 
@@ -821,6 +880,12 @@ void SystemProperties::logSettings() {
   settings += "\n  heap-lru-limit = ";
   settings += buf;
 
+  settings += "\n  heap-lru-accounting = ";
+  settings += heapLRUAccounting();
+
+  settings += "\n  lru-admission-filter = ";
+  settings += lruAdmissionFilter() ? "true" : "false";
+
   // settings += "\n  license-file = ";
   // settings += licenseFilename();
 
@@ -853,6 +918,10 @@ void SystemProperties::logSettings() {
   settings += "\n  notify-ack-interval = ";
   settings += buf;
 
+  ACE_OS::snprintf(buf, 2048, "%" PRIi32, notifyDispatchThreads());
+  settings += "\n  notify-dispatch-threads = ";
+  settings += buf;
+
   ACE_OS::snprintf(buf, 2048, "%" PRIi32, notifyDupCheckLife());
   settings += "\n  notify-dupcheck-life = ";
   settings += buf;
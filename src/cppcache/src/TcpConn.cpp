@@ -300,6 +300,25 @@ int32_t TcpConn::send(const char *buff, int32_t len, uint32_t waitSeconds,
   return socketOp(SOCK_WRITE, const_cast<char *>(buff), len, waitSeconds);
 }
 
+int32_t TcpConn::sendv(const iovec *iov, int32_t iovcnt, uint32_t waitSeconds,
+                       uint32_t waitMicroSeconds) {
+  GF_DEV_ASSERT(m_io != nullptr);
+  GF_DEV_ASSERT(iov != nullptr);
+
+  size_t len = 0;
+  for (int32_t i = 0; i < iovcnt; i++) {
+    len += iov[i].iov_len;
+  }
+  ACE_Time_Value waitTime(0, waitSeconds /*now its in microSeconds*/);
+  size_t sentLen = 0;
+  ssize_t retVal = m_io->sendv_n(iov, iovcnt, &waitTime, &sentLen);
+  // on failure or timeout the error is already set by sendv_n
+  if (retVal >= 0 && sentLen < len) {
+    ACE_OS::last_error(EPIPE);
+  }
+  return static_cast<int32_t>(sentLen);
+}
+
 int32_t TcpConn::socketOp(TcpConn::SockOp op, char *buff, int32_t len,
                           uint32_t waitSeconds) {
   {
@@ -115,6 +115,8 @@ class CPPCACHE_EXPORT TcpConn : public Connector {
                   uint32_t waitMicroSeconds);
   int32_t send(const char* buff, int32_t len, uint32_t waitSeconds,
                uint32_t waitMicroSeconds);
+  virtual int32_t sendv(const iovec* iov, int32_t iovcnt, uint32_t waitSeconds,
+                        uint32_t waitMicroSeconds);
 
   virtual void setOption(int32_t level, int32_t option, void* val,
                          int32_t len) {
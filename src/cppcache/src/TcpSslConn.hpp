@@ -72,6 +72,12 @@ class TcpSslConn : public TcpConn {
   // connect
   void connect();
 
+  // the SSL stream has no gather write, so write each buffer in turn
+  int32_t sendv(const iovec* iov, int32_t iovcnt, uint32_t waitSeconds,
+                uint32_t waitMicroSeconds) {
+    return Connector::sendv(iov, iovcnt, waitSeconds, waitMicroSeconds);
+  }
+
   void setOption(int32_t level, int32_t option, void* val, int32_t len) {
     GF_DEV_ASSERT(m_ssl != nullptr);
 
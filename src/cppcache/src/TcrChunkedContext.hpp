@@ -32,6 +32,7 @@
 #include <geode/geode_types.hpp>
 #include "Utils.hpp"
 #include "AppDomainContext.hpp"
+#include "ReceiveBufferPool.hpp"
 
 namespace apache {
 namespace geode {
@@ -46,6 +47,9 @@ class TcrChunkedResult {
   ACE_Semaphore* m_finalizeSema;
   ExceptionPtr m_ex;
   bool m_inSameThread;
+  // the chunk processor handling the chunks of this result, -1 until its
+  // first chunk is queued
+  int32_t m_chunkProcessor;
   std::unique_ptr<AppDomainContext> appDomainContext;
 
  protected:
@@ -60,6 +64,7 @@ class TcrChunkedResult {
       : m_finalizeSema(nullptr),
         m_ex(nullptr),
         m_inSameThread(false),
+        m_chunkProcessor(-1),
         appDomainContext(createAppDomainContext()),
         m_dsmemId(0) {}
   virtual ~TcrChunkedResult() {}
@@ -68,6 +73,8 @@ class TcrChunkedResult {
   }
   virtual void setEndpointMemId(uint16_t dsmemId) { m_dsmemId = dsmemId; }
   uint16_t getEndpointMemId() { return m_dsmemId; }
+  int32_t getChunkProcessor() const { return m_chunkProcessor; }
+  void setChunkProcessor(int32_t processor) { m_chunkProcessor = processor; }
   /**
    * Any cleanup to be done before starting chunk processing, or after
    * failover to a new endpoint.
@@ -146,12 +153,14 @@ class TcrChunkedContext {
         m_isLastChunkWithSecurity(isLastChunkWithSecurity),
         m_result(result) {}
 
-  inline ~TcrChunkedContext() { GF_SAFE_DELETE_ARRAY(m_bytes); }
+  inline ~TcrChunkedContext() { ReceiveBufferPool::release(m_bytes); }
 
   inline const uint8_t* getBytes() const { return m_bytes; }
 
   inline int32_t getLen() const { return m_len; }
 
+  inline TcrChunkedResult* getResult() const { return m_result; }
+
   void handleChunk(bool inSameThread) {
     if (m_bytes == nullptr) {
       // this is the last chunk for some set of chunks
@@ -34,12 +34,15 @@
 #include "DiffieHellman.hpp"
 #include "Utils.hpp"  // for RandGen for server challenge
 #include "ThinClientRegion.hpp"
+#include "ReceiveBufferPool.hpp"
 
 using namespace apache::geode::client;
 const int HEADER_LENGTH = 17;
 const int MAXBUFSIZE ATTR_UNUSED = 65536;
 const int BODYLENPOS ATTR_UNUSED = 4;
 const int64_t INITIAL_CONNECTION_ID = 26739;
+// keep gather writes below the IOV_MAX of every supported platform
+const size_t MAX_SEND_SEGMENTS = 512;
 
 #define throwException(ex)                              \
   {                                                     \
@@ -693,29 +696,8 @@ inline ConnErrType TcrConnection::sendData(uint32_t& timeSpent,
   GF_DEV_ASSERT(buffer != nullptr);
   GF_DEV_ASSERT(m_conn != nullptr);
   bool isPublicApiTimeout = false;
-  // if gfcpp property unit set then sendTimeoutSec will be in millisecond
-  // otherwise it will be in second
-  if (DistributedSystem::getSystemProperties()->readTimeoutUnitInMillis()) {
-    LOGFINER("sendData %d  %d", sendTimeoutSec, notPublicApiWithTimeout);
-    if (notPublicApiWithTimeout == TcrMessage::QUERY ||
-        notPublicApiWithTimeout == TcrMessage::QUERY_WITH_PARAMETERS ||
-        notPublicApiWithTimeout == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE ||
-        /*notPublicApiWithTimeout == TcrMessage::GETDURABLECQS_MSG_TYPE || this
-           is not public yet*/
-        notPublicApiWithTimeout == TcrMessage::EXECUTE_FUNCTION ||
-        notPublicApiWithTimeout == TcrMessage::EXECUTE_REGION_FUNCTION ||
-        notPublicApiWithTimeout == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
-        notPublicApiWithTimeout == TcrMessage::HANDSHAKE) {
-      // then app has set timeout in millis, change it to microSeconds
-      sendTimeoutSec = sendTimeoutSec * 1000;
-      isPublicApiTimeout = true;
-      LOGDEBUG("sendData2 %d ", sendTimeoutSec);
-    } else {
-		sendTimeoutSec = sendTimeoutSec * 1000 * 1000;
-    }
-  } else {  // it is set as seconds and change it to microsecond
-    sendTimeoutSec = sendTimeoutSec * 1000 * 1000;
-  }
+  sendTimeoutSec = getSendTimeoutMicros(sendTimeoutSec, notPublicApiWithTimeout,
+                                        isPublicApiTimeout);
 
   uint32_t defaultWaitSecs = 2 * 1000 * 1000;  // 2 second
   // uint32_t defaultMicroSecs = (sendTimeoutSec % (1000*1000))
@@ -756,6 +738,106 @@ inline ConnErrType TcrConnection::sendData(uint32_t& timeSpent,
   return (length == 0 ? CONN_NOERR : CONN_TIMEOUT);
 }
 
+ConnErrType TcrConnection::sendDataV(uint32_t& timeSpent,
+                                     std::vector<iovec>& segments,
+                                     uint32_t sendTimeoutSec,
+                                     bool checkConnected,
+                                     int32_t notPublicApiWithTimeout) {
+  GF_DEV_ASSERT(m_conn != nullptr);
+  bool isPublicApiTimeout = false;
+  sendTimeoutSec = getSendTimeoutMicros(sendTimeoutSec, notPublicApiWithTimeout,
+                                        isPublicApiTimeout);
+
+  size_t length = 0;
+  for (std::vector<iovec>::const_iterator iter = segments.begin();
+       iter != segments.end(); ++iter) {
+    length += iter->iov_len;
+  }
+
+  uint32_t defaultWaitSecs = 2 * 1000 * 1000;  // 2 second
+  if (defaultWaitSecs > sendTimeoutSec) defaultWaitSecs = sendTimeoutSec;
+  size_t next = 0;
+  while (length > 0 && sendTimeoutSec > 0) {
+    if (checkConnected && !m_connected) {
+      return CONN_IOERR;
+    }
+    if (sendTimeoutSec < defaultWaitSecs) {
+      defaultWaitSecs = sendTimeoutSec;
+    }
+    // stay below the operating system limit on buffers per write
+    size_t count = segments.size() - next;
+    if (count > MAX_SEND_SEGMENTS) {
+      count = MAX_SEND_SEGMENTS;
+    }
+    size_t batchLength = 0;
+    for (size_t i = next; i < next + count; i++) {
+      batchLength += segments[i].iov_len;
+    }
+    size_t sentBytes = static_cast<size_t>(m_conn->sendv(
+        &segments[next], static_cast<int32_t>(count), defaultWaitSecs, 0));
+
+    length -= sentBytes;
+    // skip the buffers written and trim a partially written one
+    size_t skip = sentBytes;
+    while (skip > 0) {
+      iovec& segment = segments[next];
+      if (skip >= segment.iov_len) {
+        skip -= segment.iov_len;
+        next++;
+      } else {
+        segment.iov_base = static_cast<char*>(segment.iov_base) + skip;
+        segment.iov_len -= skip;
+        skip = 0;
+      }
+    }
+    if (length == 0 || sentBytes == batchLength) {
+      continue;
+    }
+    int32_t lastError = ACE_OS::last_error();
+    if (lastError != ETIME && lastError != ETIMEDOUT) {
+      return CONN_IOERR;
+    }
+
+    timeSpent += defaultWaitSecs;
+    sendTimeoutSec -= defaultWaitSecs;
+  }
+  if (isPublicApiTimeout) {  // it should go in millis
+    timeSpent = timeSpent / 1000;
+  } else {  // it should go in seconds
+    timeSpent = timeSpent / (1000 * 1000);
+  }
+  return (length == 0 ? CONN_NOERR : CONN_TIMEOUT);
+}
+
+uint32_t TcrConnection::getSendTimeoutMicros(uint32_t sendTimeoutSec,
+                                             int32_t notPublicApiWithTimeout,
+                                             bool& isPublicApiTimeout) {
+  // if gfcpp property unit set then sendTimeoutSec will be in millisecond
+  // otherwise it will be in second
+  if (DistributedSystem::getSystemProperties()->readTimeoutUnitInMillis()) {
+    LOGFINER("sendData %d  %d", sendTimeoutSec, notPublicApiWithTimeout);
+    if (notPublicApiWithTimeout == TcrMessage::QUERY ||
+        notPublicApiWithTimeout == TcrMessage::QUERY_WITH_PARAMETERS ||
+        notPublicApiWithTimeout == TcrMessage::EXECUTECQ_WITH_IR_MSG_TYPE ||
+        /*notPublicApiWithTimeout == TcrMessage::GETDURABLECQS_MSG_TYPE || this
+           is not public yet*/
+        notPublicApiWithTimeout == TcrMessage::EXECUTE_FUNCTION ||
+        notPublicApiWithTimeout == TcrMessage::EXECUTE_REGION_FUNCTION ||
+        notPublicApiWithTimeout == TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP ||
+        notPublicApiWithTimeout == TcrMessage::HANDSHAKE) {
+      // then app has set timeout in millis, change it to microSeconds
+      sendTimeoutSec = sendTimeoutSec * 1000;
+      isPublicApiTimeout = true;
+      LOGDEBUG("sendData2 %d ", sendTimeoutSec);
+    } else {
+		sendTimeoutSec = sendTimeoutSec * 1000 * 1000;
+    }
+  } else {  // it is set as seconds and change it to microsecond
+    sendTimeoutSec = sendTimeoutSec * 1000 * 1000;
+  }
+  return sendTimeoutSec;
+}
+
 char* TcrConnection::sendRequest(const char* buffer, int32_t len,
                                  size_t* recvLen, uint32_t sendTimeoutSec,
                                  uint32_t receiveTimeoutSec, int32_t request) {
@@ -773,6 +855,24 @@ char* TcrConnection::sendRequest(const char* buffer, int32_t len,
   return readMessage(recvLen, receiveTimeoutSec, true, &opErr, false, request);
 }
 
+char* TcrConnection::sendRequest(const TcrMessage& request, size_t* recvLen,
+                                 uint32_t sendTimeoutSec,
+                                 uint32_t receiveTimeoutSec) {
+  LOGDEBUG("TcrConnection::sendRequest");
+  uint32_t timeSpent = 0;
+
+  send(timeSpent, request, sendTimeoutSec);
+
+  if (timeSpent >= receiveTimeoutSec)
+    throwException(
+        TimeoutException("TcrConnection::send: connection timed out"));
+
+  receiveTimeoutSec -= timeSpent;
+  ConnErrType opErr = CONN_NOERR;
+  return readMessage(recvLen, receiveTimeoutSec, true, &opErr, false,
+                     request.getMessageType());
+}
+
 void TcrConnection::sendRequestForChunkedResponse(const TcrMessage& request,
                                                   int32_t len,
                                                   TcrMessageReply& reply,
@@ -829,7 +929,7 @@ void TcrConnection::sendRequestForChunkedResponse(const TcrMessage& request,
 
   // send(buffer, len, sendTimeoutSec);
   uint32_t timeSpent = 0;
-  send(timeSpent, request.getMsgData(), len, sendTimeoutSec, true, msgType);
+  send(timeSpent, request, sendTimeoutSec, true, msgType);
 
   if (timeSpent >= receiveTimeoutSec)
     throwException(
@@ -891,6 +991,42 @@ void TcrConnection::send(uint32_t& timeSpent, const char* buffer, int len,
   }
 }
 
+void TcrConnection::send(uint32_t& timeSpent, const TcrMessage& request,
+                         uint32_t sendTimeoutSec, bool checkConnected,
+                         int32_t notPublicApiWithTimeout) {
+  if (!request.hasBorrowedParts()) {
+    send(timeSpent, request.getMsgData(), request.getMsgLength(),
+         sendTimeoutSec, checkConnected, notPublicApiWithTimeout);
+    return;
+  }
+  GF_DEV_ASSERT(m_conn != nullptr);
+
+  std::vector<iovec> segments;
+  request.getMsgSegments(segments);
+  LOGDEBUG(
+      "TcrConnection::send: [%p] sending request of %d bytes in %d buffers to "
+      "endpoint %s",
+      this, request.getMsgLength(), segments.size(), m_endpoint);
+
+  ConnErrType error = sendDataV(timeSpent, segments, sendTimeoutSec,
+                                checkConnected, notPublicApiWithTimeout);
+
+  LOGFINER(
+      "TcrConnection::send: completed send request to endpoint %s "
+      "with error: %d",
+      m_endpoint, error);
+
+  if (error != CONN_NOERR) {
+    if (error == CONN_TIMEOUT) {
+      throwException(
+          TimeoutException("TcrConnection::send: connection timed out"));
+    } else {
+      throwException(
+          GeodeIOException("TcrConnection::send: connection failure"));
+    }
+  }
+}
+
 char* TcrConnection::receive(size_t* recvLen, ConnErrType* opErr,
                              uint32_t receiveTimeoutSec) {
   GF_DEV_ASSERT(m_conn != nullptr);
@@ -898,6 +1034,48 @@ char* TcrConnection::receive(size_t* recvLen, ConnErrType* opErr,
   return readMessage(recvLen, receiveTimeoutSec, false, opErr, true);
 }
 
+char* TcrConnection::pollMessage(size_t* recvLen, ConnErrType* opErr,
+                                 uint32_t pollTimeoutSec,
+                                 uint32_t readTimeoutSec) {
+  char msg_header[HEADER_LENGTH];
+  *recvLen = 0;
+  *opErr = receiveData(msg_header, 1, pollTimeoutSec, true, true);
+  if (*opErr == CONN_NODATA) {
+    *opErr = CONN_NOERR;
+    return nullptr;
+  }
+  // once a message has started any error leaves the stream out of step
+  if (*opErr == CONN_NOERR) {
+    *opErr = receiveData(msg_header + 1, HEADER_LENGTH - 1, readTimeoutSec,
+                         true, false);
+  }
+  if (*opErr != CONN_NOERR) {
+    *opErr = CONN_IOERR;
+    return nullptr;
+  }
+
+  DataInput input(reinterpret_cast<uint8_t*>(msg_header), HEADER_LENGTH);
+  int32_t msgType, msgLen;
+  input.readInt(&msgType);
+  input.readInt(&msgLen);
+  if (msgLen < 0) {
+    *opErr = CONN_IOERR;
+    return nullptr;
+  }
+
+  *recvLen = HEADER_LENGTH + msgLen;
+  char* fullMessage = ReceiveBufferPool::allocate(*recvLen);
+  ACE_OS::memcpy(fullMessage, msg_header, HEADER_LENGTH);
+  if (msgLen > 0 && receiveData(fullMessage + HEADER_LENGTH, msgLen,
+                                readTimeoutSec, true, false) != CONN_NOERR) {
+    ReceiveBufferPool::release(fullMessage);
+    *recvLen = 0;
+    *opErr = CONN_IOERR;
+    return nullptr;
+  }
+  return fullMessage;
+}
+
 char* TcrConnection::readMessage(size_t* recvLen, uint32_t receiveTimeoutSec,
                                  bool doHeaderTimeoutRetries,
                                  ConnErrType* opErr, bool isNotificationMessage,
@@ -956,19 +1134,17 @@ char* TcrConnection::readMessage(size_t* recvLen, uint32_t receiveTimeoutSec,
   input.readInt(&msgLen);
   //  check that message length is valid.
   if (!(msgLen > 0) && request == TcrMessage::GET_CLIENT_PR_METADATA) {
-    char* fullMessage;
     *recvLen = HEADER_LENGTH + msgLen;
-    GF_NEW(fullMessage, char[HEADER_LENGTH + msgLen]);
+    char* fullMessage = ReceiveBufferPool::allocate(*recvLen);
     ACE_OS::memcpy(fullMessage, msg_header, HEADER_LENGTH);
     return fullMessage;
     // exit(0);
   }
   // GF_DEV_ASSERT(msgLen > 0);
 
-  // user has to delete this pointer
-  char* fullMessage;
+  // user has to release this pointer with ReceiveBufferPool::release()
   *recvLen = HEADER_LENGTH + msgLen;
-  GF_NEW(fullMessage, char[HEADER_LENGTH + msgLen]);
+  char* fullMessage = ReceiveBufferPool::allocate(*recvLen);
   ACE_OS::memcpy(fullMessage, msg_header, HEADER_LENGTH);
 
   uint32_t mesgBodyTimeout = receiveTimeoutSec;
@@ -978,7 +1154,7 @@ char* TcrConnection::readMessage(size_t* recvLen, uint32_t receiveTimeoutSec,
   error = receiveData(fullMessage + HEADER_LENGTH, msgLen, mesgBodyTimeout,
                       true, isNotificationMessage);
   if (error != CONN_NOERR) {
-    delete[] fullMessage;
+    ReceiveBufferPool::release(fullMessage);
     //  the !isNotificationMessage ensures that notification channel
     // gets the GeodeIOException and not TimeoutException;
     // this is required since header has already been read meaning there could
@@ -1134,13 +1310,13 @@ void TcrConnection::readMessageChunked(TcrMessageReply& reply,
     // inp.readBoolean(&isLastChunk);
     inp.read(&isLastChunk);
 
-    uint8_t* chunk_body;
-    GF_NEW(chunk_body, uint8_t[chunkLen]);
+    uint8_t* chunk_body =
+        reinterpret_cast<uint8_t*>(ReceiveBufferPool::allocate(chunkLen));
     error = receiveData(reinterpret_cast<char*>(chunk_body), chunkLen,
                         receiveTimeoutSec, true, false,
                         reply.getMessageTypeRequest());
     if (error != CONN_NOERR) {
-      delete[] chunk_body;
+      ReceiveBufferPool::release(chunk_body);
       if (error & CONN_TIMEOUT) {
         throwException(TimeoutException(
             "TcrConnection::readMessageChunked: "
@@ -1158,7 +1334,7 @@ void TcrConnection::readMessageChunked(TcrMessageReply& reply,
         chunkNum, m_endpoint,
         Utils::convertBytesToString(chunk_body, chunkLen)->asChar());
     // Process the chunk; the actual processing is done by a separate thread
-    // ThinClientBaseDM::m_chunkProcessor.
+    // ThinClientBaseDM::m_chunkProcessors.
 
     reply.processChunk(chunk_body, chunkLen,
                        m_endpointObj->getDistributedMemberID(), isLastChunk);
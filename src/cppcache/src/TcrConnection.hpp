@@ -21,6 +21,7 @@
  */
 
 #include <atomic>
+#include <vector>
 #include <ace/Semaphore.h>
 #include <geode/geode_globals.hpp>
 #include <geode/ExceptionTypes.hpp>
@@ -162,6 +163,14 @@ class CPPCACHE_EXPORT TcrConnection {
                     uint32_t receiveTimeoutSec = DEFAULT_READ_TIMEOUT_SECS,
                     int32_t request = -1);
 
+  /**
+   * Same as above but sends the message straight from its serialized parts
+   * so that large values borrowed by the request are not copied first.
+   */
+  char* sendRequest(const TcrMessage& request, size_t* recvLen,
+                    uint32_t sendTimeoutSec = DEFAULT_WRITE_TIMEOUT,
+                    uint32_t receiveTimeoutSec = DEFAULT_READ_TIMEOUT_SECS);
+
   /**
    * send a synchronized request to server for REGISTER_INTEREST_LIST.
    *
@@ -201,6 +210,15 @@ class CPPCACHE_EXPORT TcrConnection {
       bool checkConnected = true,
       int32_t notPublicApiWithTimeout = -2 /*NOT_PUBLIC_API_WITH_TIMEOUT*/);
 
+  /**
+   * Send a whole message using a gather write when it holds borrowed parts.
+   */
+  void send(
+      uint32_t& timeSpent, const TcrMessage& request,
+      uint32_t sendTimeoutSec = DEFAULT_WRITE_TIMEOUT,
+      bool checkConnected = true,
+      int32_t notPublicApiWithTimeout = -2 /*NOT_PUBLIC_API_WITH_TIMEOUT*/);
+
   /**
    * This method is for receiving client notification. It will read 2 times as
    * reading reply in sendRequest()
@@ -215,6 +233,20 @@ class CPPCACHE_EXPORT TcrConnection {
   char* receive(size_t* recvLen, ConnErrType* opErr,
                 uint32_t receiveTimeoutSec = DEFAULT_READ_TIMEOUT_SECS);
 
+  /**
+   * Waits up to pollTimeoutSec for the next message to start arriving and
+   * then reads all of it within readTimeoutSec, so that a short poll does
+   * not cut off a slow message.
+   *
+   * @param      recvLen output parameter for length of the received message
+   * @param      opErr output parameter: CONN_NOERR, also when no message
+   *             arrived, else the error that left the stream unusable
+   * @return     the message, to be released with
+   *             ReceiveBufferPool::release(), or nullptr
+   */
+  char* pollMessage(size_t* recvLen, ConnErrType* opErr,
+                    uint32_t pollTimeoutSec, uint32_t readTimeoutSec);
+
   //  readMessage is now public
   /**
    * This method reads a message from the socket connection and returns the byte
@@ -378,6 +410,24 @@ class CPPCACHE_EXPORT TcrConnection {
       uint32_t sendTimeoutSec, bool checkConnected = true,
       int32_t notPublicApiWithTimeout = -2 /*NOT_PUBLIC_API_WITH_TIMEOUT*/);
 
+  /**
+   * Send the given buffers to the connection till sendTimeoutSec, using as
+   * few writes as the connection allows. The buffers are updated as they are
+   * written.
+   */
+  ConnErrType sendDataV(
+      uint32_t& timeSpent, std::vector<iovec>& segments,
+      uint32_t sendTimeoutSec, bool checkConnected = true,
+      int32_t notPublicApiWithTimeout = -2 /*NOT_PUBLIC_API_WITH_TIMEOUT*/);
+
+  /**
+   * Converts the send timeout to microseconds, honouring the millisecond
+   * unit for public APIs when configured.
+   */
+  uint32_t getSendTimeoutMicros(uint32_t sendTimeoutSec,
+                                int32_t notPublicApiWithTimeout,
+                                bool& isPublicApiTimeout);
+
   /**
    * Read data from the connection till receiveTimeoutSec
    */
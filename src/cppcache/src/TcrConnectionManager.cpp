@@ -31,6 +31,7 @@
 #include "RemoteQueryService.hpp"
 #include "ThinClientLocatorHelper.hpp"
 #include "ServerLocation.hpp"
+#include "NotificationDispatcher.hpp"
 #include <ace/INET_Addr.h>
 #include <set>
 #include <thread>
@@ -59,8 +60,16 @@ TcrConnectionManager::TcrConnectionManager(CacheImpl *cache)
       m_notifyCleanupSemaList(false),
       m_redundancySema(0),
       m_redundancyTask(nullptr),
-      m_isDurable(false) {
+      m_isDurable(false),
+      m_notificationDispatcher(nullptr) {
   m_redundancyManager = new ThinClientRedundancyManager(this);
+  int32_t dispatchThreads =
+      DistributedSystem::getSystemProperties()->notifyDispatchThreads();
+  if (dispatchThreads > 0) {
+    m_notificationDispatcher =
+        new NotificationDispatcher(cache, dispatchThreads);
+    m_notificationDispatcher->start();
+  }
 }
 
 long TcrConnectionManager::getPingTaskId() { return m_pingTaskId; }
@@ -183,6 +192,10 @@ void TcrConnectionManager::close() {
 
     removeHAEndpoints();
   }
+
+  if (m_notificationDispatcher != nullptr) {
+    m_notificationDispatcher->stop();
+  }
   LOGFINE("TcrConnectionManager is closed");
 }
 
@@ -219,6 +232,7 @@ TcrConnectionManager::~TcrConnectionManager() {
       }
     }
   }
+  GF_SAFE_DELETE(m_notificationDispatcher);
   TcrConnectionManager::TEST_DURABLE_CLIENT_CRASH = false;
 }
 
@@ -48,6 +48,7 @@ class TcrMessage;
 class CacheImpl;
 class ThinClientBaseDM;
 class ThinClientRegion;
+class NotificationDispatcher;
 
 /**
  * @brief transport data between caches
@@ -128,8 +129,12 @@ class CPPCACHE_EXPORT TcrConnectionManager {
     m_distMngrsLock.release();
   }
 
-  bool checkDupAndAdd(EventIdPtr eventid) {
-    return m_redundancyManager->checkDupAndAdd(eventid);
+  bool checkDupAndAdd(EventIdPtr eventid, bool hold = false) {
+    return m_redundancyManager->checkDupAndAdd(eventid, hold);
+  }
+
+  void releaseEventAck(EventIdPtr eventid) {
+    m_redundancyManager->releaseEventAck(eventid);
   }
 
   ACE_Recursive_Thread_Mutex* getRedundancyLock() {
@@ -140,6 +145,14 @@ class CPPCACHE_EXPORT TcrConnectionManager {
     return m_redundancyManager->sendRequestToPrimary(request, reply);
   }
 
+  /**
+   * Returns the dispatcher for subscription events, or nullptr if events are
+   * processed by the receiving threads.
+   */
+  NotificationDispatcher* getNotificationDispatcher() {
+    return m_notificationDispatcher;
+  }
+
  private:
   CacheImpl* m_cache;
   volatile bool m_initGuard;
@@ -176,6 +189,7 @@ class CPPCACHE_EXPORT TcrConnectionManager {
   bool m_isDurable;
 
   ThinClientRedundancyManager* m_redundancyManager;
+  NotificationDispatcher* m_notificationDispatcher;
 
   int failover(volatile bool& isRunning);
   int redundancy(volatile bool& isRunning);
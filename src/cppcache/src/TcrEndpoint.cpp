@@ -23,6 +23,7 @@
 #include "CacheImpl.hpp"
 #include "Utils.hpp"
 #include "DistributedSystemImpl.hpp"
+#include "NotificationDispatcher.hpp"
 
 #include <thread>
 #include <chrono>
@@ -583,8 +584,12 @@ void TcrEndpoint::pingServer(ThinClientPoolDM* poolDM) {
   }
 }
 
-bool TcrEndpoint::checkDupAndAdd(EventIdPtr eventid) {
-  return m_cache->tcrConnectionManager().checkDupAndAdd(eventid);
+bool TcrEndpoint::checkDupAndAdd(EventIdPtr eventid, bool hold) {
+  return m_cache->tcrConnectionManager().checkDupAndAdd(eventid, hold);
+}
+
+void TcrEndpoint::releaseEventAck(EventIdPtr eventid) {
+  m_cache->tcrConnectionManager().releaseEventAck(eventid);
 }
 
 int TcrEndpoint::receiveNotification(volatile bool& isRunning) {
@@ -639,7 +644,10 @@ int TcrEndpoint::receiveNotification(volatile bool& isRunning) {
           continue;
         }
 
+        NotificationDispatcher* dispatcher =
+            m_cache->tcrConnectionManager().getNotificationDispatcher();
         bool isMarker = (msg->getMessageType() == TcrMessage::CLIENT_MARKER);
+        bool holdAck = false;
         if (!msg->hasCqPart()) {
           if (msg->getMessageType() != TcrMessage::CLIENT_MARKER) {
             const std::string& regionFullPath1 = msg->getRegionName();
@@ -656,10 +664,16 @@ int TcrEndpoint::receiveNotification(volatile bool& isRunning) {
               GF_SAFE_DELETE(msg);
               continue;
             }
+            // events are acked once applied by a dispatcher worker, or
+            // once delivered when batched for the listener
+            holdAck = region1 != nullptr &&
+                      (dispatcher != nullptr ||
+                       static_cast<ThinClientRegion*>(region1.get())
+                           ->isBatchingEvents());
           }
         }
 
-        if (!checkDupAndAdd(msg->getEventId())) {
+        if (!checkDupAndAdd(msg->getEventId(), holdAck)) {
           m_dupCount++;
           if (m_dupCount % 100 == 1) {
             LOGFINE("Dropped %dst duplicate notification message", m_dupCount);
@@ -667,35 +681,19 @@ int TcrEndpoint::receiveNotification(volatile bool& isRunning) {
           GF_SAFE_DELETE(msg);
           continue;
         }
+        msg->setEventAckHeld(holdAck);
 
         if (isMarker) {
           LOGFINE("Got a marker message on endpont %s", m_name.c_str());
+          // events received before the marker must be applied first
+          if (dispatcher != nullptr) {
+            dispatcher->waitForIdle();
+          }
           m_cache->processMarker();
           processMarker();
           GF_SAFE_DELETE(msg);
-        } else {
-          if (!msg->hasCqPart())  // || msg->isInterestListPassed())
-          {
-            const std::string& regionFullPath = msg->getRegionName();
-            RegionPtr region;
-            m_cache->getRegion(regionFullPath.c_str(), region);
-            if (region != nullptr) {
-              static_cast<ThinClientRegion*>(region.get())
-                  ->receiveNotification(msg);
-            } else {
-              LOGWARN(
-                  "Notification for region %s that does not exist in "
-                  "client cache.",
-                  regionFullPath.c_str());
-            }
-          } else {
-            LOGDEBUG("receive cq notification %d", msg->getMessageType());
-            QueryServicePtr queryService = getQueryService();
-            if (queryService != nullptr) {
-              static_cast<RemoteQueryService*>(queryService.get())
-                  ->receiveNotification(msg);
-            }
-          }
+        } else if (dispatcher == nullptr || !dispatcher->dispatch(this, msg)) {
+          processNotification(msg);
         }
       }
     } catch (const TimeoutException&) {
@@ -736,10 +734,44 @@ int TcrEndpoint::receiveNotification(volatile bool& isRunning) {
           m_name.c_str());
     }
   }
+  // no queued event may refer to this endpoint once the channel is closed
+  NotificationDispatcher* dispatcher =
+      m_cache->tcrConnectionManager().getNotificationDispatcher();
+  if (dispatcher != nullptr) {
+    dispatcher->waitForIdle();
+  }
   LOGFINE("Ended subscription channel for endpoint %s", m_name.c_str());
   return 0;
 }
 
+void TcrEndpoint::processNotification(TcrMessage* msg, bool dispatched) {
+  if (!msg->hasCqPart())  // || msg->isInterestListPassed())
+  {
+    const std::string& regionFullPath = msg->getRegionName();
+    RegionPtr region;
+    m_cache->getRegion(regionFullPath.c_str(), region);
+    if (region != nullptr) {
+      static_cast<ThinClientRegion*>(region.get())
+          ->receiveNotification(msg, dispatched);
+    } else {
+      LOGWARN(
+          "Notification for region %s that does not exist in "
+          "client cache.",
+          regionFullPath.c_str());
+      if (msg->isEventAckHeld()) {
+        releaseEventAck(msg->getEventId());
+      }
+    }
+  } else {
+    LOGDEBUG("receive cq notification %d", msg->getMessageType());
+    QueryServicePtr queryService = getQueryService();
+    if (queryService != nullptr) {
+      static_cast<RemoteQueryService*>(queryService.get())
+          ->receiveNotification(msg);
+    }
+  }
+}
+
 inline bool TcrEndpoint::compareTransactionIds(int32_t reqTransId,
                                                int32_t replyTransId,
                                                std::string& failReason,
@@ -842,9 +874,8 @@ GfErrType TcrEndpoint::sendRequestConn(const TcrMessage& request,
     }
     size_t dataLen;
     LOGDEBUG("sendRequestConn: calling sendRequest");
-    char* data = conn->sendRequest(
-        request.getMsgData(), request.getMsgLength(), &dataLen,
-        request.getTimeout(), reply.getTimeout(), request.getMessageType());
+    char* data = conn->sendRequest(request, &dataLen, request.getTimeout(),
+                                   reply.getTimeout());
     reply.setMessageTypeRequest(type);
     reply.setData(data, static_cast<int32_t>(dataLen),
                   this->getDistributedMemberID());  // memory is released by
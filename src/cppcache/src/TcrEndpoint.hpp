@@ -67,6 +67,9 @@ class CPPCACHE_EXPORT TcrEndpoint {
 
   void pingServer(ThinClientPoolDM* poolDM = nullptr);
   int receiveNotification(volatile bool& isRunning);
+  // hands a subscription event to its region or to the CQ service;
+  // dispatched is true when a NotificationDispatcher worker calls it
+  void processNotification(TcrMessage* msg, bool dispatched = false);
   GfErrType send(const TcrMessage& request, TcrMessageReply& reply);
   GfErrType sendRequestConn(const TcrMessage& request, TcrMessageReply& reply,
                             TcrConnection* conn, std::string& failReason);
@@ -186,7 +189,8 @@ class CPPCACHE_EXPORT TcrEndpoint {
   PropertiesPtr getCredentials();
   volatile int m_maxConnections;
   FairQueue<TcrConnection> m_opConnections;
-  virtual bool checkDupAndAdd(EventIdPtr eventid);
+  virtual bool checkDupAndAdd(EventIdPtr eventid, bool hold = false);
+  virtual void releaseEventAck(EventIdPtr eventid);
   virtual void processMarker();
   virtual void triggerRedundancyThread();
   virtual QueryServicePtr getQueryService();
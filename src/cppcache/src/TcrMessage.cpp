@@ -288,7 +288,8 @@ inline void TcrMessage::readCallbackObjectPart(DataInput& input,
   }
 }
 
-inline void TcrMessage::readObjectPart(DataInput& input, bool defaultString) {
+inline void TcrMessage::readObjectPart(DataInput& input, bool defaultString,
+                                       bool keepSerialized) {
   int32_t lenObj;
   input.readInt(&lenObj);
   // bool isObj;
@@ -297,7 +298,7 @@ inline void TcrMessage::readObjectPart(DataInput& input, bool defaultString) {
   input.read(&isObj);
   if (lenObj > 0) {
     if (isObj == 1) {
-      input.readObject(m_value);
+      TcrMessageHelper::readObject(input, m_value, keepSerialized);
     } else {
       if (defaultString) {
         // m_value = CacheableString::create(
@@ -599,6 +600,24 @@ void TcrMessage::writeObjectPart(const SerializablePtr& se, bool isDelta,
     m_request->write(isObject);
   }
 
+  if (!isObject && !isDelta) {
+    // send large byte arrays straight from the value instead of copying them
+    // into the request
+    auto cacheableBytes = std::dynamic_pointer_cast<CacheableBytes>(se);
+    if (cacheableBytes != nullptr &&
+        cacheableBytes->length() >= BORROWED_PART_MIN_LENGTH) {
+      BorrowedPart part;
+      part.m_offset = m_request->getBufferLength();
+      part.m_bytes = cacheableBytes;
+      m_borrowedParts.push_back(part);
+      m_borrowedLength += cacheableBytes->length();
+      m_request->rewindCursor(1 + 4);
+      m_request->writeInt(static_cast<int32_t>(cacheableBytes->length()));
+      m_request->advanceCursor(1);
+      return;
+    }
+  }
+
   uint32_t sizeBeforeWritingObj = m_request->getBufferLength();
   if (isDelta) {
     auto deltaPtr = std::dynamic_pointer_cast<Delta>(se);
@@ -755,7 +774,7 @@ void TcrMessage::writeEventIdPart(int reserveSize,
 
 void TcrMessage::writeMessageLength() {
   uint32_t totalLen = m_request->getBufferLength();
-  uint32_t msgLen = totalLen - g_headerLen;
+  uint32_t msgLen = totalLen + m_borrowedLength - g_headerLen;
   m_request->rewindCursor(
       totalLen -
       4);  // msg len is written after the msg type which is of 4 bytes ...
@@ -905,7 +924,7 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
                  TcrMessage::GET_ALL_DATA_ERROR == m_msgType) {
         if (bytes != nullptr) {
           chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
-          GF_SAFE_DELETE_ARRAY(bytes);
+          ReceiveBufferPool::release(bytes);
         }
       }
       break;
@@ -923,13 +942,13 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
         // readSecureObjectPart(input, false, true,
         // isLastChunkAndisSecurityHeader );
         chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
-        GF_SAFE_DELETE_ARRAY(bytes);
+        ReceiveBufferPool::release(bytes);
       }
       break;
     }
     case TcrMessage::EXCEPTION: {
       if (bytes != nullptr) {
-        DeleteArray<const uint8_t> delChunk(bytes);
+        ReleaseReceiveBuffer<const uint8_t> delChunk(bytes);
         DataInput input(bytes, len);
         readExceptionPart(input, isLastChunkAndisSecurityHeader);
         readSecureObjectPart(input, false, true,
@@ -941,7 +960,7 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
       // TODO: how many parts
       chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
       if (bytes != nullptr) {
-        DeleteArray<const uint8_t> delChunk(bytes);
+        ReleaseReceiveBuffer<const uint8_t> delChunk(bytes);
         LOGFINEST("processChunk - got response from secondary, ignoring.");
       }
       break;
@@ -949,7 +968,7 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
     case TcrMessage::GET_ALL_DATA_ERROR: {
       chunkSecurityHeader(1, bytes, len, isLastChunkAndisSecurityHeader);
       if (bytes != nullptr) {
-        GF_SAFE_DELETE_ARRAY(bytes);
+        ReceiveBufferPool::release(bytes);
       }
       // nothing else to done since this will be taken care of at higher level
       break;
@@ -957,7 +976,7 @@ void TcrMessage::processChunk(const uint8_t* bytes, int32_t len,
     default: {
       // TODO: how many parts what should we do here
       if (bytes != nullptr) {
-        GF_SAFE_DELETE_ARRAY(bytes);
+        ReceiveBufferPool::release(bytes);
       } else {
         LOGWARN(
             "Got unhandled message type %d while processing response, possible "
@@ -1067,7 +1086,8 @@ void TcrMessage::handleByteArrayResponse(const char* bytearray, int32_t len,
         m_functionAttributes->push_back(oFW);
       } else if (m_msgTypeRequest == TcrMessage::REQUEST) {
         int32_t receivednumparts = 2;
-        readObjectPart(input);
+        readObjectPart(input, false,
+                       m_tcdm != nullptr && m_tcdm->keepsValuesSerialized());
         uint32_t flag = 0;
         readIntPart(input, &flag);
         if (flag & 0x01) {
@@ -2602,6 +2622,8 @@ TcrMessageRemoveUserAuth::TcrMessageRemoveUserAuth(
 }
 void TcrMessage::createUserCredentialMessage(TcrConnection* conn) {
   m_request->reset();
+  m_borrowedParts.clear();
+  m_borrowedLength = 0;
   m_isSecurityHeaderAdded = false;
   writeHeader(m_msgType, 1);
 
@@ -2814,7 +2836,7 @@ TcrMessageKeySet::TcrMessageKeySet(const std::string& funcName,
 
 void TcrMessage::setData(const char* bytearray, int32_t len, uint16_t memId) {
   if (bytearray) {
-    DeleteArray<const char> delByteArr(bytearray);
+    ReleaseReceiveBuffer<const char> delByteArr(bytearray);
     handleByteArrayResponse(bytearray, len, memId);
   }
 }
@@ -2862,24 +2884,64 @@ const CacheablePtr& TcrMessage::getCallbackArgumentRef() const {
   return m_callbackArgument;
 }
 
-const char* TcrMessage::getMsgData() const {
-  return (char*)m_request->getBuffer();
-}
+const char* TcrMessage::getMsgData() const { return getContiguousMsg(); }
 
 const char* TcrMessage::getMsgHeader() const {
   return (char*)m_request->getBuffer();
 }
 
 const char* TcrMessage::getMsgBody() const {
-  return (char*)m_request->getBuffer() + g_headerLen;
+  return getContiguousMsg() + g_headerLen;
 }
 
 uint32_t TcrMessage::getMsgLength() const {
-  return m_request->getBufferLength();
+  return m_request->getBufferLength() + m_borrowedLength;
 }
 
 uint32_t TcrMessage::getMsgBodyLength() const {
-  return m_request->getBufferLength() - g_headerLen;
+  return getMsgLength() - g_headerLen;
+}
+
+const char* TcrMessage::getContiguousMsg() const {
+  if (m_borrowedParts.empty()) {
+    return (char*)m_request->getBuffer();
+  }
+  // rebuilt on every call since the header may have been updated for a retry
+  std::vector<iovec> segments;
+  getMsgSegments(segments);
+  m_flatRequest.resize(getMsgLength());
+  size_t pos = 0;
+  for (std::vector<iovec>::const_iterator iter = segments.begin();
+       iter != segments.end(); ++iter) {
+    ACE_OS::memcpy(&m_flatRequest[pos], iter->iov_base, iter->iov_len);
+    pos += iter->iov_len;
+  }
+  return &m_flatRequest[0];
+}
+
+void TcrMessage::getMsgSegments(std::vector<iovec>& segments) const {
+  const uint8_t* buffer = m_request->getBuffer();
+  uint32_t pos = 0;
+  iovec segment;
+  for (std::vector<BorrowedPart>::const_iterator iter =
+           m_borrowedParts.begin();
+       iter != m_borrowedParts.end(); ++iter) {
+    if (iter->m_offset > pos) {
+      segment.iov_base = (char*)(buffer + pos);
+      segment.iov_len = iter->m_offset - pos;
+      segments.push_back(segment);
+      pos = iter->m_offset;
+    }
+    segment.iov_base = (char*)iter->m_bytes->value();
+    segment.iov_len = iter->m_bytes->length();
+    segments.push_back(segment);
+  }
+  uint32_t bufferLength = m_request->getBufferLength();
+  if (bufferLength > pos) {
+    segment.iov_base = (char*)(buffer + pos);
+    segment.iov_len = bufferLength - pos;
+    segments.push_back(segment);
+  }
 }
 
 EventIdPtr TcrMessage::getEventId() const { return m_eventid; }
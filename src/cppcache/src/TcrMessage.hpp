@@ -25,6 +25,7 @@
 #include <geode/Cacheable.hpp>
 #include <geode/CacheableKey.hpp>
 #include <geode/CacheableString.hpp>
+#include <geode/CachedDeserializable.hpp>
 #include <geode/UserData.hpp>
 #include <geode/DataOutput.hpp>
 #include <geode/DataInput.hpp>
@@ -43,6 +44,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <ace/os_include/sys/os_uio.h>
 
 namespace apache {
 namespace geode {
@@ -327,6 +329,18 @@ class CPPCACHE_EXPORT TcrMessage {
   const char* getMsgBody() const;
   uint32_t getMsgLength() const;
   uint32_t getMsgBodyLength() const;
+
+  /**
+   * Large byte array values are not copied into the request buffer; the
+   * message only refers to them. The message is then sent as the list of
+   * buffers returned here, in order. getMsgData() still returns the whole
+   * message in one buffer, copying it if necessary.
+   */
+  bool hasBorrowedParts() const { return !m_borrowedParts.empty(); }
+  void getMsgSegments(std::vector<iovec>& segments) const;
+
+  /** Minimum size of a byte array value for it to be sent in place. */
+  static const int32_t BORROWED_PART_MIN_LENGTH = 8 * 1024;
   EventIdPtr getEventId() const;
 
   int32_t getTransId() const;
@@ -390,6 +404,11 @@ class CPPCACHE_EXPORT TcrMessage {
 
   bool hasDelta() { return (m_delta != nullptr); }
 
+  // set on a notification whose event id is held back from the periodic ack
+  // until the region releases it
+  void setEventAckHeld(bool held) { m_eventAckHeld = held; }
+  bool isEventAckHeld() const { return m_eventAckHeld; }
+
   void addSecurityPart(int64_t connectionId, int64_t unique_id,
                        TcrConnection* conn);
 
@@ -458,6 +477,7 @@ class CPPCACHE_EXPORT TcrMessage {
         m_isMetaRegion(false),
         exceptionMessage(),
         m_request(new DataOutput),
+        m_borrowedLength(0),
         m_msgType(TcrMessage::INVALID),
         m_msgLength(-1),
         m_msgTypeRequest(0),
@@ -499,6 +519,7 @@ class CPPCACHE_EXPORT TcrMessage {
         m_deltaBytes(nullptr),
         m_deltaBytesLen(0),
         m_isCallBackArguement(false),
+        m_eventAckHeld(false),
         m_bucketServerLocation(nullptr),
         m_entryNotFound(0),
         m_fpaSet(),
@@ -539,7 +560,8 @@ class CPPCACHE_EXPORT TcrMessage {
   // some private methods to handle things internally.
   void handleByteArrayResponse(const char* bytearray, int32_t len,
                                uint16_t endpointMemId);
-  void readObjectPart(DataInput& input, bool defaultString = false);
+  void readObjectPart(DataInput& input, bool defaultString = false,
+                      bool keepSerialized = false);
   void readFailedNodePart(DataInput& input, bool defaultString = false);
   void readCallbackObjectPart(DataInput& input, bool defaultString = false);
   void readKeyPart(DataInput& input);
@@ -580,6 +602,17 @@ class CPPCACHE_EXPORT TcrMessage {
   DSMemberForVersionStampPtr readDSMember(
       apache::geode::client::DataInput& input);
   DataOutput* m_request;
+  // byte array values written by reference; each one goes before the byte
+  // of m_request at m_offset
+  struct BorrowedPart {
+    uint32_t m_offset;
+    CacheableBytesPtr m_bytes;
+  };
+  std::vector<BorrowedPart> m_borrowedParts;
+  uint32_t m_borrowedLength;
+  // contiguous copy of a message with borrowed parts, see getMsgData()
+  mutable std::vector<char> m_flatRequest;
+  const char* getContiguousMsg() const;
   int32_t m_msgType;
   int32_t m_msgLength;
   int32_t m_msgTypeRequest;  // the msgType of the request if this TcrMessage is
@@ -627,6 +660,7 @@ class CPPCACHE_EXPORT TcrMessage {
   uint8_t* m_deltaBytes;
   int32_t m_deltaBytesLen;
   bool m_isCallBackArguement;
+  bool m_eventAckHeld;
   BucketServerLocationPtr m_bucketServerLocation;
   uint32_t m_entryNotFound;
   std::vector<FixedPartitionAttributesImplPtr>* m_fpaSet;
@@ -1095,6 +1129,50 @@ class TcrMessageHelper {
     msg.skipParts(input, numParts);
   }
 
+  /**
+   * Reads the next object. If keepSerialized is true and the object is a
+   * PDX value, its bytes are copied into a CachedDeserializable instead of
+   * being deserialized.
+   */
+  inline static void readObject(DataInput& input, SerializablePtr& value,
+                                bool keepSerialized) {
+    if (keepSerialized) {
+      int32_t length = getPdxValueLength(input);
+      if (length > 0) {
+        value = CachedDeserializable::create(input.currentBufferPosition(),
+                                             length, input.getPoolName());
+        input.advanceCursor(length);
+        return;
+      }
+    }
+    input.readObject(value);
+  }
+
+  /**
+   * Returns the length of the PDX value at the current position of input,
+   * or 0 if the next object is not a complete PDX value. The value is the
+   * PDX type id byte, the length of its fields and offsets, the PDX type id
+   * and then the fields and offsets.
+   */
+  inline static int32_t getPdxValueLength(const DataInput& input) {
+    const int32_t headerLength = 9;
+    if (input.getBytesRemaining() < headerLength) {
+      return 0;
+    }
+    const uint8_t* buf = input.currentBufferPosition();
+    if (buf[0] != GeodeTypeIdsImpl::PDX) {
+      return 0;
+    }
+    int32_t length = static_cast<int32_t>(
+        (static_cast<uint32_t>(buf[1]) << 24) |
+        (static_cast<uint32_t>(buf[2]) << 16) |
+        (static_cast<uint32_t>(buf[3]) << 8) | static_cast<uint32_t>(buf[4]));
+    if (length < 0 || length > input.getBytesRemaining() - headerLength) {
+      return 0;
+    }
+    return headerLength + length;
+  }
+
   /**
    * Reads header of a chunk part. Returns true if header was successfully
    * read and false if it is a chunk exception part.
@@ -0,0 +1,309 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "TcrMultiplexedConnection.hpp"
+#include <ace/OS.h>
+#include "TcrConnection.hpp"
+#include "TcrEndpoint.hpp"
+#include "TcrMessage.hpp"
+#include "ReceiveBufferPool.hpp"
+
+using namespace apache::geode::client;
+
+const char* TcrMultiplexedConnection::NC_Multiplex_Reader =
+    "NC Multiplex Reader";
+
+namespace {
+thread_local bool s_readerThread = false;
+}  // namespace
+
+TcrMultiplexedConnection::TcrMultiplexedConnection(TcrEndpoint* endpoint,
+                                                   TcrConnection* conn,
+                                                   uint32_t readTimeoutSec)
+    : m_endpoint(endpoint),
+      m_conn(conn),
+      m_readTimeoutSec(readTimeoutSec),
+      m_reader(nullptr),
+      m_closed(false) {}
+
+TcrMultiplexedConnection::~TcrMultiplexedConnection() {
+  if (s_readerThread) {
+    // stopping the reader would join the current thread and delete the task
+    // it is running
+    LOGERROR(
+        "Multiplexed connection to endpoint %s destroyed on a reader thread",
+        m_endpoint->name().c_str());
+  }
+  failPending(GF_NOTCON);
+  if (m_reader != nullptr) {
+    m_reader->stop();
+    GF_SAFE_DELETE(m_reader);
+  }
+  if (m_conn != nullptr) {
+    GF_SAFE_DELETE_CON(m_conn);
+  }
+}
+
+void TcrMultiplexedConnection::start() {
+  m_reader = new Task<TcrMultiplexedConnection>(
+      this, &TcrMultiplexedConnection::readReplies, NC_Multiplex_Reader);
+  m_reader->start();
+}
+
+bool TcrMultiplexedConnection::isReaderThread() { return s_readerThread; }
+
+bool TcrMultiplexedConnection::getTransId(const char* data, size_t dataLen,
+                                          int32_t& transId) {
+  // message type, message length and number of parts come first
+  if (data == nullptr || dataLen < 4 * sizeof(int32_t)) {
+    return false;
+  }
+  DataInput input(reinterpret_cast<const uint8_t*>(data),
+                  static_cast<int32_t>(dataLen));
+  input.advanceCursor(static_cast<int32_t>(3 * sizeof(int32_t)));
+  input.readInt(&transId);
+  return true;
+}
+
+size_t TcrMultiplexedConnection::getInFlightCount() {
+  ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+  return m_pending.size();
+}
+
+GfErrType TcrMultiplexedConnection::writeRequest(
+    const TcrMessage& request, const PendingReplyPtr& pending) {
+  {
+    ACE_Guard<ACE_Thread_Mutex> writeGuard(m_writeLock);
+    {
+      ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+      if (m_closed) {
+        return GF_NOTCON;
+      }
+      m_pending.push_back(pending);
+    }
+    try {
+      uint32_t timeSpent = 0;
+      m_conn->send(timeSpent, request, request.getTimeout());
+      return GF_NOERR;
+    } catch (const Exception& ex) {
+      LOGFINE(
+          "TcrMultiplexedConnection::writeRequest: send to endpoint %s failed: "
+          "%s",
+          m_endpoint->name().c_str(), ex.getMessage());
+      // a partially written request leaves the stream unusable for everyone;
+      // the failed request itself is reported through the return value only
+      ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+      m_closed = true;
+      pending->m_abandoned = true;
+    }
+  }
+  failPending(GF_IOERR);
+  return GF_IOERR;
+}
+
+GfErrType TcrMultiplexedConnection::sendRequest(const TcrMessage& request,
+                                                TcrMessageReply& reply) {
+  auto pending =
+      std::make_shared<PendingReply>(m_pendingLock, request.getTransId());
+  GfErrType err = writeRequest(request, pending);
+  if (err != GF_NOERR) {
+    return err;
+  }
+
+  char* data = nullptr;
+  size_t dataLen = 0;
+  {
+    ACE_Time_Value stopAt(ACE_OS::gettimeofday());
+    stopAt += ACE_Time_Value(reply.getTimeout());
+    ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+    while (!pending->m_done) {
+      if (pending->m_cond.wait(&stopAt) == -1 && !pending->m_done &&
+          ACE_OS::gettimeofday() >= stopAt) {
+        // leave the slot in the queue so the reply is still consumed in
+        // order; the reader discards it when it arrives
+        pending->m_abandoned = true;
+        LOGFINE(
+            "TcrMultiplexedConnection::sendRequest: timed out waiting for "
+            "reply from endpoint %s",
+            m_endpoint->name().c_str());
+        return GF_TIMOUT;
+      }
+    }
+    if (pending->m_error != GF_NOERR) {
+      return pending->m_error;
+    }
+    data = pending->m_data;
+    dataLen = pending->m_dataLen;
+    pending->m_data = nullptr;
+  }
+
+  int32_t type = request.getMessageType();
+  if (type == TcrMessage::REQUEST && request.isCallBackArguement()) {
+    reply.setCallBackArguement(true);
+  }
+  reply.setMessageTypeRequest(type);
+  // memory is released by TcrMessage setData()
+  reply.setData(data, static_cast<int32_t>(dataLen),
+                m_endpoint->getDistributedMemberID());
+  m_conn->touch();
+
+  if (reply.getMessageType() == TcrMessage::INVALID) {
+    return GF_IOERR;
+  }
+  return GF_NOERR;
+}
+
+GfErrType TcrMultiplexedConnection::sendRequestAsync(
+    const TcrMessage& request, uint32_t timeoutSec,
+    const ReplyCallback& callback) {
+  auto pending =
+      std::make_shared<PendingReply>(m_pendingLock, request.getTransId());
+  pending->m_callback = callback;
+  pending->m_deadline = ACE_OS::gettimeofday() + ACE_Time_Value(timeoutSec);
+  return writeRequest(request, pending);
+}
+
+int TcrMultiplexedConnection::readReplies(volatile bool& isRunning) {
+  s_readerThread = true;
+  LOGFINE("Started multiplexed connection reader for endpoint %s",
+          m_endpoint->name().c_str());
+  ACE_Time_Value nextExpiryCheck = ACE_OS::gettimeofday();
+  while (isRunning) {
+    size_t dataLen = 0;
+    ConnErrType opErr = CONN_NOERR;
+    char* data = nullptr;
+    try {
+      // short poll so that stop() is noticed promptly, but a reply that has
+      // started gets the whole read timeout
+      data = m_conn->pollMessage(&dataLen, &opErr, 1, m_readTimeoutSec);
+    } catch (const Exception& ex) {
+      LOGFINE("Multiplexed connection reader for endpoint %s failed: %s",
+              m_endpoint->name().c_str(), ex.getMessage());
+      opErr = CONN_IOERR;
+    }
+
+    if (opErr != CONN_NOERR) {
+      failPending(GF_IOERR);
+      break;
+    }
+    if (ACE_OS::gettimeofday() >= nextExpiryCheck) {
+      expireAsyncRequests();
+      nextExpiryCheck = ACE_OS::gettimeofday() + ACE_Time_Value(1);
+    }
+    if (data == nullptr) {
+      continue;
+    }
+
+    int32_t transId = 0;
+    PendingReplyPtr pending;
+    bool abandoned = false;
+    {
+      ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+      if (!m_pending.empty() && getTransId(data, dataLen, transId) &&
+          transId == m_pending.front()->m_transId) {
+        pending = m_pending.front();
+        m_pending.pop_front();
+        abandoned = pending->m_abandoned;
+      }
+      if (pending != nullptr && !abandoned && !pending->m_callback) {
+        pending->m_data = data;
+        pending->m_dataLen = dataLen;
+        pending->m_done = true;
+        pending->m_cond.signal();
+        continue;
+      }
+    }
+    if (pending == nullptr) {
+      LOGERROR(
+          "Received unexpected reply with transaction id %d on multiplexed "
+          "connection to endpoint %s. Possible serialization mismatch",
+          transId, m_endpoint->name().c_str());
+      ReceiveBufferPool::release(data);
+      failPending(GF_IOERR);
+      break;
+    }
+    if (abandoned) {
+      ReceiveBufferPool::release(data);
+      continue;
+    }
+    m_conn->touch();
+    invokeCallback(pending, GF_NOERR, data, dataLen);
+  }
+  LOGFINE("Stopped multiplexed connection reader for endpoint %s",
+          m_endpoint->name().c_str());
+  return 0;
+}
+
+void TcrMultiplexedConnection::expireAsyncRequests() {
+  std::vector<PendingReplyPtr> expired;
+  {
+    ACE_Time_Value now = ACE_OS::gettimeofday();
+    ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+    for (std::deque<PendingReplyPtr>::iterator iter = m_pending.begin();
+         iter != m_pending.end(); ++iter) {
+      const PendingReplyPtr& pending = *iter;
+      if (pending->m_callback && !pending->m_abandoned &&
+          now >= pending->m_deadline) {
+        // the slot stays queued so that the late reply is discarded in order
+        pending->m_abandoned = true;
+        expired.push_back(pending);
+      }
+    }
+  }
+  for (std::vector<PendingReplyPtr>::iterator iter = expired.begin();
+       iter != expired.end(); ++iter) {
+    invokeCallback(*iter, GF_TIMOUT, nullptr, 0);
+  }
+}
+
+void TcrMultiplexedConnection::failPending(GfErrType error) {
+  std::vector<PendingReplyPtr> callbacks;
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(m_pendingLock);
+    m_closed = true;
+    while (!m_pending.empty()) {
+      PendingReplyPtr pending = m_pending.front();
+      m_pending.pop_front();
+      if (pending->m_callback) {
+        if (!pending->m_abandoned) {
+          pending->m_abandoned = true;
+          callbacks.push_back(pending);
+        }
+        continue;
+      }
+      pending->m_error = error;
+      pending->m_done = true;
+      pending->m_cond.signal();
+    }
+  }
+  for (std::vector<PendingReplyPtr>::iterator iter = callbacks.begin();
+       iter != callbacks.end(); ++iter) {
+    invokeCallback(*iter, error, nullptr, 0);
+  }
+}
+
+void TcrMultiplexedConnection::invokeCallback(const PendingReplyPtr& pending,
+                                              GfErrType error, char* data,
+                                              size_t dataLen) {
+  try {
+    pending->m_callback(error, data, dataLen);
+  } catch (const Exception& ex) {
+    LOGERROR("Exception in multiplexed reply callback: %s: %s", ex.getName(),
+             ex.getMessage());
+  } catch (...) {
+    LOGERROR("Unknown exception in multiplexed reply callback");
+  }
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#ifndef GEODE_TCRMULTIPLEXEDCONNECTION_H_
+#define GEODE_TCRMULTIPLEXEDCONNECTION_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+#include <ace/Time_Value.h>
+#include <geode/geode_globals.hpp>
+#include "Task.hpp"
+#include "ReceiveBufferPool.hpp"
+#include "NonCopyable.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class TcrConnection;
+class TcrEndpoint;
+class TcrMessage;
+class TcrMessageReply;
+
+/**
+ * A pool connection shared by many application threads at once.
+ *
+ * Requests are written back-to-back on the socket without waiting for the
+ * previous reply. The server processes the messages of a connection one at a
+ * time and replies in the order it received them, so a dedicated reader
+ * thread hands each reply to the oldest outstanding request. The reply
+ * header carries no id of its own, only the transaction id of the request,
+ * which is the same for every request sent outside a transaction; the
+ * reader checks it against the request so that a stream that got out of
+ * step fails instead of handing out wrong replies. Only simple
+ * request/reply operations may use this connection;
+ * chunked responses, transactions and authenticated connections always go
+ * through an exclusive pool connection.
+ */
+class TcrMultiplexedConnection : private NonCopyable, private NonAssignable {
+ public:
+  /**
+   * Invoked on the reader thread with the raw reply, or with an error and a
+   * nullptr reply. The callback takes ownership of the reply buffer. It must
+   * hand the reply off to another thread without blocking, and must not
+   * release any reference to the connection since the reader thread cannot
+   * destroy its own connection.
+   */
+  typedef std::function<void(GfErrType, char*, size_t)> ReplyCallback;
+
+  /**
+   * Takes ownership of the given connection, which must already have
+   * completed its handshake. Once a reply starts to arrive the reader
+   * allows readTimeoutSec for the rest of it.
+   */
+  TcrMultiplexedConnection(TcrEndpoint* endpoint, TcrConnection* conn,
+                           uint32_t readTimeoutSec);
+
+  /** Stops the reader thread and closes the underlying connection. */
+  ~TcrMultiplexedConnection();
+
+  /** Starts the thread that demultiplexes replies. */
+  void start();
+
+  /**
+   * Writes the request on the shared socket and waits for its reply, or for
+   * the read timeout of the reply to expire.
+   *
+   * @return GF_NOERR on success, GF_TIMOUT if the reply did not arrive in
+   *         time and GF_IOERR if the connection failed. After GF_IOERR the
+   *         connection can no longer be used.
+   */
+  GfErrType sendRequest(const TcrMessage& request, TcrMessageReply& reply);
+
+  /**
+   * Writes the request on the shared socket and returns without waiting.
+   * The callback is invoked once the reply arrives, the connection fails or
+   * timeoutSec elapses, whichever happens first.
+   *
+   * @return GF_NOERR if the request was written, in which case the callback
+   *         will be invoked exactly once. On any other result the callback
+   *         is never invoked.
+   */
+  GfErrType sendRequestAsync(const TcrMessage& request, uint32_t timeoutSec,
+                             const ReplyCallback& callback);
+
+  /** True once the connection has failed or been closed. */
+  bool isClosed() const { return m_closed; }
+
+  /** Number of requests written whose reply has not been read yet. */
+  size_t getInFlightCount();
+
+  /** True if called on the reader thread of any multiplexed connection. */
+  static bool isReaderThread();
+
+  /**
+   * Reads the transaction id from the header of a raw reply.
+   * @return false if the reply is too short to have a header
+   */
+  static bool getTransId(const char* data, size_t dataLen, int32_t& transId);
+
+ private:
+  struct PendingReply {
+    PendingReply(ACE_Thread_Mutex& lock, int32_t transId)
+        : m_cond(lock),
+          m_transId(transId),
+          m_data(nullptr),
+          m_dataLen(0),
+          m_error(GF_NOERR),
+          m_done(false),
+          m_abandoned(false) {}
+    ~PendingReply() { ReceiveBufferPool::release(m_data); }
+
+    ACE_Condition_Thread_Mutex m_cond;
+    int32_t m_transId;
+    char* m_data;
+    size_t m_dataLen;
+    GfErrType m_error;
+    bool m_done;
+    bool m_abandoned;
+    // set only for requests sent with sendRequestAsync()
+    ReplyCallback m_callback;
+    ACE_Time_Value m_deadline;
+  };
+  typedef std::shared_ptr<PendingReply> PendingReplyPtr;
+
+  GfErrType writeRequest(const TcrMessage& request,
+                         const PendingReplyPtr& pending);
+
+  int readReplies(volatile bool& isRunning);
+
+  /** Times out asynchronous requests whose deadline has passed. */
+  void expireAsyncRequests();
+
+  /**
+   * Marks the connection closed and fails every outstanding request. Must be
+   * called without holding any lock since callbacks may be invoked.
+   */
+  void failPending(GfErrType error);
+
+  static void invokeCallback(const PendingReplyPtr& pending, GfErrType error,
+                             char* data, size_t dataLen);
+
+  TcrEndpoint* m_endpoint;
+  TcrConnection* m_conn;
+  uint32_t m_readTimeoutSec;
+  // orders writes on the socket with their position in m_pending
+  ACE_Thread_Mutex m_writeLock;
+  ACE_Thread_Mutex m_pendingLock;
+  std::deque<PendingReplyPtr> m_pending;
+  Task<TcrMultiplexedConnection>* m_reader;
+  volatile bool m_closed;
+
+  static const char* NC_Multiplex_Reader;
+};
+
+typedef std::shared_ptr<TcrMultiplexedConnection> TcrMultiplexedConnectionPtr;
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_TCRMULTIPLEXEDCONNECTION_H_
@@ -25,9 +25,26 @@ TcrPoolEndPoint::TcrPoolEndPoint(const std::string& name, CacheImpl* cache,
                                  ACE_Semaphore& redundancySema,
                                  ThinClientPoolDM* dm)
     : TcrEndpoint(name, cache, failoverSema, cleanupSema, redundancySema, dm),
-      m_dm(dm) {}
-bool TcrPoolEndPoint::checkDupAndAdd(EventIdPtr eventid) {
-  return m_dm->checkDupAndAdd(eventid);
+      m_dm(dm),
+      m_idleConnCount(0) {}
+
+TcrPoolEndPoint::~TcrPoolEndPoint() {
+  // the pool moves idle connections back to its queue before it is closed,
+  // this only catches connections released after that
+  for (std::vector<TcrConnection*>::iterator iter = m_idleConns.begin();
+       iter != m_idleConns.end(); ++iter) {
+    TcrConnection* conn = *iter;
+    GF_SAFE_DELETE_CON(conn);
+  }
+  m_idleConns.clear();
+  m_multiplexedConn = nullptr;
+  m_dm = nullptr;
+}
+bool TcrPoolEndPoint::checkDupAndAdd(EventIdPtr eventid, bool hold) {
+  return m_dm->checkDupAndAdd(eventid, hold);
+}
+void TcrPoolEndPoint::releaseEventAck(EventIdPtr eventid) {
+  m_dm->releaseEventAck(eventid);
 }
 
 void TcrPoolEndPoint::processMarker() { m_dm->processMarker(); }
@@ -50,6 +67,77 @@ void TcrPoolEndPoint::closeFailedConnection(TcrConnection*& conn) {
 
 bool TcrPoolEndPoint::isMultiUserMode() { return m_dm->isMultiUserMode(); }
 
+GfErrType TcrPoolEndPoint::getMultiplexedConnection(
+    TcrMultiplexedConnectionPtr& conn) {
+  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_multiplexedConnLock);
+  if (m_multiplexedConn != nullptr && !m_multiplexedConn->isClosed()) {
+    conn = m_multiplexedConn;
+    return GF_NOERR;
+  }
+  // release a failed connection before opening its replacement
+  m_multiplexedConn = nullptr;
+  TcrConnection* newConn = nullptr;
+  GfErrType err = createNewConnection(
+      newConn, false, false,
+      DistributedSystem::getSystemProperties()->connectTimeout(), 0, false);
+  if (err != GF_NOERR) {
+    return err;
+  }
+  uint32_t readTimeoutSec = m_dm->getReadTimeout() / 1000;
+  m_multiplexedConn = std::make_shared<TcrMultiplexedConnection>(
+      this, newConn, readTimeoutSec > 0 ? readTimeoutSec : 1);
+  m_multiplexedConn->start();
+  conn = m_multiplexedConn;
+  return GF_NOERR;
+}
+
+void TcrPoolEndPoint::closeMultiplexedConnection(
+    const TcrMultiplexedConnectionPtr& conn) {
+  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_multiplexedConnLock);
+  if (m_multiplexedConn == conn) {
+    m_multiplexedConn = nullptr;
+  }
+}
+
+void TcrPoolEndPoint::closeMultiplexedConnection() {
+  TcrMultiplexedConnectionPtr conn;
+  {
+    ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_multiplexedConnLock);
+    conn.swap(m_multiplexedConn);
+  }
+  // destroyed outside the lock, it waits for the reader thread
+  conn = nullptr;
+}
+
+bool TcrPoolEndPoint::hasMultiplexedConnection() {
+  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_multiplexedConnLock);
+  return m_multiplexedConn != nullptr && !m_multiplexedConn->isClosed();
+}
+
+void TcrPoolEndPoint::putIdleConnection(TcrConnection* conn) {
+  ACE_Guard<ACE_Thread_Mutex> guard(m_idleConnsLock);
+  m_idleConns.push_back(conn);
+  ++m_idleConnCount;
+}
+
+TcrConnection* TcrPoolEndPoint::takeIdleConnection() {
+  ACE_Guard<ACE_Thread_Mutex> guard(m_idleConnsLock);
+  if (m_idleConns.empty()) {
+    return nullptr;
+  }
+  TcrConnection* conn = m_idleConns.back();
+  m_idleConns.pop_back();
+  --m_idleConnCount;
+  return conn;
+}
+
+void TcrPoolEndPoint::takeIdleConnections(std::vector<TcrConnection*>& conns) {
+  ACE_Guard<ACE_Thread_Mutex> guard(m_idleConnsLock);
+  conns.insert(conns.end(), m_idleConns.begin(), m_idleConns.end());
+  m_idleConns.clear();
+  m_idleConnCount = 0;
+}
+
 void TcrPoolEndPoint::closeNotification() {
   LOGFINE("TcrPoolEndPoint::closeNotification..");
   m_notifyReceiver->stopNoblock();
@@ -19,8 +19,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
+#include <vector>
+#include <ace/Thread_Mutex.h>
 #include "TcrEndpoint.hpp"
 #include "PoolStatistics.hpp"
+#include "TcrMultiplexedConnection.hpp"
 namespace apache {
 namespace geode {
 namespace client {
@@ -32,7 +36,8 @@ class TcrPoolEndPoint : public TcrEndpoint {
                   ACE_Semaphore& redundancySema, ThinClientPoolDM* dm);
   virtual ThinClientPoolDM* getPoolHADM();
 
-  virtual bool checkDupAndAdd(EventIdPtr eventid);
+  virtual bool checkDupAndAdd(EventIdPtr eventid, bool hold = false);
+  virtual void releaseEventAck(EventIdPtr eventid);
   virtual void processMarker();
   virtual QueryServicePtr getQueryService();
   virtual void sendRequestForChunkedResponse(const TcrMessage& request,
@@ -50,15 +55,45 @@ class TcrPoolEndPoint : public TcrEndpoint {
   virtual bool handleIOException(const std::string& message,
                                  TcrConnection*& conn, bool isBgThread = false);
   void handleNotificationStats(int64_t byteLength);
-  virtual ~TcrPoolEndPoint() { m_dm = nullptr; }
+  virtual ~TcrPoolEndPoint();
   virtual bool isMultiUserMode();
 
+  /**
+   * Returns the connection to this server that is shared by all threads for
+   * pipelined requests, creating it if it does not exist or has failed.
+   */
+  GfErrType getMultiplexedConnection(TcrMultiplexedConnectionPtr& conn);
+  /** Drops the shared connection if it is still the given one. */
+  void closeMultiplexedConnection(const TcrMultiplexedConnectionPtr& conn);
+  /** Drops the shared connection, failing its outstanding requests. */
+  void closeMultiplexedConnection();
+  /** True if a live shared connection to this server exists. */
+  bool hasMultiplexedConnection();
+
+  /**
+   * Free list of idle pool connections to this server. Each server has its
+   * own lock so that checking connections in and out does not contend on the
+   * pool wide queue lock.
+   */
+  void putIdleConnection(TcrConnection* conn);
+  /** Takes the most recently used idle connection, or nullptr if none. */
+  TcrConnection* takeIdleConnection();
+  /** Moves every idle connection of this server into conns. */
+  void takeIdleConnections(std::vector<TcrConnection*>& conns);
+  /** Unsynchronized hint used to skip servers without idle connections. */
+  bool hasIdleConnections() const { return m_idleConnCount > 0; }
+
  protected:
   virtual void closeNotification();
   virtual void triggerRedundancyThread();
 
  private:
   ThinClientPoolDM* m_dm;
+  TcrMultiplexedConnectionPtr m_multiplexedConn;
+  ACE_Recursive_Thread_Mutex m_multiplexedConnLock;
+  std::vector<TcrConnection*> m_idleConns;
+  ACE_Thread_Mutex m_idleConnsLock;
+  std::atomic<int32_t> m_idleConnCount;
 };
 }  // namespace client
 }  // namespace geode
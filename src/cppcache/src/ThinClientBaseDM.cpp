@@ -36,11 +36,14 @@ ThinClientBaseDM::ThinClientBaseDM(TcrConnectionManager& connManager,
     : m_region(theRegion),
       m_connManager(connManager),
       m_initDone(false),
-      m_clientNotification(false),
-      m_chunks(true),
-      m_chunkProcessor(nullptr) {}
+      m_clientNotification(false) {}
 
-ThinClientBaseDM::~ThinClientBaseDM() {}
+ThinClientBaseDM::~ThinClientBaseDM() {
+  for (std::vector<ChunkProcessor*>::iterator iter = m_chunkProcessors.begin();
+       iter != m_chunkProcessors.end(); ++iter) {
+    delete *iter;
+  }
+}
 
 void ThinClientBaseDM::init() {
   if (!DistributedSystem::getSystemProperties()->isGridClient()) {
@@ -206,12 +209,23 @@ void ThinClientBaseDM::failover() {
 void ThinClientBaseDM::queueChunk(TcrChunkedContext* chunk) {
   LOGDEBUG("ThinClientBaseDM::queueChunk");
   const uint32_t timeout = 1;
-  if (m_chunkProcessor == nullptr) {
+  if (m_chunkProcessors.empty()) {
     LOGDEBUG("ThinClientBaseDM::queueChunk2");
     // process in same thread if no chunk processor thread
     chunk->handleChunk(true);
     GF_SAFE_DELETE(chunk);
-  } else if (!m_chunks.putUntil(chunk, timeout, 0)) {
+    return;
+  }
+  // chunks are queued by the thread reading the response, so the first
+  // chunk of a result picks its processor without racing the later ones
+  TcrChunkedResult* result = chunk->getResult();
+  int32_t processor = result->getChunkProcessor();
+  if (processor < 0 ||
+      processor >= static_cast<int32_t>(m_chunkProcessors.size())) {
+    processor = leastLoadedChunkProcessor();
+    result->setChunkProcessor(processor);
+  }
+  if (!m_chunkProcessors[processor]->m_chunks.putUntil(chunk, timeout, 0)) {
     LOGDEBUG("ThinClientBaseDM::queueChunk3");
     // if put in queue fails due to whatever reason then process in same thread
     LOGFINE(
@@ -225,8 +239,28 @@ void ThinClientBaseDM::queueChunk(TcrChunkedContext* chunk) {
   }
 }
 
+int32_t ThinClientBaseDM::leastLoadedChunkProcessor() {
+  int32_t leastLoaded = 0;
+  uint32_t leastChunks = m_chunkProcessors[0]->m_chunks.size();
+  for (int32_t i = 1;
+       leastChunks > 0 && i < static_cast<int32_t>(m_chunkProcessors.size());
+       ++i) {
+    uint32_t chunks = m_chunkProcessors[i]->m_chunks.size();
+    if (chunks < leastChunks) {
+      leastLoaded = i;
+      leastChunks = chunks;
+    }
+  }
+  return leastLoaded;
+}
+
+ThinClientBaseDM::ChunkProcessor::ChunkProcessor(ThinClientRegion* region)
+    : m_chunks(true), m_task(nullptr), m_region(region) {}
+
+ThinClientBaseDM::ChunkProcessor::~ChunkProcessor() { GF_SAFE_DELETE(m_task); }
+
 // the chunk processing thread
-int ThinClientBaseDM::processChunks(volatile bool& isRunning) {
+int ThinClientBaseDM::ChunkProcessor::run(volatile bool& isRunning) {
   TcrChunkedContext* chunk;
   LOGFINE("Starting chunk process thread for region %s",
           (m_region != nullptr ? m_region->getFullPath() : "(null)"));
@@ -243,22 +277,38 @@ int ThinClientBaseDM::processChunks(volatile bool& isRunning) {
   return 0;
 }
 
-// start the chunk processing thread
+// start the chunk processing threads
 void ThinClientBaseDM::startChunkProcessor() {
-  if (m_chunkProcessor == nullptr) {
-    m_chunks.open();
-    m_chunkProcessor = new Task<ThinClientBaseDM>(
-        this, &ThinClientBaseDM::processChunks, NC_ProcessChunk);
-    m_chunkProcessor->start();
+  if (m_chunkProcessors.empty()) {
+    int32_t numThreads =
+        DistributedSystem::getSystemProperties()->chunkProcessorThreads();
+    for (int32_t i = 0; i < numThreads; ++i) {
+      m_chunkProcessors.push_back(new ChunkProcessor(m_region));
+    }
+  }
+  for (std::vector<ChunkProcessor*>::iterator iter = m_chunkProcessors.begin();
+       iter != m_chunkProcessors.end(); ++iter) {
+    ChunkProcessor* processor = *iter;
+    if (processor->m_task == nullptr) {
+      processor->m_chunks.open();
+      processor->m_task = new Task<ChunkProcessor>(
+          processor, &ChunkProcessor::run, NC_ProcessChunk);
+      processor->m_task->start();
+    }
   }
 }
 
-// stop the chunk processing thread
+// stop the chunk processing threads; the processors are kept, with their
+// queues closed, so that a chunk still arriving is handled by its reader
 void ThinClientBaseDM::stopChunkProcessor() {
-  if (m_chunkProcessor != nullptr) {
-    m_chunkProcessor->stop();
-    m_chunks.close();
-    GF_SAFE_DELETE(m_chunkProcessor);
+  for (std::vector<ChunkProcessor*>::iterator iter = m_chunkProcessors.begin();
+       iter != m_chunkProcessors.end(); ++iter) {
+    ChunkProcessor* processor = *iter;
+    if (processor->m_task != nullptr) {
+      processor->m_task->stop();
+      processor->m_chunks.close();
+      GF_SAFE_DELETE(processor->m_task);
+    }
   }
 }
 
@@ -23,6 +23,7 @@
 #include <geode/geode_globals.hpp>
 #include "TcrConnectionManager.hpp"
 #include "TcrEndpoint.hpp"
+#include <functional>
 #include <vector>
 
 namespace apache {
@@ -47,6 +48,27 @@ class ThinClientBaseDM {
                                     bool attemptFailover = true,
                                     bool isBGThrad = false) = 0;
 
+  /**
+   * Invoked with the result of an asynchronous request and, when the result is
+   * GF_NOERR, the reply received for it.
+   */
+  typedef std::function<void(GfErrType, TcrMessageReply&)> AsyncReplyHandler;
+
+  /**
+   * Sends the request without waiting for its reply. The handler is invoked
+   * on a thread of the pool's thread pool, never on the thread that reads
+   * the reply.
+   *
+   * @return GF_NOERR if the request was sent, in which case the handler will
+   *         be invoked exactly once. Otherwise the handler is never invoked
+   *         and the caller should fall back to sendSyncRequest(), which also
+   *         takes care of failover.
+   */
+  virtual GfErrType sendAsyncRequest(TcrMessage& request,
+                                     const AsyncReplyHandler& handler) {
+    return GF_NOTSUP;
+  }
+
   virtual GfErrType sendSyncRequestRegisterInterest(
       TcrMessage& request, TcrMessageReply& reply, bool attemptFailover = true,
       ThinClientRegion* theRegion = nullptr, TcrEndpoint* endpoint = nullptr);
@@ -69,6 +91,9 @@ class ThinClientBaseDM {
 
   virtual bool isMultiUserMode() { return false; }
 
+  // whether PDX values in replies are wrapped in a CachedDeserializable
+  virtual bool keepsValuesSerialized() const { return false; }
+
   virtual void beforeSendingRequest(const TcrMessage& request,
                                     TcrConnection* conn);
   virtual void afterSendingRequest(const TcrMessage& request,
@@ -109,8 +134,17 @@ class ThinClientBaseDM {
 
   virtual TcrEndpoint* getActiveEndpoint() { return nullptr; }
 
-  virtual bool checkDupAndAdd(EventIdPtr eventid) {
-    return m_connManager.checkDupAndAdd(eventid);
+  /**
+   * Adds the id of a notification to the event id map unless it is a
+   * duplicate. With hold the periodic ack of its source stops short of it
+   * until releaseEventAck() is called for it.
+   */
+  virtual bool checkDupAndAdd(EventIdPtr eventid, bool hold = false) {
+    return m_connManager.checkDupAndAdd(eventid, hold);
+  }
+
+  virtual void releaseEventAck(EventIdPtr eventid) {
+    m_connManager.releaseEventAck(eventid);
   }
 
   virtual ACE_Recursive_Thread_Mutex* getRedundancyLock() {
@@ -170,7 +204,6 @@ class ThinClientBaseDM {
   ThinClientRegion* m_region;
 
   // methods for the chunk processing thread
-  int processChunks(volatile bool& isRunning);
   void startChunkProcessor();
   void stopChunkProcessor();
 
@@ -190,8 +223,26 @@ class ThinClientBaseDM {
   bool m_initDone;
   bool m_clientNotification;
 
-  Queue<TcrChunkedContext> m_chunks;
-  Task<ThinClientBaseDM>* m_chunkProcessor;
+  // processes the chunks queued to it in order; the chunks of a result all
+  // go to the same processor so that results may depend on chunk order
+  class ChunkProcessor {
+   public:
+    ChunkProcessor(ThinClientRegion* region);
+    ~ChunkProcessor();
+
+    int run(volatile bool& isRunning);
+
+    Queue<TcrChunkedContext> m_chunks;
+    Task<ChunkProcessor>* m_task;
+
+   private:
+    ThinClientRegion* m_region;
+  };
+
+  // the processor with the fewest chunks queued
+  int32_t leastLoadedChunkProcessor();
+
+  std::vector<ChunkProcessor*> m_chunkProcessors;
 
  private:
   static volatile bool s_isDeltaEnabledOnServer;
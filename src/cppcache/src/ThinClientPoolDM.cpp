@@ -31,6 +31,7 @@
 #include <geode/PoolManager.hpp>
 
 #include "NonCopyable.hpp"
+#include "GetAllBatches.hpp"
 
 using namespace apache::geode::client;
 using namespace apache::geode::statistics;
@@ -38,6 +39,25 @@ using namespace apache::geode::statistics;
 ExpiryTaskManager* getCacheImplExpiryTaskManager();
 void removePool(const char*);
 
+/**
+ * Completes an asynchronous request on a thread of the pool's thread pool.
+ * Deletes itself once run since nobody waits for it.
+ */
+class AsyncReplyWork : public ACE_Method_Request,
+                       private NonCopyable,
+                       private NonAssignable {
+  std::function<void()> m_op;
+
+ public:
+  explicit AsyncReplyWork(const std::function<void()>& op) : m_op(op) {}
+
+  virtual int call(void) {
+    m_op();
+    delete this;
+    return 0;
+  }
+};
+
 /* adongre
  * CID 28730: Other violation (MISSING_COPY)
  * Class "GetAllWork" owns resources that are managed in its constructor and
@@ -94,7 +114,8 @@ class GetAllWork : public PooledWork<GfErrType>,
         m_responseHandler->getValues(), m_responseHandler->getExceptions(),
         m_responseHandler->getResultKeys(),
         m_responseHandler->getUpdateCounters(), 0, m_addToLocalCache,
-        m_responseHandler->getResponseLock()));
+        m_responseHandler->getResponseLock(),
+        m_responseHandler->getListener()));
 
     m_reply->setChunkedResultHandler(m_resultCollector);
   }
@@ -142,6 +163,9 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
       m_isMultiUserMode(false),
       m_locHelper(nullptr),
       m_poolSize(0),
+      m_idleListEndpoints(std::make_shared<std::vector<TcrPoolEndPoint*> >()),
+      m_idleListCursor(0),
+      m_connWaiters(0),
       m_numRegions(0),
       m_server(0),
       m_connSema(0),
@@ -152,6 +176,7 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
       m_pingTaskId(-1),
       m_updateLocatorListTaskId(-1),
       m_connManageTaskId(-1),
+      m_multiplexedServer(0),
       m_PoolStatsSampler(nullptr),
       m_clientMetadataService(nullptr),
       m_primaryServerQueueSize(PRIMARY_QUEUE_NOT_AVAILABLE) {
@@ -388,6 +413,9 @@ void ThinClientPoolDM::cleanStaleConnections(volatile bool& isRunning) {
 
   LOGDEBUG("Cleaning stale connections");
 
+  // idle and expiry checks below only look at the queue
+  flushIdleConnections();
+
   int idle = getIdleTimeout();
 
   ACE_Time_Value _idle(idle / 1000, (idle % 1000) * 1000);
@@ -812,9 +840,22 @@ void ThinClientPoolDM::destroy(bool keepAlive) {
     // closing all the thread local connections ( sticky).
     LOGDEBUG("ThinClientPoolDM::destroy( ): closing FairQueue, pool size = %d",
              m_poolSize.load());
+    flushIdleConnections();
     close();
     LOGDEBUG("ThinClientPoolDM::destroy( ): after close ");
 
+    // the replies of asynchronous requests are completed on the thread pool
+    // and refer to the endpoints, so fail the outstanding ones and wait for
+    // them before deleting the endpoints
+    for (ACE_Map_Manager<std::string, TcrEndpoint*,
+                         ACE_Recursive_Thread_Mutex>::iterator iter =
+             m_endpoints.begin();
+         iter != m_endpoints.end(); ++iter) {
+      static_cast<TcrPoolEndPoint*>((*iter).int_id_)
+          ->closeMultiplexedConnection();
+    }
+    m_asyncReplies.waitForNone();
+
     for (ACE_Map_Manager<std::string, TcrEndpoint*,
                          ACE_Recursive_Thread_Mutex>::iterator iter =
              m_endpoints.begin();
@@ -1265,13 +1306,18 @@ GfErrType ThinClientPoolDM::sendSyncRequest(TcrMessage& request,
       const auto& serverLocation = locationIter.first;
       if (serverLocation == nullptr) {
       }
-      const auto& keys = locationIter.second;
-      auto worker =
-          new GetAllWork(this, region, serverLocation, keys, attemptFailover,
-                         isBGThread, responseHandler->getAddToLocalCache(),
-                         responseHandler, request.getCallbackArgument());
-      threadPool->perform(worker);
-      getAllWorkers.push_back(worker);
+      // the batches for a server are in flight together, each on a
+      // connection of its own, and their replies are read as they arrive
+      for (const auto& batch :
+           splitGetAllBatches(locationIter.second,
+                              m_attrs->getGetAllBatchSize())) {
+        auto worker = new GetAllWork(
+            this, region, serverLocation, batch, attemptFailover, isBGThread,
+            responseHandler->getAddToLocalCache(), responseHandler,
+            request.getCallbackArgument());
+        threadPool->perform(worker);
+        getAllWorkers.push_back(worker);
+      }
     }
     reply.setMessageType(TcrMessage::RESPONSE);
 
@@ -1331,6 +1377,11 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
     request.setTimeout(this->getReadTimeout() / 1000);
   }
 
+  if (isMultiplexedRequest(request)) {
+    return sendMultiplexedRequest(request, reply, attemptFailover,
+                                  serverLocation);
+  }
+
   bool retryAllEPsOnce = false;
   if (m_attrs->getRetryAttempts() == -1) {
     retryAllEPsOnce = true;
@@ -1369,6 +1420,7 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
     bool isUserNeedToReAuthenticate = false;
     bool singleHopConnFound = false;
     bool connFound = false;
+    int64_t checkoutStartNanos = Utils::startStatOpTime();
     if (!this->m_isMultiUserMode ||
         (!TcrMessage::isUserInitiativeOps(request))) {
       conn = getConnectionFromQueueW(&queueErr, excludeServers, isBGThread,
@@ -1398,6 +1450,11 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
             !(userAttr->isEndpointAuthenticated(conn->getEndpointObject()));
       }
     }
+    Utils::updateStatOpTime(
+        getStats().getStats(),
+        PoolStatType::getInstance()->getConnectionCheckoutTimeId(),
+        checkoutStartNanos);
+    getStats().incConnectionCheckouts();
 
     if (queueErr == GF_CLIENT_WAIT_TIMEOUT) {
       LOGFINE("Request timeout at client only");
@@ -1595,6 +1652,317 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
   return error;
 }
 
+bool ThinClientPoolDM::isMultiplexedRequest(const TcrMessage& request) {
+  if (!m_attrs->getMultiplexedConnections() || m_isSecurityOn ||
+      m_isMultiUserMode || request.forTransaction()) {
+    return false;
+  }
+  // SSL streams cannot be read and written from two threads at once
+  if (DistributedSystem::getSystemProperties()->sslEnabled()) {
+    return false;
+  }
+  // only operations answered by a single, unchunked reply
+  switch (request.getMessageType()) {
+    case TcrMessage::REQUEST:
+    case TcrMessage::PUT:
+    case TcrMessage::DESTROY:
+    case TcrMessage::INVALIDATE:
+    case TcrMessage::CONTAINS_KEY:
+    case TcrMessage::SIZE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+TcrPoolEndPoint* ThinClientPoolDM::selectMultiplexedEndpoint(
+    TcrMessage& request, int8_t& version,
+    const BucketServerLocationPtr& serverLocation,
+    std::set<ServerLocation>& excludeServers) {
+  TcrEndpoint* ep = nullptr;
+  if (serverLocation != nullptr) {
+    ep = getEndPoint(serverLocation, version, excludeServers);
+  } else if (m_attrs->getPRSingleHopEnabled() && request.forSingleHop()) {
+    BucketServerLocationPtr slTmp = nullptr;
+    ep = getSingleHopServer(request, version, slTmp, excludeServers);
+  }
+  if (ep == nullptr) {
+    // prefer servers that already have a live shared connection so that the
+    // locator is not queried for every operation
+    std::vector<TcrPoolEndPoint*> candidates;
+    {
+      ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_endpointsLock);
+      for (ACE_Map_Manager<std::string, TcrEndpoint*,
+                           ACE_Recursive_Thread_Mutex>::iterator it =
+               m_endpoints.begin();
+           it != m_endpoints.end(); it++) {
+        TcrPoolEndPoint* candidate =
+            static_cast<TcrPoolEndPoint*>((*it).int_id_);
+        if (candidate->connected() && candidate->hasMultiplexedConnection() &&
+            !excludeServer(candidate->name(), excludeServers)) {
+          candidates.push_back(candidate);
+        }
+      }
+    }
+    if (!candidates.empty()) {
+      return candidates[m_multiplexedServer++ % candidates.size()];
+    }
+    ep = addEP(selectEndpoint(excludeServers).c_str());
+  }
+  return static_cast<TcrPoolEndPoint*>(ep);
+}
+
+void ThinClientPoolDM::refreshMetadataForReply(const std::string& regionName,
+                                               TcrMessageReply& reply) {
+  if (m_clientMetadataService == nullptr || reply.getMetaDataVersion() == 0) {
+    return;
+  }
+  RegionPtr region;
+  m_connManager.getCacheImpl()->getRegion(regionName.c_str(), region);
+  if (region != nullptr) {
+    LOGFINE("Need to refresh pr-meta-data");
+    m_clientMetadataService->enqueueForMetadataRefresh(
+        region->getFullPath(), reply.getserverGroupVersion());
+  }
+}
+
+GfErrType ThinClientPoolDM::sendAsyncRequest(TcrMessage& request,
+                                             const AsyncReplyHandler& handler) {
+  request.setTimeout(this->getReadTimeout() / 1000);
+  if (!isMultiplexedRequest(request)) {
+    return GF_NOTSUP;
+  }
+
+  std::set<ServerLocation> excludeServers;
+  int8_t version = 0;
+  TcrPoolEndPoint* ep = nullptr;
+  try {
+    ep = selectMultiplexedEndpoint(request, version, nullptr, excludeServers);
+  } catch (const Exception& ex) {
+    LOGFINE("ThinClientPoolDM::sendAsyncRequest: %s", ex.getMessage());
+    return GF_NOTCON;
+  }
+  TcrMultiplexedConnectionPtr conn;
+  GfErrType err = ep->getMultiplexedConnection(conn);
+  if (err != GF_NOERR) {
+    return err;
+  }
+
+  int32_t type = request.getMessageType();
+  int32_t transId = request.getTransId();
+  bool isCallBackArg = request.isCallBackArguement();
+  bool forSingleHop = request.forSingleHop();
+  std::string regionName = request.getRegionName();
+  // the connection holds the callback, so only refer back to it weakly
+  std::weak_ptr<TcrMultiplexedConnection> weakConn = conn;
+
+  getStats().setCurClientOps(++m_clientOps);
+  m_asyncReplies.started();
+  err = conn->sendRequestAsync(
+      request, this->getReadTimeout() / 1000,
+      [this, ep, weakConn, type, transId, isCallBackArg, forSingleHop,
+       regionName, handler](GfErrType error, char* data, size_t dataLen) {
+        // called on the reader thread of the connection, which has to go on
+        // reading replies and must never release its own connection, so the
+        // reply is processed and the handler invoked on a pool thread
+        TPSingleton::instance()->perform(new AsyncReplyWork([=]() {
+          completeAsyncRequest(ep, weakConn, type, transId, isCallBackArg,
+                               forSingleHop, regionName, handler, error,
+                               data, dataLen);
+        }));
+      });
+  if (err != GF_NOERR) {
+    m_asyncReplies.completed();
+    getStats().setCurClientOps(--m_clientOps);
+    ep->closeMultiplexedConnection(conn);
+  }
+  return err;
+}
+
+void ThinClientPoolDM::completeAsyncRequest(
+    TcrPoolEndPoint* ep, const std::weak_ptr<TcrMultiplexedConnection>& conn,
+    int32_t type, int32_t transId, bool isCallBackArg, bool forSingleHop,
+    const std::string& regionName, const AsyncReplyHandler& handler,
+    GfErrType error, char* data, size_t dataLen) {
+  TcrMessageReply reply(true, this);
+  if (error == GF_NOERR) {
+    if (type == TcrMessage::REQUEST && isCallBackArg) {
+      reply.setCallBackArguement(true);
+    }
+    reply.setMessageTypeRequest(type);
+    // memory is released by TcrMessage setData()
+    reply.setData(data, static_cast<int32_t>(dataLen),
+                  ep->getDistributedMemberID());
+    if (reply.getMessageType() == TcrMessage::INVALID) {
+      error = GF_IOERR;
+    } else if (reply.getTransId() != transId) {
+      LOGERROR(
+          "Transaction ids do not match on multiplexed connection to "
+          "endpoint %s: %d, %d. Possible serialization mismatch",
+          ep->name().c_str(), transId, reply.getTransId());
+      error = GF_NOTCON;
+    }
+    error = handleEPError(ep, reply, error);
+  }
+
+  getStats().setCurClientOps(--m_clientOps);
+  if (error == GF_NOERR) {
+    getStats().incSucceedClientOps();
+    if (forSingleHop) {
+      refreshMetadataForReply(regionName, reply);
+    }
+  } else if (error == GF_TIMOUT) {
+    getStats().incTimeoutClientOps();
+  } else {
+    getStats().incFailedClientOps();
+    // the thread pool runs requests inline once it has been shut down; a
+    // failed connection left to the endpoint is replaced on its next use
+    if (!TcrMultiplexedConnection::isReaderThread()) {
+      TcrMultiplexedConnectionPtr failedConn = conn.lock();
+      if (failedConn != nullptr) {
+        ep->closeMultiplexedConnection(failedConn);
+      }
+    }
+  }
+
+  // Top-level only sees NotConnectedException
+  if (error == GF_IOERR) {
+    error = GF_NOTCON;
+  }
+  try {
+    handler(error, reply);
+  } catch (const Exception& ex) {
+    LOGERROR("Exception in asynchronous reply handler: %s: %s", ex.getName(),
+             ex.getMessage());
+  } catch (...) {
+    LOGERROR("Unknown exception in asynchronous reply handler");
+  }
+  m_asyncReplies.completed();
+}
+
+GfErrType ThinClientPoolDM::sendGetAllAsync(
+    const RegionPtr& region, const VectorOfCacheableKeyPtr& keys,
+    const UserDataPtr& aCallbackArgument,
+    ChunkedGetAllResponse& responseHandler,
+    const GetAllReplyHandler& processReply, const GetAllCompletion& done) {
+  std::vector<std::pair<BucketServerLocationPtr, VectorOfCacheableKeyPtr> >
+      requests;
+  ClientMetadataService::ServerToFilterMapPtr locationMap;
+  if (m_attrs->getPRSingleHopEnabled() && m_clientMetadataService != nullptr) {
+    locationMap =
+        m_clientMetadataService->getServerToFilterMap(*keys, region, false);
+  }
+  if (locationMap) {
+    for (const auto& locationIter : *locationMap) {
+      for (const auto& batch : splitGetAllBatches(
+               locationIter.second, m_attrs->getGetAllBatchSize())) {
+        requests.emplace_back(locationIter.first, batch);
+      }
+    }
+  } else {
+    requests.emplace_back(nullptr, keys);
+  }
+
+  // GET_ALL replies are chunked and cannot be read off a multiplexed
+  // connection, so every request is sent synchronously from a pool thread
+  auto remaining = std::make_shared<std::atomic<size_t> >(requests.size());
+  auto firstError = std::make_shared<std::atomic<GfErrType> >(GF_NOERR);
+  ThreadPool* threadPool = TPSingleton::instance();
+  for (const auto& request : requests) {
+    // created on this thread, which has the user attributes of the caller
+    auto worker = std::make_shared<GetAllWork>(
+        this, region, request.first, request.second, true, false,
+        responseHandler.getAddToLocalCache(), &responseHandler,
+        aCallbackArgument);
+    m_asyncReplies.started();
+    threadPool->perform(new AsyncReplyWork([=]() {
+      GfErrType err = worker->execute();
+      if (err == GF_NOERR) {
+        err = processReply(*worker->getReply());
+      }
+      if (err != GF_NOERR) {
+        GfErrType noError = GF_NOERR;
+        firstError->compare_exchange_strong(noError, err);
+      }
+      if (--*remaining == 0) {
+        done(*firstError);
+      }
+      m_asyncReplies.completed();
+    }));
+  }
+  return GF_NOERR;
+}
+
+GfErrType ThinClientPoolDM::sendMultiplexedRequest(
+    TcrMessage& request, TcrMessageReply& reply, bool attemptFailover,
+    const BucketServerLocationPtr& serverLocation) {
+  GfErrType error = GF_NOTCON;
+  bool retryAllEPsOnce = false;
+  if (m_attrs->getRetryAttempts() == -1) {
+    retryAllEPsOnce = true;
+  }
+  long retry = m_attrs->getRetryAttempts() + 1;
+  std::set<ServerLocation> excludeServers;
+  bool firstTry = true;
+  while (retryAllEPsOnce || retry--) {
+    if (!firstTry) request.updateHeaderForRetry();
+    uint32_t lastExcludeSize = static_cast<uint32_t>(excludeServers.size());
+    int8_t version = 0;
+
+    TcrPoolEndPoint* ep = nullptr;
+    try {
+      ep = selectMultiplexedEndpoint(request, version, serverLocation,
+                                     excludeServers);
+    } catch (const Exception& ex) {
+      LOGFINE("ThinClientPoolDM::sendMultiplexedRequest: %s",
+              ex.getMessage());
+      error = GF_NOTCON;
+      break;
+    }
+
+    TcrMultiplexedConnectionPtr conn;
+    error = ep->getMultiplexedConnection(conn);
+    if (error == GF_NOERR) {
+      error = conn->sendRequest(request, reply);
+      if (error != GF_NOERR && error != GF_TIMOUT) {
+        ep->closeMultiplexedConnection(conn);
+      }
+      error = handleEPError(ep, reply, error);
+    }
+    if (error != GF_NOERR) {
+      excludeServers.insert(ServerLocation(ep->name()));
+    } else if (request.forSingleHop()) {
+      refreshMetadataForReply(request.getRegionName(), reply);
+    }
+
+    if (excludeServers.size() == lastExcludeSize) {
+      excludeServers.clear();
+      if (retryAllEPsOnce) {
+        break;
+      }
+    }
+    if (!attemptFailover || error == GF_NOERR) {
+      break;
+    }
+    firstTry = false;
+  }
+
+  getStats().setCurClientOps(--m_clientOps);
+  if (error == GF_NOERR) {
+    getStats().incSucceedClientOps();
+  } else if (error == GF_TIMOUT) {
+    getStats().incTimeoutClientOps();
+  } else {
+    getStats().incFailedClientOps();
+  }
+
+  // Top-level only sees NotConnectedException
+  if (error == GF_IOERR) {
+    error = GF_NOTCON;
+  }
+  return error;
+}
+
 void ThinClientPoolDM::removeEPConnections(int numConn,
                                            bool triggerManageConn) {
   // TODO: Delete EP
@@ -1980,7 +2348,7 @@ GfErrType ThinClientPoolDM::sendRequestToEP(const TcrMessage& request,
       }
 
       if (putConnInPool) {
-        put(conn, false);
+        releaseConnection(conn);
       } else {
         if (isTmpConnectedStatus) currentEndpoint->setConnectionStatus(false);
         conn->close();
@@ -2042,6 +2410,14 @@ TcrEndpoint* ThinClientPoolDM::addEP(const char* endpointName) {
                m_poolName.c_str());
       GF_DEV_ASSERT(
           "ThinClientPoolDM::addEP( ): failed to add endpoint" ? false : false);
+    } else {
+      auto idleListEndpoints = std::make_shared<std::vector<TcrPoolEndPoint*> >(
+          *std::atomic_load(&m_idleListEndpoints));
+      idleListEndpoints->push_back(static_cast<TcrPoolEndPoint*>(ep));
+      std::atomic_store(
+          &m_idleListEndpoints,
+          std::shared_ptr<const std::vector<TcrPoolEndPoint*> >(
+              idleListEndpoints));
     }
   }
   // Update Server Stats
@@ -2051,6 +2427,7 @@ TcrEndpoint* ThinClientPoolDM::addEP(const char* endpointName) {
 
 void ThinClientPoolDM::netDown() {
   ACE_Guard<ACE_Recursive_Thread_Mutex> guard(getPoolLock());
+  flushIdleConnections();
   close();
   reset();
 }
@@ -2210,6 +2587,13 @@ bool ThinClientPoolDM::excludeConnection(
 }
 
 TcrConnection* ThinClientPoolDM::getFromEP(TcrEndpoint* theEP) {
+  TcrConnection* conn =
+      static_cast<TcrPoolEndPoint*>(theEP)->takeIdleConnection();
+  if (conn != nullptr) {
+    getStats().incIdleListCheckouts();
+    return conn;
+  }
+
   ACE_Guard<ACE_Recursive_Thread_Mutex> _guard(m_queueLock);
   for (std::deque<TcrConnection*>::iterator itr = m_queue.begin();
        itr != m_queue.end(); itr++) {
@@ -2229,6 +2613,16 @@ void ThinClientPoolDM::removeEPConnections(TcrEndpoint* theEP) {
   int32_t size = static_cast<int32_t>(m_queue.size());
   int numConn = 0;
 
+  std::vector<TcrConnection*> idleConns;
+  static_cast<TcrPoolEndPoint*>(theEP)->takeIdleConnections(idleConns);
+  for (std::vector<TcrConnection*>::iterator iter = idleConns.begin();
+       iter != idleConns.end(); ++iter) {
+    TcrConnection* curConn = *iter;
+    curConn->close();
+    GF_SAFE_DELETE(curConn);
+    numConn++;
+  }
+
   while (size--) {
     TcrConnection* curConn = m_queue.back();
     m_queue.pop_back();
@@ -2247,7 +2641,11 @@ void ThinClientPoolDM::removeEPConnections(TcrEndpoint* theEP) {
 TcrConnection* ThinClientPoolDM::getNoGetLock(
     bool& isClosed, GfErrType* error, std::set<ServerLocation>& excludeServers,
     bool& maxConnLimit) {
-  TcrConnection* returnT = nullptr;
+  TcrConnection* returnT = getFromIdleLists(excludeServers);
+  if (returnT != nullptr) {
+    isClosed = false;
+    return returnT;
+  }
   {
     ACE_Guard<ACE_Recursive_Thread_Mutex> _guard(m_queueLock);
 
@@ -2274,6 +2672,59 @@ TcrConnection* ThinClientPoolDM::getNoGetLock(
   return returnT;
 }
 
+TcrConnection* ThinClientPoolDM::getFromIdleLists(
+    std::set<ServerLocation>& excludeServers) {
+  std::shared_ptr<const std::vector<TcrPoolEndPoint*> > endpoints =
+      std::atomic_load(&m_idleListEndpoints);
+  size_t numEndpoints = endpoints->size();
+  if (numEndpoints == 0) {
+    return nullptr;
+  }
+  // start at a different endpoint on every call to spread the checkouts
+  size_t start = m_idleListCursor++;
+  for (size_t i = 0; i < numEndpoints; i++) {
+    TcrPoolEndPoint* ep = (*endpoints)[(start + i) % numEndpoints];
+    if (!ep->hasIdleConnections() || excludeServer(ep->name(), excludeServers)) {
+      continue;
+    }
+    TcrConnection* conn = ep->takeIdleConnection();
+    if (conn != nullptr) {
+      getStats().incIdleListCheckouts();
+      return conn;
+    }
+  }
+  return nullptr;
+}
+
+void ThinClientPoolDM::releaseConnection(TcrConnection* conn) {
+  TcrPoolEndPoint* ep =
+      static_cast<TcrPoolEndPoint*>(conn->getEndpointObject());
+  ep->putIdleConnection(conn);
+  // waiters block on the queue, so hand them a connection through it; the
+  // waiter count is read after the push so that either this thread sees the
+  // waiter or the waiter sees the connection in the idle list
+  if (m_connWaiters > 0) {
+    TcrConnection* idleConn = ep->takeIdleConnection();
+    if (idleConn != nullptr) {
+      put(idleConn, false);
+    }
+  }
+}
+
+void ThinClientPoolDM::flushIdleConnections() {
+  std::shared_ptr<const std::vector<TcrPoolEndPoint*> > endpoints =
+      std::atomic_load(&m_idleListEndpoints);
+  std::vector<TcrConnection*> idleConns;
+  for (std::vector<TcrPoolEndPoint*>::const_iterator iter = endpoints->begin();
+       iter != endpoints->end(); ++iter) {
+    (*iter)->takeIdleConnections(idleConns);
+  }
+  for (std::vector<TcrConnection*>::iterator iter = idleConns.begin();
+       iter != idleConns.end(); ++iter) {
+    put(*iter, false);
+  }
+}
+
 bool ThinClientPoolDM::exclude(TcrConnection* conn,
                                std::set<ServerLocation>& excludeServers) {
   return excludeConnection(conn, excludeServers);
@@ -43,6 +43,7 @@
 #include "TXState.hpp"
 
 #include "NonCopyable.hpp"
+#include "InFlightCounter.hpp"
 
 namespace apache {
 namespace geode {
@@ -88,10 +89,31 @@ class ThinClientPoolDM
   virtual GfErrType sendSyncRequest(TcrMessage& request, TcrMessageReply& reply,
                                     bool attemptFailover = true,
                                     bool isBGThread = false);
+  virtual GfErrType sendAsyncRequest(TcrMessage& request,
+                                     const AsyncReplyHandler& handler);
+
   GfErrType sendSyncRequest(TcrMessage& request, TcrMessageReply& reply,
                             bool attemptFailover, bool isBGThread,
                             const BucketServerLocationPtr& serverLocation);
 
+  typedef std::function<GfErrType(TcrMessage&)> GetAllReplyHandler;
+  typedef std::function<void(GfErrType)> GetAllCompletion;
+
+  /**
+   * Sends the GET_ALL requests of a getAll without waiting for their
+   * replies. The keys are split per server and into batches the way
+   * sendSyncRequest() does for a getAll, and each request is sent from the
+   * thread pool with the replies merged by the given response handler.
+   * processReply turns the reply to a request into its error, and done is
+   * called once with the first error after the last request completes.
+   */
+  GfErrType sendGetAllAsync(const RegionPtr& region,
+                            const VectorOfCacheableKeyPtr& keys,
+                            const UserDataPtr& aCallbackArgument,
+                            ChunkedGetAllResponse& responseHandler,
+                            const GetAllReplyHandler& processReply,
+                            const GetAllCompletion& done);
+
   // Pool Specific Fns.
   virtual const CacheableStringArrayPtr getLocators() const;
   virtual const CacheableStringArrayPtr getServers();
@@ -130,8 +152,11 @@ class ThinClientPoolDM
     return (ClientProxyMembershipID*)m_memId;
   }
   virtual void processMarker(){};
-  virtual bool checkDupAndAdd(EventIdPtr eventid) {
-    return m_connManager.checkDupAndAdd(eventid);
+  virtual bool checkDupAndAdd(EventIdPtr eventid, bool hold = false) {
+    return m_connManager.checkDupAndAdd(eventid, hold);
+  }
+  virtual void releaseEventAck(EventIdPtr eventid) {
+    m_connManager.releaseEventAck(eventid);
   }
   ACE_Recursive_Thread_Mutex& getPoolLock() { return getQueueLock(); }
   void reducePoolSize(int num);
@@ -157,6 +182,9 @@ class ThinClientPoolDM
   void updateNotificationStats(bool isDeltaSuccess, long timeInNanoSecond);
   virtual bool isSecurityOn() { return m_isSecurityOn || m_isMultiUserMode; }
   virtual bool isMultiUserMode() { return m_isMultiUserMode; }
+  virtual bool keepsValuesSerialized() const {
+    return m_attrs->getLazyDeserialization();
+  }
 
   virtual void sendUserCacheCloseMessage(bool keepAlive);
 
@@ -186,6 +214,12 @@ class ThinClientPoolDM
   virtual TcrEndpoint* getEndPoint(
       const BucketServerLocationPtr& serverLocation, int8_t& version,
       std::set<ServerLocation>& excludeServers);
+  // processes the reply of sendAsyncRequest() and invokes its handler
+  void completeAsyncRequest(
+      TcrPoolEndPoint* ep, const std::weak_ptr<TcrMultiplexedConnection>& conn,
+      int32_t type, int32_t transId, bool isCallBackArg, bool forSingleHop,
+      const std::string& regionName, const AsyncReplyHandler& handler,
+      GfErrType error, char* data, size_t dataLen);
 
   ClientMetadataService* getClientMetaDataService() {
     return m_clientMetadataService;
@@ -229,9 +263,11 @@ class ThinClientPoolDM
     if (isTransaction) {
       m_manager->setStickyConnection(conn, isTransaction);
     } else {
-      put(conn, false);
+      releaseConnection(conn);
     }
   };
+  // Returns a connection to the idle list of its endpoint.
+  void releaseConnection(TcrConnection* conn);
 
   GfErrType doFailover(TcrConnection* conn);
 
@@ -361,6 +397,18 @@ class ThinClientPoolDM
   // get endpoint using the endpoint string
   TcrEndpoint* getEndPoint(std::string epNameStr);
 
+  // true if the request may be pipelined on a shared multiplexed connection
+  bool isMultiplexedRequest(const TcrMessage& request);
+  GfErrType sendMultiplexedRequest(
+      TcrMessage& request, TcrMessageReply& reply, bool attemptFailover,
+      const BucketServerLocationPtr& serverLocation);
+  void refreshMetadataForReply(const std::string& regionName,
+                               TcrMessageReply& reply);
+  TcrPoolEndPoint* selectMultiplexedEndpoint(
+      TcrMessage& request, int8_t& version,
+      const BucketServerLocationPtr& serverLocation,
+      std::set<ServerLocation>& excludeServers);
+
   bool m_isSecurityOn;
   bool m_isMultiUserMode;
 
@@ -372,12 +420,25 @@ class ThinClientPoolDM
         getNoGetLock(isClosed, error, excludeServers, maxConnLimit);
 
     if (mp == nullptr && !isClosed) {
-      mp = getUntilWithToken(sec, isClosed, &excludeServers);
+      ++m_connWaiters;
+      // a connection released before this thread was counted as a waiter is
+      // not handed over to the queue, so look at the idle lists once more
+      mp = getFromIdleLists(excludeServers);
+      if (mp == nullptr) {
+        mp = getUntilWithToken(sec, isClosed, &excludeServers);
+      }
+      --m_connWaiters;
     }
 
     return mp;
   }
 
+  // Lock free scan of the per endpoint idle connection lists.
+  TcrConnection* getFromIdleLists(std::set<ServerLocation>& excludeServers);
+  // Moves all idle connections back into the queue, e.g. so that the
+  // connection manager or close() sees every idle connection.
+  void flushIdleConnections();
+
   TcrConnection* getNoGetLock(bool& isClosed, GfErrType* error,
                               std::set<ServerLocation>& excludeServers,
                               bool& maxConnLimit);
@@ -400,6 +461,12 @@ class ThinClientPoolDM
   volatile ThinClientLocatorHelper* m_locHelper;
 
   std::atomic<int32_t> m_poolSize;  // Actual Size of Pool
+  // endpoints whose idle lists are scanned on checkout; replaced as a whole
+  // when an endpoint is added so that readers never need m_endpointsLock
+  std::shared_ptr<const std::vector<TcrPoolEndPoint*> > m_idleListEndpoints;
+  std::atomic<uint32_t> m_idleListCursor;
+  // threads waiting in the queue for a connection
+  std::atomic<int32_t> m_connWaiters;
   int m_numRegions;
 
   // for selectEndpoint
@@ -422,6 +489,10 @@ class ThinClientPoolDM
   void cleanStaleConnections(volatile bool& isRunning);
   void restoreMinConnections(volatile bool& isRunning);
   std::atomic<int32_t> m_clientOps;  // Actual Size of Pool
+  // round-robin position for multiplexed endpoint selection
+  std::atomic<uint32_t> m_multiplexedServer;
+  // asynchronous requests not yet completed on the thread pool
+  InFlightCounter m_asyncReplies;
   statistics::PoolStatsSampler* m_PoolStatsSampler;
   ClientMetadataService* m_clientMetadataService;
   friend class CacheImpl;
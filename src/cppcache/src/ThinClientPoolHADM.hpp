@@ -59,8 +59,12 @@ class ThinClientPoolHADM : public ThinClientPoolDM {
 
   void sendNotificationCloseMsgs();
 
-  bool checkDupAndAdd(EventIdPtr eventid) {
-    return m_redundancyManager->checkDupAndAdd(eventid);
+  bool checkDupAndAdd(EventIdPtr eventid, bool hold = false) {
+    return m_redundancyManager->checkDupAndAdd(eventid, hold);
+  }
+
+  void releaseEventAck(EventIdPtr eventid) {
+    m_redundancyManager->releaseEventAck(eventid);
   }
 
   void processMarker() {
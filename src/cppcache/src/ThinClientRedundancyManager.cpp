@@ -1266,9 +1266,15 @@ void ThinClientRedundancyManager::startPeriodicAck() {
 
 // notification dup check with the help of eventidmap - called by
 // ThinClientRegion
-bool ThinClientRedundancyManager::checkDupAndAdd(EventIdPtr eventid) {
+bool ThinClientRedundancyManager::checkDupAndAdd(EventIdPtr eventid,
+                                                 bool hold) {
   EventIdMapEntry entry = EventIdMap::make(eventid);
-  return m_eventidmap.put(entry.first, entry.second, true);
+  return m_eventidmap.put(entry.first, entry.second, true, hold);
+}
+
+void ThinClientRedundancyManager::releaseEventAck(EventIdPtr eventid) {
+  EventIdMapEntry entry = EventIdMap::make(eventid);
+  m_eventidmap.release(entry.first, entry.second->getSeqNum());
 }
 
 void ThinClientRedundancyManager::netDown() {
@@ -71,7 +71,8 @@ class ThinClientRedundancyManager {
                               ThinClientBaseDM* theHADM);
   void readyForEvents();
   void startPeriodicAck();
-  bool checkDupAndAdd(EventIdPtr eventid);
+  bool checkDupAndAdd(EventIdPtr eventid, bool hold = false);
+  void releaseEventAck(EventIdPtr eventid);
   void netDown();
   void acquireRedundancyLock() { m_redundantEndpointsLock.acquire_read(); }
   void releaseRedundancyLock() { m_redundantEndpointsLock.release(); }
@@ -35,6 +35,7 @@
 #include <geode/UserFunctionExecutionException.hpp>
 #include "PutAllPartialResultServerException.hpp"
 #include "VersionedCacheableObjectPartList.hpp"
+#include "ExpiryHandler_T.hpp"
 //#include "PutAllPartialResult.hpp"
 
 using namespace apache::geode::client;
@@ -47,6 +48,12 @@ void setTSSExceptionMessage(const char* exMsg);
 }  // namespace geode
 }  // namespace apache
 
+namespace {
+// the id of the notification being processed on this thread if its periodic
+// ack is held; taken by the batch its entry event goes to, if any
+thread_local EventIdPtr s_heldEventId;
+}  // namespace
+
 class PutAllWork : public PooledWork<GfErrType>,
                    private NonCopyable,
                    private NonAssignable {
@@ -334,8 +341,9 @@ ThinClientRegion::ThinClientRegion(const std::string& name, CacheImpl* cache,
     : LocalRegion(name, cache, rPtr, attributes, stats, shared),
       m_tcrdm((ThinClientBaseDM*)0),
       m_notifyRelease(false),
-      m_notificationSema(1),
-      m_isMetaDataRefreshed(false) {
+      m_notificationLock(),
+      m_isMetaDataRefreshed(false),
+      m_eventBatchTaskId(-1) {
   m_transactionEnabled = true;
   m_isDurableClnt =
       strlen(DistributedSystem::getSystemProperties()->durableClientId()) > 0;
@@ -957,6 +965,30 @@ GfErrType ThinClientRegion::getNoThrow_remote(
   err = m_tcrdm->sendSyncRequest(request, reply);
   if (err != GF_NOERR) return err;
 
+  return processGetReply(reply, valPtr, versionTag);
+}
+
+GfErrType ThinClientRegion::getNoThrow_remoteAsync(
+    const CacheableKeyPtr& keyPtr, const UserDataPtr& aCallbackArgument,
+    const RemoteGetHandler& handler) {
+  TcrMessageRequest request(this, keyPtr, aCallbackArgument, m_tcrdm);
+  // the region must outlive the request
+  auto region = std::static_pointer_cast<ThinClientRegion>(shared_from_this());
+  return m_tcrdm->sendAsyncRequest(
+      request, [region, handler](GfErrType err, TcrMessageReply& reply) {
+        CacheablePtr valPtr;
+        VersionTagPtr versionTag;
+        if (err == GF_NOERR) {
+          err = region->processGetReply(reply, valPtr, versionTag);
+        }
+        handler(err, valPtr, versionTag);
+      });
+}
+
+GfErrType ThinClientRegion::processGetReply(TcrMessageReply& reply,
+                                            CacheablePtr& valPtr,
+                                            VersionTagPtr& versionTag) {
+  GfErrType err = GF_NOERR;
   // put the object into local region
   switch (reply.getMessageType()) {
     case TcrMessage::RESPONSE: {
@@ -1054,16 +1086,43 @@ GfErrType ThinClientRegion::putNoThrow_remote(
       err = m_tcrdm->sendSyncRequest(request, *reply);
     }
   }
-  if (err != GF_NOERR) return err;
+  if (err == GF_NOERR) {
+    err = processPutReply(*reply, versionTag);
+  }
+  delete reply;
+  reply = nullptr;
+  return err;
+}
 
+GfErrType ThinClientRegion::putNoThrow_remoteAsync(
+    const CacheableKeyPtr& keyPtr, const CacheablePtr& valuePtr,
+    const UserDataPtr& aCallbackArgument, const RemoteUpdateHandler& handler) {
+  // always send the full value; a delta rejected by the server would need a
+  // second round trip
+  TcrMessagePut request(this, keyPtr, valuePtr, aCallbackArgument, false,
+                        m_tcrdm);
+  auto region = std::static_pointer_cast<ThinClientRegion>(shared_from_this());
+  return m_tcrdm->sendAsyncRequest(
+      request, [region, handler](GfErrType err, TcrMessageReply& reply) {
+        VersionTagPtr versionTag;
+        if (err == GF_NOERR) {
+          err = region->processPutReply(reply, versionTag);
+        }
+        handler(err, versionTag);
+      });
+}
+
+GfErrType ThinClientRegion::processPutReply(TcrMessageReply& reply,
+                                            VersionTagPtr& versionTag) {
+  GfErrType err = GF_NOERR;
   // put the object into local region
-  switch (reply->getMessageType()) {
+  switch (reply.getMessageType()) {
     case TcrMessage::REPLY: {
-      versionTag = reply->getVersionTag();
+      versionTag = reply.getVersionTag();
       break;
     }
     case TcrMessage::EXCEPTION: {
-      err = handleServerException("Region::put", reply->getException());
+      err = handleServerException("Region::put", reply.getException());
       break;
     }
     case TcrMessage::PUT_DATA_ERROR: {
@@ -1074,12 +1133,10 @@ GfErrType ThinClientRegion::putNoThrow_remote(
     }
     default: {
       LOGERROR("Unknown message type %d during region put reply",
-               reply->getMessageType());
+               reply.getMessageType());
       err = GF_MSG;
     }
   }
-  delete reply;
-  reply = nullptr;
   return err;
 }
 
@@ -1217,25 +1274,13 @@ GfErrType ThinClientRegion::getAllNoThrow_remote(
     const VectorOfCacheableKey* keys, const HashMapOfCacheablePtr& values,
     const HashMapOfExceptionPtr& exceptions,
     const VectorOfCacheableKeyPtr& resultKeys, bool addToLocalCache,
-    const UserDataPtr& aCallbackArgument) {
+    const UserDataPtr& aCallbackArgument, const GetAllListenerPtr& listener) {
   GfErrType err = GF_NOERR;
   MapOfUpdateCounters updateCountMap;
   int32_t destroyTracker = 0;
   addToLocalCache = addToLocalCache && m_regionAttributes->getCachingEnabled();
-  if (addToLocalCache && !m_regionAttributes->getConcurrencyChecksEnabled()) {
-    // start tracking the entries
-    if (keys == nullptr) {
-      // track all entries with destroy tracking for non-existent entries
-      destroyTracker = m_entries->addTrackerForAllEntries(updateCountMap, true);
-    } else {
-      for (int32_t index = 0; index < keys->size(); ++index) {
-        CacheablePtr oldValue;
-        const CacheableKeyPtr& key = keys->operator[](index);
-        int updateCount =
-            m_entries->addTrackerForEntry(key, oldValue, true, false, false);
-        updateCountMap.insert(std::make_pair(key, updateCount));
-      }
-    }
+  if (addToLocalCache) {
+    destroyTracker = addGetAllTrackers(keys, updateCountMap);
   }
   // create the GET_ALL request
   TcrMessageGetAll request(
@@ -1247,30 +1292,115 @@ GfErrType ThinClientRegion::getAllNoThrow_remote(
   // need to check
   TcrChunkedResult* resultCollector(new ChunkedGetAllResponse(
       reply, this, keys, values, exceptions, resultKeys, updateCountMap,
-      destroyTracker, addToLocalCache, responseLock));
+      destroyTracker, addToLocalCache, responseLock, listener));
 
   reply.setChunkedResultHandler(resultCollector);
   err = m_tcrdm->sendSyncRequest(request, reply);
 
-  if (addToLocalCache && !m_regionAttributes->getConcurrencyChecksEnabled()) {
-    // remove the tracking for remaining keys in case some keys do not have
-    // values from server in GII
-    for (MapOfUpdateCounters::const_iterator iter = updateCountMap.begin();
-         iter != updateCountMap.end(); ++iter) {
-      if (iter->second >= 0) {
-        m_entries->removeTrackerForEntry(iter->first);
-      }
-    }
-    // remove tracking for destroys
-    if (destroyTracker > 0) {
-      m_entries->removeDestroyTracking();
-    }
+  if (addToLocalCache) {
+    removeGetAllTrackers(updateCountMap, destroyTracker);
   }
   delete resultCollector;
   if (err != GF_NOERR) {
     return err;
   }
+  return processGetAllReply(reply);
+}
+
+namespace {
+// What the replies to the requests of an asynchronous getAll are merged
+// with, kept alive until the last of them has been processed.
+class AsyncGetAllState {
+ public:
+  AsyncGetAllState(ThinClientRegion* region, ThinClientBaseDM* dm,
+                   const VectorOfCacheableKeyPtr& keys,
+                   const HashMapOfCacheablePtr& values, bool addToLocalCache)
+      : m_keys(keys),
+        m_reply(true, dm),
+        m_responseHandler(m_reply, region, keys.get(), values, nullptr,
+                          nullptr, m_updateCountMap, 0, addToLocalCache,
+                          m_responseLock) {}
+
+  VectorOfCacheableKeyPtr m_keys;
+  MapOfUpdateCounters m_updateCountMap;
+  ACE_Recursive_Thread_Mutex m_responseLock;
+  TcrMessageReply m_reply;
+  ChunkedGetAllResponse m_responseHandler;
+};
+}  // namespace
+
+GfErrType ThinClientRegion::getAllNoThrow_remoteAsync(
+    const VectorOfCacheableKeyPtr& keys, const HashMapOfCacheablePtr& values,
+    bool addToLocalCache, const UserDataPtr& aCallbackArgument,
+    const RemoteGetAllHandler& handler) {
+  auto poolDM = dynamic_cast<ThinClientPoolDM*>(m_tcrdm);
+  if (poolDM == nullptr) {
+    return GF_NOTSUP;
+  }
+  addToLocalCache = addToLocalCache && m_regionAttributes->getCachingEnabled();
+  auto state = std::make_shared<AsyncGetAllState>(this, m_tcrdm, keys, values,
+                                                  addToLocalCache);
+  if (addToLocalCache) {
+    addGetAllTrackers(keys.get(), state->m_updateCountMap);
+  }
+  // the region must outlive the requests
+  auto region = std::static_pointer_cast<ThinClientRegion>(shared_from_this());
+  GfErrType err = poolDM->sendGetAllAsync(
+      region, keys, aCallbackArgument, state->m_responseHandler,
+      [region](TcrMessage& reply) { return region->processGetAllReply(reply); },
+      [region, state, addToLocalCache, handler](GfErrType err) {
+        if (addToLocalCache) {
+          region->removeGetAllTrackers(state->m_updateCountMap, 0);
+        }
+        handler(err);
+      });
+  if (err != GF_NOERR && addToLocalCache) {
+    removeGetAllTrackers(state->m_updateCountMap, 0);
+  }
+  return err;
+}
 
+int32_t ThinClientRegion::addGetAllTrackers(
+    const VectorOfCacheableKey* keys, MapOfUpdateCounters& updateCountMap) {
+  if (m_regionAttributes->getConcurrencyChecksEnabled()) {
+    return 0;
+  }
+  // start tracking the entries
+  if (keys == nullptr) {
+    // track all entries with destroy tracking for non-existent entries
+    return m_entries->addTrackerForAllEntries(updateCountMap, true);
+  }
+  for (int32_t index = 0; index < keys->size(); ++index) {
+    CacheablePtr oldValue;
+    const CacheableKeyPtr& key = keys->operator[](index);
+    int updateCount =
+        m_entries->addTrackerForEntry(key, oldValue, true, false, false);
+    updateCountMap.insert(std::make_pair(key, updateCount));
+  }
+  return 0;
+}
+
+void ThinClientRegion::removeGetAllTrackers(
+    const MapOfUpdateCounters& updateCountMap, int32_t destroyTracker) {
+  if (m_regionAttributes->getConcurrencyChecksEnabled()) {
+    return;
+  }
+  // remove the tracking for remaining keys in case some keys do not have
+  // values from server in GII
+  for (MapOfUpdateCounters::const_iterator iter = updateCountMap.begin();
+       iter != updateCountMap.end(); ++iter) {
+    if (iter->second >= 0) {
+      m_entries->removeTrackerForEntry(iter->first);
+    }
+  }
+  // remove tracking for destroys
+  if (destroyTracker > 0) {
+    m_entries->removeDestroyTracking();
+  }
+}
+
+GfErrType ThinClientRegion::processGetAllReply(TcrMessage& reply) {
+  GfErrType err = GF_NOERR;
   switch (reply.getMessageType()) {
     case TcrMessage::RESPONSE: {
       // nothing to be done; put in local region, if required,
@@ -2683,11 +2813,13 @@ GfErrType ThinClientRegion::clientNotificationHandler(TcrMessage& msg) {
     case TcrMessage::CLEAR_REGION: {
       LOGDEBUG("remote clear region event for reigon[%s]",
                msg.getRegionName().c_str());
+      flushEventBatch();
       err = localClearNoThrow(
           nullptr, CacheEventFlags::NOTIFICATION | CacheEventFlags::LOCAL);
       break;
     }
     case TcrMessage::LOCAL_DESTROY_REGION: {
+      flushEventBatch();
       m_notifyRelease = true;
       err = LocalRegion::destroyRegionNoThrow(
           msg.getCallbackArgument(), true,
@@ -2716,6 +2848,7 @@ GfErrType ThinClientRegion::clientNotificationHandler(TcrMessage& msg) {
       break;
     default: {
       if (TcrMessage::getAllEPDisMess() == &msg) {
+        flushEventBatch();
         setProcessedMarker(false);
         LocalRegion::invokeAfterAllEndPointDisconnected();
       } else {
@@ -2739,6 +2872,117 @@ GfErrType ThinClientRegion::clientNotificationHandler(TcrMessage& msg) {
   return err;
 }
 
+bool ThinClientRegion::batchEntryEvent(const CacheableKeyPtr& key,
+                                       const CacheablePtr& oldValue,
+                                       const CacheablePtr& newValue,
+                                       const UserDataPtr& aCallbackArgument,
+                                       EntryEventType type) {
+  BatchCacheListenerPtr listener =
+      std::dynamic_pointer_cast<BatchCacheListener>(m_listener);
+  if (listener == nullptr) {
+    return false;
+  }
+  BatchCacheListener::Operation operation;
+  switch (type) {
+    case AFTER_CREATE:
+      operation = BatchCacheListener::CREATE;
+      break;
+    case AFTER_UPDATE:
+      operation = BatchCacheListener::UPDATE;
+      break;
+    case AFTER_INVALIDATE:
+      operation = BatchCacheListener::INVALIDATE;
+      break;
+    case AFTER_DESTROY:
+      operation = BatchCacheListener::DESTROY;
+      break;
+    default:
+      return false;
+  }
+
+  size_t size = m_eventBatch.add(
+      std::make_shared<BatchCacheListener::Event>(operation, shared_from_this(),
+                                                  key, oldValue, newValue,
+                                                  aCallbackArgument, true),
+      s_heldEventId);
+  s_heldEventId = nullptr;
+  {
+    ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_eventBatchLock);
+    if (m_eventBatchTaskId < 0) {
+      ACE_Event_Handler* handler = new ExpiryHandler_T<ThinClientRegion>(
+          this, &ThinClientRegion::flushEventBatchOnTimeout);
+      ACE_Time_Value interval;
+      interval.msec(static_cast<long>(listener->getBatchTimeInterval()));
+      m_eventBatchTaskId = CacheImpl::expiryTaskManager->scheduleExpiryTask(
+          handler, interval, interval);
+    }
+  }
+  if (size >= listener->getMaxBatchSize()) {
+    flushEventBatch();
+  }
+  return true;
+}
+
+bool ThinClientRegion::isBatchingEvents() {
+  return std::dynamic_pointer_cast<BatchCacheListener>(m_listener) != nullptr;
+}
+
+void ThinClientRegion::flushEventBatch() {
+  ACE_Guard<ACE_Recursive_Thread_Mutex> deliveryGuard(m_eventDeliveryLock);
+  // take the batch first so that a listener causing another flush on this
+  // thread cannot deliver it twice
+  std::vector<BatchCacheListener::EventPtr> events;
+  std::vector<EventIdPtr> eventIds;
+  if (!m_eventBatch.take(events, eventIds)) {
+    return;
+  }
+
+  BatchCacheListenerPtr listener =
+      std::dynamic_pointer_cast<BatchCacheListener>(m_listener);
+  if (listener != nullptr) {
+    try {
+      int64_t sampleStartNanos = Utils::startStatOpTime();
+      listener->afterEvents(events);
+      m_cacheImpl->m_cacheStats->incListenerCalls();
+      Utils::updateStatOpTime(
+          m_regionStats->getStat(),
+          RegionStatType::getInstance()->getListenerCallTimeId(),
+          sampleStartNanos);
+      m_regionStats->incListenerCallsCompleted();
+    } catch (const Exception& ex) {
+      LOGERROR("Exception in BatchCacheListener::afterEvents for %d events: "
+               "%s: %s",
+               static_cast<int>(events.size()), ex.getName(),
+               ex.getMessage());
+    } catch (...) {
+      LOGERROR(
+          "Unknown exception in BatchCacheListener::afterEvents for %d "
+          "events",
+          static_cast<int>(events.size()));
+    }
+  }
+  for (const auto& eventId : eventIds) {
+    m_tcrdm->releaseEventAck(eventId);
+  }
+}
+
+void ThinClientRegion::discardEventBatch() {
+  std::vector<BatchCacheListener::EventPtr> events;
+  std::vector<EventIdPtr> eventIds;
+  m_eventBatch.take(events, eventIds);
+  // released like delivered events: the server is not asked to send them
+  // again, as it is not for the events of a listener that throws
+  for (const auto& eventId : eventIds) {
+    m_tcrdm->releaseEventAck(eventId);
+  }
+}
+
+int ThinClientRegion::flushEventBatchOnTimeout(const ACE_Time_Value&,
+                                               const void*) {
+  flushEventBatch();
+  return 0;
+}
+
 GfErrType ThinClientRegion::handleServerException(const char* func,
                                                   const char* exceptionMsg) {
   // LOGERROR("%s: An exception (%s) happened at remote server.", func,
@@ -2792,25 +3036,36 @@ GfErrType ThinClientRegion::handleServerException(const char* func,
   return error;
 }
 
-void ThinClientRegion::receiveNotification(TcrMessage* msg) {
+void ThinClientRegion::receiveNotification(TcrMessage* msg, bool dispatched) {
   {
     TryReadGuard guard(m_rwLock, m_destroyPending);
     if (m_destroyPending) {
       if (msg != TcrMessage::getAllEPDisMess()) {
+        if (msg->isEventAckHeld()) {
+          m_tcrdm->releaseEventAck(msg->getEventId());
+        }
         GF_SAFE_DELETE(msg);
       }
       return;
     }
-    m_notificationSema.acquire();
+    m_notificationLock.acquire(*msg, dispatched);
   }
 
+  if (msg->isEventAckHeld()) {
+    s_heldEventId = msg->getEventId();
+  }
   if (msg->getMessageType() == TcrMessage::CLIENT_MARKER) {
     handleMarker();
   } else {
     clientNotificationHandler(*msg);
   }
+  // not batched, so processed by now
+  if (s_heldEventId != nullptr) {
+    m_tcrdm->releaseEventAck(s_heldEventId);
+    s_heldEventId = nullptr;
+  }
 
-  m_notificationSema.release();
+  m_notificationLock.release();
   if (TcrMessage::getAllEPDisMess() != msg) GF_SAFE_DELETE(msg);
 }
 
@@ -2921,7 +3176,17 @@ void ThinClientRegion::release(bool invokeCallbacks) {
     return;
   }
   if (!m_notifyRelease) {
-    m_notificationSema.acquire();
+    m_notificationLock.acquireExclusive();
+  }
+
+  if (m_eventBatchTaskId >= 0) {
+    CacheImpl::expiryTaskManager->cancelTask(m_eventBatchTaskId);
+    m_eventBatchTaskId = -1;
+  }
+  if (invokeCallbacks) {
+    flushEventBatch();
+  } else {
+    discardEventBatch();
   }
 
   destroyDM(invokeCallbacks);
@@ -3448,6 +3713,25 @@ void ChunkedKeySetResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
 void ChunkedQueryResponse::reset() {
   m_queryResults->clear();
   m_structFieldNames.clear();
+  if (m_columns != nullptr) {
+    m_columns->clear();
+  }
+}
+
+bool ChunkedQueryResponse::keepsValuesSerialized() const {
+  ThinClientBaseDM* dm = m_msg.getDM();
+  return dm != nullptr && dm->keepsValuesSerialized();
+}
+
+void ChunkedQueryResponse::readValue(DataInput& input, bool keepSerialized) {
+  if (m_columns != nullptr) {
+    m_columns->setFieldNames(m_structFieldNames);
+    m_columns->readValue(input, keepSerialized);
+  } else {
+    SerializablePtr value;
+    TcrMessageHelper::readObject(input, value, keepSerialized);
+    m_queryResults->push_back(value);
+  }
 }
 
 void ChunkedQueryResponse::readObjectPartList(DataInput& input,
@@ -3463,6 +3747,7 @@ void ChunkedQueryResponse::readObjectPartList(DataInput& input,
   int32_t len;
   input.readInt(&len);
 
+  bool keepSerialized = keepsValuesSerialized();
   for (int32_t index = 0; index < len; ++index) {
     uint8_t byte = 0;
     input.read(&byte);
@@ -3476,9 +3761,7 @@ void ChunkedQueryResponse::readObjectPartList(DataInput& input,
       throw IllegalStateException(exMsgPtr->asChar());
     } else {
       if (isResultSet) {
-        CacheablePtr value;
-        input.readObject(value);
-        m_queryResults->push_back(value);
+        readValue(input, keepSerialized);
       } else {
         int8_t arrayType;
         input.read(&arrayType);
@@ -3531,7 +3814,12 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     input.read(&isObj);
     CacheableInt32Ptr intVal;
     input.readObject(intVal, true);
-    m_queryResults->push_back(intVal);
+    if (m_columns != nullptr) {
+      m_columns->setFieldNames(m_structFieldNames);
+      m_columns->addValue(intVal);
+    } else {
+      m_queryResults->push_back(intVal);
+    }
 
     // TODO:
     m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
@@ -3605,19 +3893,17 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     int32_t arraySize;
     input.readArrayLen(&arraySize);
     skipClass(input);
+    bool keepSerialized = keepsValuesSerialized();
     for (int32_t arrayItem = 0; arrayItem < arraySize; ++arrayItem) {
-      SerializablePtr value;
       if (isResultSet) {
-        input.readObject(value);
-        m_queryResults->push_back(value);
+        readValue(input, keepSerialized);
       } else {
         input.read(&isObj);
         int32_t arraySize2;
         input.readArrayLen(&arraySize2);
         skipClass(input);
         for (int32_t index = 0; index < arraySize2; ++index) {
-          input.readObject(value);
-          m_queryResults->push_back(value);
+          readValue(input, keepSerialized);
         }
       }
     }
@@ -3822,24 +4108,73 @@ void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     return;
   }
 
+  // the chunk is read into maps of its own so that the replies to the
+  // batches of a single hop getAll are deserialized and put into the local
+  // cache concurrently, and only merged into the results under the lock
+  auto values = std::make_shared<HashMapOfCacheable>();
+  auto exceptions = std::make_shared<HashMapOfException>();
+  VectorOfCacheableKeyPtr resultKeys;
+  if (m_resultKeys != nullptr) {
+    resultKeys = std::make_shared<VectorOfCacheableKey>();
+  }
   VersionedCacheableObjectPartList objectList(
-      m_keys, &m_keysOffset, m_values, m_exceptions, m_resultKeys, m_region,
+      m_keys, &m_keysOffset, values, exceptions, resultKeys, m_region,
       &m_trackerMap, m_destroyTracker, m_addToLocalCache, m_dsmemId,
-      m_responseLock);
+      m_chunkLock);
 
   objectList.fromData(input);
 
   m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
+
+  addChunk(values, exceptions, resultKeys);
+}
+
+void ChunkedGetAllResponse::addChunk(
+    const HashMapOfCacheablePtr& values,
+    const HashMapOfExceptionPtr& exceptions,
+    const VectorOfCacheableKeyPtr& resultKeys) {
+  if (m_values != nullptr || m_exceptions != nullptr ||
+      (m_resultKeys != nullptr && resultKeys != nullptr)) {
+    ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_responseLock);
+    if (m_values != nullptr) {
+      for (const auto& iter : *values) {
+        (*m_values)[iter.first] = iter.second;
+      }
+    }
+    if (m_exceptions != nullptr) {
+      m_exceptions->insert(exceptions->begin(), exceptions->end());
+    }
+    if (m_resultKeys != nullptr && resultKeys != nullptr) {
+      m_resultKeys->insert(m_resultKeys->end(), resultKeys->begin(),
+                           resultKeys->end());
+    }
+  }
+  if (m_listener != nullptr) {
+    try {
+      if (values->size() > 0) {
+        m_listener->onValues(*values);
+      }
+      if (exceptions->size() > 0) {
+        m_listener->onExceptions(*exceptions);
+      }
+    } catch (const Exception& ex) {
+      LOGERROR("Exception in GetAllListener for region %s: %s: %s",
+               m_region->getFullPath(), ex.getName(), ex.getMessage());
+    } catch (...) {
+      LOGERROR("Unknown exception in GetAllListener for region %s",
+               m_region->getFullPath());
+    }
+  }
 }
 
 void ChunkedGetAllResponse::add(const ChunkedGetAllResponse* other) {
-  if (m_values) {
-    for (const auto& iter : *m_values) {
+  if (m_values && other->m_values) {
+    for (const auto& iter : *other->m_values) {
       m_values->emplace(iter.first, iter.second);
     }
   }
 
-  if (m_exceptions) {
+  if (m_exceptions && other->m_exceptions) {
     m_exceptions->insert(other->m_exceptions->begin(),
                          other->m_exceptions->end());
   }
@@ -3848,7 +4183,7 @@ void ChunkedGetAllResponse::add(const ChunkedGetAllResponse* other) {
     m_trackerMap[iter.first] = iter.second;
   }
 
-  if (m_resultKeys) {
+  if (m_resultKeys && other->m_resultKeys) {
     m_resultKeys->insert(m_resultKeys->end(), other->m_resultKeys->begin(),
                          other->m_resultKeys->end());
   }
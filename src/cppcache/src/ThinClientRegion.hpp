@@ -21,10 +21,12 @@
 #define GEODE_THINCLIENTREGION_H_
 
 #include <unordered_map>
+#include <vector>
 
 #include <ace/Task.h>
 
 #include <geode/utils.hpp>
+#include <geode/BatchCacheListener.hpp>
 #include <geode/ResultCollector.hpp>
 
 #include "LocalRegion.hpp"
@@ -35,6 +37,9 @@
 #include "TcrChunkedContext.hpp"
 #include "CacheableObjectPartList.hpp"
 #include "ClientMetadataService.hpp"
+#include "ColumnarStructSetImpl.hpp"
+#include "EventBatch.hpp"
+#include "NotificationLock.hpp"
 
 /**
  * @file
@@ -126,7 +131,10 @@ class CPPCACHE_EXPORT ThinClientRegion : public LocalRegion {
   /** @brief Public Methods from RegionInternal
    *  These are all virtual methods
    */
-  void receiveNotification(TcrMessage* msg);
+  // dispatched is true when a NotificationDispatcher worker applies the event
+  void receiveNotification(TcrMessage* msg, bool dispatched = false);
+  // true if entry events of notifications are batched for the listener
+  bool isBatchingEvents();
 
   /** @brief Misc utility methods. */
   static GfErrType handleServerException(const char* func,
@@ -187,6 +195,13 @@ class CPPCACHE_EXPORT ThinClientRegion : public LocalRegion {
                               const UserDataPtr& aCallbackArgument,
                               VersionTagPtr& versionTag,
                               bool checkDelta = true);
+  GfErrType getNoThrow_remoteAsync(const CacheableKeyPtr& keyPtr,
+                                   const UserDataPtr& aCallbackArgument,
+                                   const RemoteGetHandler& handler);
+  GfErrType putNoThrow_remoteAsync(const CacheableKeyPtr& keyPtr,
+                                   const CacheablePtr& cvalue,
+                                   const UserDataPtr& aCallbackArgument,
+                                   const RemoteUpdateHandler& handler);
   GfErrType createNoThrow_remote(const CacheableKeyPtr& keyPtr,
                                  const CacheablePtr& cvalue,
                                  const UserDataPtr& aCallbackArgument,
@@ -209,7 +224,13 @@ class CPPCACHE_EXPORT ThinClientRegion : public LocalRegion {
                                  const HashMapOfExceptionPtr& exceptions,
                                  const VectorOfCacheableKeyPtr& resultKeys,
                                  bool addToLocalCache,
-                                 const UserDataPtr& aCallbackArgument);
+                                 const UserDataPtr& aCallbackArgument,
+                                 const GetAllListenerPtr& listener = nullptr);
+  GfErrType getAllNoThrow_remoteAsync(const VectorOfCacheableKeyPtr& keys,
+                                      const HashMapOfCacheablePtr& values,
+                                      bool addToLocalCache,
+                                      const UserDataPtr& aCallbackArgument,
+                                      const RemoteGetAllHandler& handler);
   GfErrType destroyRegionNoThrow_remote(const UserDataPtr& aCallbackArgument);
   GfErrType registerKeysNoThrow(
       const VectorOfCacheableKey& keys, bool attemptFailover = true,
@@ -245,6 +266,19 @@ class CPPCACHE_EXPORT ThinClientRegion : public LocalRegion {
 
   GfErrType unregisterKeysBeforeDestroyRegion();
 
+  // decode the replies to get and put requests
+  GfErrType processGetReply(TcrMessageReply& reply, CacheablePtr& valPtr,
+                            VersionTagPtr& versionTag);
+  GfErrType processPutReply(TcrMessageReply& reply, VersionTagPtr& versionTag);
+
+  // the entries of a getAll added to the local cache are tracked while the
+  // requests are in flight, unless concurrency checks are enabled
+  int32_t addGetAllTrackers(const VectorOfCacheableKey* keys,
+                            MapOfUpdateCounters& updateCountMap);
+  void removeGetAllTrackers(const MapOfUpdateCounters& updateCountMap,
+                            int32_t destroyTracker);
+  GfErrType processGetAllReply(TcrMessage& reply);
+
   bool isDurableClient() { return m_isDurableClnt; }
   /** @brief Protected fields. */
   ThinClientBaseDM* m_tcrdm;
@@ -266,7 +300,7 @@ class CPPCACHE_EXPORT ThinClientRegion : public LocalRegion {
       m_durableInterestListRegexForUpdatesAsInvalidates;
 
   bool m_notifyRelease;
-  ACE_Semaphore m_notificationSema;
+  NotificationLock m_notificationLock;
 
   bool m_isDurableClnt;
 
@@ -325,6 +359,29 @@ class CPPCACHE_EXPORT ThinClientRegion : public LocalRegion {
   ACE_RW_Thread_Mutex m_RegionMutex;
   bool m_isMetaDataRefreshed;
 
+  virtual bool batchEntryEvent(const CacheableKeyPtr& key,
+                               const CacheablePtr& oldValue,
+                               const CacheablePtr& newValue,
+                               const UserDataPtr& aCallbackArgument,
+                               EntryEventType type);
+  // delivers the pending batch to the BatchCacheListener and releases the
+  // acks of the notifications of its events
+  void flushEventBatch();
+  // drops the pending batch undelivered and releases the acks of the
+  // notifications of its events
+  void discardEventBatch();
+  int flushEventBatchOnTimeout(const ACE_Time_Value&, const void*);
+
+  // entry events of notifications waiting for delivery to a
+  // BatchCacheListener, and the notifications to release after it
+  EventBatch m_eventBatch;
+  // guards the flush timer of the batch
+  ACE_Recursive_Thread_Mutex m_eventBatchLock;
+  long m_eventBatchTaskId;
+  // held while a batch is delivered, without m_eventBatchLock, so that the
+  // dispatcher and the timer deliver batches one at a time and in order
+  ACE_Recursive_Thread_Mutex m_eventDeliveryLock;
+
   typedef std::unordered_map<BucketServerLocationPtr, SerializablePtr,
                              dereference_hash<BucketServerLocationPtr>,
                              dereference_equal_to<BucketServerLocationPtr>>
@@ -382,18 +439,27 @@ class ChunkedQueryResponse : public TcrChunkedResult {
   TcrMessage& m_msg;
   CacheableVectorPtr m_queryResults;
   std::vector<CacheableStringPtr> m_structFieldNames;
+  ColumnarStructSetImplPtr m_columns;
 
   void skipClass(DataInput& input);
 
+  // reads the next value into the columns, if any, or the query results
+  void readValue(DataInput& input, bool keepSerialized);
+
+  // whether PDX results are kept serialized in a CachedDeserializable
+  bool keepsValuesSerialized() const;
+
   // disabled
   ChunkedQueryResponse(const ChunkedQueryResponse&);
   ChunkedQueryResponse& operator=(const ChunkedQueryResponse&);
 
  public:
-  inline ChunkedQueryResponse(TcrMessage& msg)
+  inline ChunkedQueryResponse(TcrMessage& msg,
+                              const ColumnarStructSetImplPtr& columns = nullptr)
       : TcrChunkedResult(),
         m_msg(msg),
-        m_queryResults(CacheableVector::create()) {}
+        m_queryResults(CacheableVector::create()),
+        m_columns(columns) {}
 
   inline const CacheableVectorPtr& getQueryResults() const {
     return m_queryResults;
@@ -478,7 +544,12 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   int32_t m_destroyTracker;
   bool m_addToLocalCache;
   uint32_t m_keysOffset;
+  // shared by the replies of a single hop getAll, only held to merge a
+  // chunk into the results
   ACE_Recursive_Thread_Mutex& m_responseLock;
+  // held while a chunk of this reply is read
+  ACE_Recursive_Thread_Mutex m_chunkLock;
+  GetAllListenerPtr m_listener;
   // disabled
   ChunkedGetAllResponse(const ChunkedGetAllResponse&);
   ChunkedGetAllResponse& operator=(const ChunkedGetAllResponse&);
@@ -491,7 +562,8 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
                                const VectorOfCacheableKeyPtr& resultKeys,
                                MapOfUpdateCounters& trackerMap,
                                int32_t destroyTracker, bool addToLocalCache,
-                               ACE_Recursive_Thread_Mutex& responseLock)
+                               ACE_Recursive_Thread_Mutex& responseLock,
+                               const GetAllListenerPtr& listener = nullptr)
       : TcrChunkedResult(),
         m_msg(msg),
         m_region(region),
@@ -503,12 +575,21 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
         m_destroyTracker(destroyTracker),
         m_addToLocalCache(addToLocalCache),
         m_keysOffset(0),
-        m_responseLock(responseLock) {}
+        m_responseLock(responseLock),
+        m_chunkLock(),
+        m_listener(listener) {}
 
   virtual void handleChunk(const uint8_t* chunk, int32_t chunkLen,
                            uint8_t isLastChunkWithSecurity);
   virtual void reset();
 
+  /**
+   * Merges the values, exceptions and keys read from one chunk into the
+   * results under the response lock, then hands them to the listener.
+   */
+  void addChunk(const HashMapOfCacheablePtr& values,
+                const HashMapOfExceptionPtr& exceptions,
+                const VectorOfCacheableKeyPtr& resultKeys);
   void add(const ChunkedGetAllResponse* other);
   bool getAddToLocalCache() { return m_addToLocalCache; }
   HashMapOfCacheablePtr getValues() { return m_values; }
@@ -516,6 +597,7 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   VectorOfCacheableKeyPtr getResultKeys() { return m_resultKeys; }
   MapOfUpdateCounters& getUpdateCounters() { return m_trackerMap; }
   ACE_Recursive_Thread_Mutex& getResponseLock() { return m_responseLock; }
+  const GetAllListenerPtr& getListener() { return m_listener; }
 };
 
 typedef std::shared_ptr<ChunkedGetAllResponse> ChunkedGetAllResponsePtr;
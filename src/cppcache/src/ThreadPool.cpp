@@ -22,122 +22,236 @@
  */
 
 #include "ThreadPool.hpp"
+#include <iterator>
 #include <geode/DistributedSystem.hpp>
 #include <geode/SystemProperties.hpp>
 #include "DistributedSystemImpl.hpp"
+#include "TSSTXStateWrapper.hpp"
+#include "UserAttributes.hpp"
 using namespace apache::geode::client;
 
-ThreadPoolWorker::ThreadPoolWorker(IThreadPool* manager)
-    : manager_(manager), threadId_(0), queue_(msg_queue()), shutdown_(0) {}
+std::atomic<int64_t> ThreadPool::s_tasks(0);
+std::atomic<int64_t> ThreadPool::s_tasksQueued(0);
+std::atomic<int64_t> ThreadPool::s_tasksStolen(0);
+std::atomic<int64_t> ThreadPool::s_tasksRunInCaller(0);
+std::atomic<int64_t> ThreadPool::s_queueTime(0);
 
-ThreadPoolWorker::~ThreadPoolWorker() { shutDown(); }
+ThreadPool::ThreadPool()
+    : shutdown_(false), nextWorker_(0), startedWorkers_(0) {
+  SystemProperties* sysProp = DistributedSystem::getSystemProperties();
+  poolSize_ = sysProp->threadPoolSize();
+  if (poolSize_ < 1) {
+    poolSize_ = 1;
+  }
+  for (int i = 0; i < poolSize_; i++) {
+    workers_.push_back(new Worker());
+  }
+  activate(THR_NEW_LWP | THR_JOINABLE, poolSize_);
+}
 
-int ThreadPoolWorker::perform(ACE_Method_Request* req) {
-  ACE_TRACE(ACE_TEXT("Worker::perform"));
-  return this->queue_.enqueue(req);
+ThreadPool::~ThreadPool() {
+  shutDown();
+  for (auto worker : workers_) {
+    delete worker;
+  }
 }
 
-int ThreadPoolWorker::svc(void) {
-  threadId_ = ACE_Thread::self();
-  while (1) {
-    ACE_Method_Request* request = this->queue_.dequeue();
-    if (request == 0) {
-      shutDown();
+int ThreadPool::perform(ACE_Method_Request* req) {
+  if (shutdown_) {
+    req->call();
+    return 0;
+  }
+  ++s_tasks;
+  QueuedRequest item;
+  item.m_request = req;
+  item.m_queuedAt = std::chrono::steady_clock::now();
+
+  // prefer a worker that is asleep, else go round-robin and leave it to the
+  // workers that finish first to steal
+  uint32_t start = nextWorker_++;
+  Worker* target = workers_[start % poolSize_];
+  for (int i = 0; i < poolSize_; i++) {
+    Worker* worker = workers_[(start + i) % poolSize_];
+    if (worker->m_idle) {
+      target = worker;
       break;
     }
+  }
 
-    // Invoke the request
-    request->call();
-
-    // Return to work.
-    this->manager_->returnToWork(this);
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(target->m_lock);
+    target->m_queue.push_back(item);
+    ++target->m_size;
+    ++s_tasksQueued;
+    if (target->m_idle) {
+      target->m_cond.signal();
+      return 0;
+    }
+  }
+  // the target is busy, so wake a worker that is asleep to steal the
+  // request; one that is going to sleep sees it in take()
+  for (auto worker : workers_) {
+    if (worker != target && worker->m_idle) {
+      ACE_Guard<ACE_Thread_Mutex> guard(worker->m_lock);
+      if (worker->m_idle) {
+        worker->m_cond.signal();
+        break;
+      }
+    }
   }
   return 0;
 }
 
-int ThreadPoolWorker::shutDown(void) {
-  if (shutdown_ != 1) {
-    queue_.queue()->close();
-    wait();
-    shutdown_ = 1;
+bool ThreadPool::runInCaller(ACE_Method_Request* req) {
+  QueuedRequest item;
+  bool found = false;
+  for (auto worker : workers_) {
+    if (worker->m_size == 0) {
+      continue;
+    }
+    ACE_Guard<ACE_Thread_Mutex> guard(worker->m_lock);
+    // searched from the back since the caller usually waits for the
+    // requests it has just queued
+    for (auto iter = worker->m_queue.rbegin(); iter != worker->m_queue.rend();
+         ++iter) {
+      if (iter->m_request == req) {
+        item = *iter;
+        worker->m_queue.erase(std::next(iter).base());
+        --worker->m_size;
+        found = true;
+        break;
+      }
+    }
+    if (found) {
+      break;
+    }
+  }
+  if (!found) {
+    return false;
   }
+  ++s_tasksRunInCaller;
 
-  return shutdown_;
+  // the request expects the clean thread state of a worker and must not
+  // change the caller's
+  UserAttributesPtr userAttr =
+      TSSUserAttributesWrapper::s_geodeTSSUserAttributes->getUserAttributes();
+  TXState* txState = TSSTXStateWrapper::s_geodeTSSTXState->getTXState();
+  TSSTXStateWrapper::s_geodeTSSTXState->setTXState(nullptr);
+  run(item);
+  TSSTXStateWrapper::s_geodeTSSTXState->setTXState(txState);
+  TSSUserAttributesWrapper::s_geodeTSSUserAttributes->setUserAttributes(
+      userAttr);
+  return true;
 }
 
-ACE_thread_t ThreadPoolWorker::threadId(void) { return threadId_; }
-
-ThreadPool::ThreadPool()
-    : shutdown_(0), workersLock_(), workersCond_(workersLock_) {
-  SystemProperties* sysProp = DistributedSystem::getSystemProperties();
-  poolSize_ = sysProp->threadPoolSize();
-  activate();
+const char* ThreadPool::NC_Pool_Thread = "NC Pool Thread";
+int ThreadPool::svc(void) {
+  DistributedSystemImpl::setThreadName(NC_Pool_Thread);
+  int index = startedWorkers_++;
+  QueuedRequest item;
+  while (take(index, item)) {
+    run(item);
+  }
+  return 0;
 }
 
-ThreadPool::~ThreadPool() { shutDown(); }
+bool ThreadPool::take(int index, QueuedRequest& item) {
+  Worker& own = *workers_[index];
+  while (true) {
+    if (popFront(own, item)) {
+      return true;
+    }
+    for (int i = 1; i < poolSize_; i++) {
+      if (popBack(*workers_[(index + i) % poolSize_], item)) {
+        ++s_tasksStolen;
+        return true;
+      }
+    }
 
-int ThreadPool::perform(ACE_Method_Request* req) {
-  return this->queue_.enqueue(req);
+    ACE_Guard<ACE_Thread_Mutex> guard(own.m_lock);
+    if (shutdown_) {
+      return false;
+    }
+    // announced before looking at the deques once more: perform() either
+    // queued a request that is seen here, or sees the flag and wakes us
+    own.m_idle = true;
+    if (own.m_queue.empty() && !hasQueuedRequests()) {
+      own.m_cond.wait();
+    }
+    own.m_idle = false;
+  }
 }
 
-const char* ThreadPool::NC_Pool_Thread = "NC Pool Thread";
-int ThreadPool::svc(void) {
-  DistributedSystemImpl::setThreadName(NC_Pool_Thread);
-  // Create pool when you get in the first time.
-  createWorkerPool();
-  while (!done()) {
-    // Get the next message
-    ACE_Method_Request* request = this->queue_.dequeue();
-    if (request == 0) {
-      shutDown();
-      break;
+bool ThreadPool::hasQueuedRequests() {
+  for (auto worker : workers_) {
+    if (worker->m_size > 0) {
+      return true;
     }
-    // Choose a worker.
-    ThreadPoolWorker* worker = chooseWorker();
-    // Ask the worker to do the job.
-    worker->perform(request);
   }
-  return 0;
+  return false;
 }
 
-int ThreadPool::shutDown(void) {
-  if (shutdown_ != 1) {
-    queue_.queue()->close();
-    wait();
-    shutdown_ = 1;
+bool ThreadPool::popFront(Worker& worker, QueuedRequest& item) {
+  if (worker.m_size == 0) {
+    return false;
   }
-
-  return shutdown_;
+  ACE_Guard<ACE_Thread_Mutex> guard(worker.m_lock);
+  if (worker.m_queue.empty()) {
+    return false;
+  }
+  item = worker.m_queue.front();
+  worker.m_queue.pop_front();
+  --worker.m_size;
+  return true;
 }
 
-int ThreadPool::returnToWork(ThreadPoolWorker* worker) {
-  ACE_GUARD_RETURN(ACE_Thread_Mutex, workerMon, this->workersLock_, -1);
-  this->workers_.enqueue_tail(worker);
-  this->workersCond_.signal();
-  return 0;
+bool ThreadPool::popBack(Worker& worker, QueuedRequest& item) {
+  if (worker.m_size == 0) {
+    return false;
+  }
+  ACE_Guard<ACE_Thread_Mutex> guard(worker.m_lock);
+  if (worker.m_queue.empty()) {
+    return false;
+  }
+  item = worker.m_queue.back();
+  worker.m_queue.pop_back();
+  --worker.m_size;
+  return true;
 }
 
-ThreadPoolWorker* ThreadPool::chooseWorker(void) {
-  ACE_GUARD_RETURN(ACE_Thread_Mutex, workerMon, this->workersLock_, 0);
-  while (this->workers_.is_empty()) workersCond_.wait();
-  ThreadPoolWorker* worker;
-  this->workers_.dequeue_head(worker);
-  return worker;
+void ThreadPool::run(const QueuedRequest& item) {
+  --s_tasksQueued;
+  s_queueTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - item.m_queuedAt)
+                     .count();
+  item.m_request->call();
 }
 
-int ThreadPool::createWorkerPool(void) {
-  ACE_GUARD_RETURN(ACE_Thread_Mutex, worker_mon, this->workersLock_, -1);
-  for (int i = 0; i < poolSize_; i++) {
-    ThreadPoolWorker* worker;
-    ACE_NEW_RETURN(worker, ThreadPoolWorker(this), -1);
-    this->workers_.enqueue_tail(worker);
-    worker->activate();
+int ThreadPool::shutDown(void) {
+  if (!shutdown_) {
+    shutdown_ = true;
+    for (auto worker : workers_) {
+      ACE_Guard<ACE_Thread_Mutex> guard(worker->m_lock);
+      worker->m_cond.signal();
+    }
+    wait();
+    // run what the workers left behind so that no caller waits forever
+    for (auto worker : workers_) {
+      QueuedRequest item;
+      while (popFront(*worker, item)) {
+        run(item);
+      }
+    }
   }
-  return 0;
+  return 1;
 }
 
-int ThreadPool::done(void) { return (shutdown_ == 1); }
+int64_t ThreadPool::getTasks() { return s_tasks; }
 
-ACE_thread_t ThreadPool::threadId(ThreadPoolWorker* worker) {
-  return worker->threadId();
-}
+int64_t ThreadPool::getTasksQueued() { return s_tasksQueued; }
+
+int64_t ThreadPool::getTasksStolen() { return s_tasksStolen; }
+
+int64_t ThreadPool::getTasksRunInCaller() { return s_tasksRunInCaller; }
+
+int64_t ThreadPool::getQueueTime() { return s_queueTime; }
@@ -28,21 +28,110 @@
 
 #include <ace/Task.h>
 #include <ace/Method_Request.h>
-//#include <ace/Future.h>
-#include <ace/Activation_Queue.h>
 #include <ace/Condition_T.h>
 #include <ace/Singleton.h>
 #include <ace/Recursive_Thread_Mutex.h>
+#include <ace/Thread_Mutex.h>
 #include <ace/Guard_T.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <vector>
 
 namespace apache {
 namespace geode {
 namespace client {
 
+/**
+ * Executor for the parallel sub-tasks of single-hop operations.
+ *
+ * Every worker thread has its own deque of requests. perform() hands a
+ * request to an idle worker if there is one and otherwise spreads the
+ * requests round-robin over the deques, waking a sleeping worker if the one
+ * it picked is busy; a worker that runs out of requests steals from the
+ * other deques before going to sleep. A thread waiting for
+ * the result of a request that no worker has started yet takes it back and
+ * runs it itself (see PooledWork::getResult), so a burst of bulk operations
+ * does not leave the callers sleeping while their requests sit in queues.
+ * The number of workers is max-fe-threads.
+ */
+class ThreadPool : public ACE_Task_Base {
+  friend class ACE_Singleton<ThreadPool, ACE_Recursive_Thread_Mutex>;
+
+ public:
+  /**
+   * Queues the request for a worker. The request is run on the calling
+   * thread if the pool has been shut down.
+   */
+  int perform(ACE_Method_Request* req);
+
+  /**
+   * Runs the request on the calling thread if it is still queued.
+   * @return false if a worker has already taken the request.
+   */
+  bool runInCaller(ACE_Method_Request* req);
+
+  int svc(void);
+  int shutDown(void);
+
+  /** Total number of requests performed. */
+  static int64_t getTasks();
+  /** Number of requests waiting in the deques. */
+  static int64_t getTasksQueued();
+  /** Total number of requests a worker took from another worker's deque. */
+  static int64_t getTasksStolen();
+  /** Total number of requests run by the thread waiting for them. */
+  static int64_t getTasksRunInCaller();
+  /** Total nanoseconds requests spent queued before they were started. */
+  static int64_t getQueueTime();
+
+ private:
+  struct QueuedRequest {
+    ACE_Method_Request* m_request;
+    std::chrono::steady_clock::time_point m_queuedAt;
+  };
+
+  struct Worker {
+    Worker() : m_cond(m_lock), m_size(0), m_idle(false) {}
+    ACE_Thread_Mutex m_lock;
+    ACE_Condition<ACE_Thread_Mutex> m_cond;
+    std::deque<QueuedRequest> m_queue;
+    // read without the lock to skip empty deques and find idle workers;
+    // m_idle is only set under the lock, by the worker about to sleep
+    std::atomic<size_t> m_size;
+    std::atomic<bool> m_idle;
+  };
+
+  ThreadPool();
+  virtual ~ThreadPool();
+
+  // takes the next request for the worker, sleeping until there is one;
+  // returns false on shutdown
+  bool take(int index, QueuedRequest& item);
+  bool popFront(Worker& worker, QueuedRequest& item);
+  bool popBack(Worker& worker, QueuedRequest& item);
+  bool hasQueuedRequests();
+  void run(const QueuedRequest& item);
+
+  int poolSize_;
+  volatile bool shutdown_;
+  std::vector<Worker*> workers_;
+  std::atomic<uint32_t> nextWorker_;
+  std::atomic<int> startedWorkers_;
+  static const char* NC_Pool_Thread;
+
+  static std::atomic<int64_t> s_tasks;
+  static std::atomic<int64_t> s_tasksQueued;
+  static std::atomic<int64_t> s_tasksStolen;
+  static std::atomic<int64_t> s_tasksRunInCaller;
+  static std::atomic<int64_t> s_queueTime;
+};
+
+typedef ACE_Singleton<ThreadPool, ACE_Recursive_Thread_Mutex> TPSingleton;
+
 template <class T>
 class PooledWork : public ACE_Method_Request {
  private:
-  // ACE_Future<T> result_;
   T m_retVal;
   ACE_Recursive_Thread_Mutex m_mutex;
   ACE_Condition<ACE_Recursive_Thread_Mutex> m_cond;
@@ -61,24 +150,21 @@ class PooledWork : public ACE_Method_Request {
     m_retVal = res;
     m_done = true;
     m_cond.broadcast();
-    // result_.set(res);
     return 0;
   }
 
-  /*
-  void attach(ACE_Future_Observer<T> *cb) {
-    result_.attach(cb);
-  }
-  */
-
+  /**
+   * Waits for the result. If no worker has started the work yet it is run
+   * on this thread instead.
+   */
   T getResult(void) {
+    TPSingleton::instance()->runInCaller(this);
+
     ACE_Guard<ACE_Recursive_Thread_Mutex> sync(m_mutex);
 
     while (!m_done) {
       m_cond.wait();
     }
-    // T res;
-    // result_.get(res);
     return m_retVal;
   }
 
@@ -101,61 +187,6 @@ class PooledWorkFP : public PooledWork<R> {
   S* op_handler_;
   OPERATION m_op;
 };
-
-class ThreadPoolWorker;
-
-class IThreadPool {
- public:
-  virtual int returnToWork(ThreadPoolWorker* worker) = 0;
-  virtual ~IThreadPool() {}
-};
-
-class ThreadPoolWorker : public ACE_Task<ACE_MT_SYNCH> {
- public:
-  ThreadPoolWorker(IThreadPool* manager);
-  virtual ~ThreadPoolWorker();
-  int perform(ACE_Method_Request* req);
-  int shutDown(void);
-
-  virtual int svc(void);
-  ACE_thread_t threadId(void);
-
- private:
-  IThreadPool* manager_;
-  ACE_thread_t threadId_;
-  ACE_Activation_Queue queue_;
-  int shutdown_;
-};
-
-class ThreadPool : public ACE_Task_Base, IThreadPool {
-  friend class ACE_Singleton<ThreadPool, ACE_Recursive_Thread_Mutex>;
-
- public:
-  int perform(ACE_Method_Request* req);
-  int svc(void);
-  int shutDown(void);
-  virtual int returnToWork(ThreadPoolWorker* worker);
-
- private:
-  ThreadPool();
-  virtual ~ThreadPool();
-
-  ThreadPoolWorker* chooseWorker(void);
-  int createWorkerPool(void);
-  int done(void);
-  ACE_thread_t threadId(ThreadPoolWorker* worker);
-
- private:
-  int poolSize_;
-  int shutdown_;
-  ACE_Thread_Mutex workersLock_;
-  ACE_Condition<ACE_Thread_Mutex> workersCond_;
-  ACE_Unbounded_Queue<ThreadPoolWorker*> workers_;
-  ACE_Activation_Queue queue_;
-  static const char* NC_Pool_Thread;
-};
-
-typedef ACE_Singleton<ThreadPool, ACE_Recursive_Thread_Mutex> TPSingleton;
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -0,0 +1,280 @@
+#pragma once
+
+#ifndef GEODE_TIMERWHEEL_H_
+#define GEODE_TIMERWHEEL_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @file TimerWheel.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class TimerWheel TimerWheel.hpp
+ *
+ * A hashed hierarchical timing wheel. Timers are kept in doubly linked
+ * lists hanging off the slots of four wheels: the first has one slot per
+ * tick and each of the others covers the whole span of the wheel below it
+ * with every slot. Timers in the higher wheels are moved down (cascaded)
+ * when their slot comes up, so scheduling, cancelling and rescheduling a
+ * timer are constant time and expiring a tick only touches the timers due
+ * in it.
+ *
+ * The timers live in a slab indexed by the id returned from add(); freed
+ * ids are reused. Time is counted in ticks, whose length is up to the
+ * caller. The wheel is not synchronized.
+ */
+template <typename T>
+class TimerWheel {
+ public:
+  /** Slots in the wheel with one tick per slot. */
+  static const uint32_t FIRST_WHEEL_SIZE = 1 << 8;
+  /** Slots in each of the higher wheels. */
+  static const uint32_t WHEEL_SIZE = 1 << 6;
+  /** Number of wheels. */
+  static const uint32_t WHEELS = 4;
+
+  TimerWheel()
+      : m_slots(FIRST_WHEEL_SIZE + (WHEELS - 1) * WHEEL_SIZE, -1),
+        m_currentTick(0),
+        m_freeList(-1),
+        m_size(0) {}
+
+  /**
+   * Allocates a timer holding the payload and returns its id. The timer is
+   * not scheduled.
+   */
+  int32_t add(const T& payload) {
+    int32_t index;
+    if (m_freeList >= 0) {
+      index = m_freeList;
+      m_freeList = m_nodes[index].m_next;
+    } else {
+      index = static_cast<int32_t>(m_nodes.size());
+      m_nodes.push_back(Node());
+    }
+    Node& node = m_nodes[index];
+    node.m_payload = payload;
+    node.m_used = true;
+    node.m_slot = -1;
+    node.m_prev = node.m_next = -1;
+    ++m_size;
+    return index;
+  }
+
+  /**
+   * Schedules the timer to expire at the given tick, moving it if it is
+   * already scheduled. A tick that has already passed expires at the next
+   * one.
+   */
+  void schedule(int32_t index, uint64_t expiryTick) {
+    unlink(index);
+    if (expiryTick <= m_currentTick) {
+      expiryTick = m_currentTick + 1;
+    }
+    m_nodes[index].m_expiryTick = expiryTick;
+    link(index);
+  }
+
+  /** Takes the timer out of the wheel without freeing it. */
+  void unschedule(int32_t index) { unlink(index); }
+
+  /** Frees the timer and hands back its payload. */
+  T remove(int32_t index) {
+    unlink(index);
+    Node& node = m_nodes[index];
+    T payload = std::move(node.m_payload);
+    node.m_payload = T();
+    node.m_used = false;
+    node.m_next = m_freeList;
+    m_freeList = index;
+    --m_size;
+    return payload;
+  }
+
+  /** Frees every timer, scheduled or not, appending their payloads. */
+  void clear(std::vector<T>& payloads) {
+    for (auto& node : m_nodes) {
+      if (node.m_used) {
+        payloads.push_back(std::move(node.m_payload));
+      }
+    }
+    m_nodes.clear();
+    std::fill(m_slots.begin(), m_slots.end(), -1);
+    m_freeList = -1;
+    m_size = 0;
+  }
+
+  T& payload(int32_t index) { return m_nodes[index].m_payload; }
+
+  bool contains(int32_t index) const {
+    return index >= 0 && static_cast<size_t>(index) < m_nodes.size() &&
+           m_nodes[index].m_used;
+  }
+
+  bool isScheduled(int32_t index) const { return m_nodes[index].m_slot >= 0; }
+
+  uint64_t getCurrentTick() const { return m_currentTick; }
+
+  /** Number of allocated timers, scheduled or not. */
+  size_t size() const { return m_size; }
+
+  /**
+   * Moves the wheel forward to the given tick and appends the ids of the
+   * timers that expired on the way. Expired timers are unscheduled but stay
+   * allocated until the caller reschedules or removes them.
+   */
+  void advance(uint64_t tick, std::vector<int32_t>& due) {
+    if (m_size == 0 && tick > m_currentTick) {
+      m_currentTick = tick;
+      return;
+    }
+    while (m_currentTick < tick) {
+      ++m_currentTick;
+      uint32_t slot = m_currentTick & (FIRST_WHEEL_SIZE - 1);
+      if (slot == 0) {
+        cascade();
+      }
+      int32_t index = m_slots[slot];
+      m_slots[slot] = -1;
+      while (index >= 0) {
+        Node& node = m_nodes[index];
+        int32_t next = node.m_next;
+        node.m_slot = -1;
+        node.m_prev = node.m_next = -1;
+        if (node.m_expiryTick <= m_currentTick) {
+          due.push_back(index);
+        } else {
+          link(index);
+        }
+        index = next;
+      }
+    }
+  }
+
+ private:
+  struct Node {
+    Node()
+        : m_expiryTick(0), m_prev(-1), m_next(-1), m_slot(-1), m_used(false) {}
+    T m_payload;
+    uint64_t m_expiryTick;
+    int32_t m_prev;
+    // also links the free list
+    int32_t m_next;
+    int32_t m_slot;
+    bool m_used;
+  };
+
+  // bits of the tick below the slot index of the given higher wheel
+  static uint32_t shiftOf(uint32_t wheel) { return 8 + 6 * (wheel - 1); }
+
+  int32_t slotOf(uint64_t expiryTick) const {
+    if (expiryTick <= m_currentTick) {
+      // only while cascading, the current slot is processed next
+      return static_cast<int32_t>(m_currentTick & (FIRST_WHEEL_SIZE - 1));
+    }
+    uint64_t delta = expiryTick - m_currentTick;
+    if (delta < FIRST_WHEEL_SIZE) {
+      return static_cast<int32_t>(expiryTick & (FIRST_WHEEL_SIZE - 1));
+    }
+    uint32_t wheel = 1;
+    uint32_t shift = shiftOf(wheel);
+    while (delta >= (static_cast<uint64_t>(1) << (shift + 6))) {
+      if (wheel == WHEELS - 1) {
+        // beyond the span of the wheels; parked in the farthest slot and
+        // placed again when that slot cascades
+        expiryTick =
+            m_currentTick + (static_cast<uint64_t>(1) << (shift + 6)) - 1;
+        break;
+      }
+      shift = shiftOf(++wheel);
+    }
+    return static_cast<int32_t>(FIRST_WHEEL_SIZE + (wheel - 1) * WHEEL_SIZE +
+                                ((expiryTick >> shift) & (WHEEL_SIZE - 1)));
+  }
+
+  void link(int32_t index) {
+    Node& node = m_nodes[index];
+    int32_t slot = slotOf(node.m_expiryTick);
+    node.m_slot = slot;
+    node.m_prev = -1;
+    node.m_next = m_slots[slot];
+    if (node.m_next >= 0) {
+      m_nodes[node.m_next].m_prev = index;
+    }
+    m_slots[slot] = index;
+  }
+
+  void unlink(int32_t index) {
+    Node& node = m_nodes[index];
+    if (node.m_slot < 0) {
+      return;
+    }
+    if (node.m_prev >= 0) {
+      m_nodes[node.m_prev].m_next = node.m_next;
+    } else {
+      m_slots[node.m_slot] = node.m_next;
+    }
+    if (node.m_next >= 0) {
+      m_nodes[node.m_next].m_prev = node.m_prev;
+    }
+    node.m_slot = -1;
+    node.m_prev = node.m_next = -1;
+  }
+
+  // Moves the timers of the slots that come up at the current tick down to
+  // the lower wheels.
+  void cascade() {
+    for (uint32_t wheel = 1; wheel < WHEELS; ++wheel) {
+      uint32_t index = (m_currentTick >> shiftOf(wheel)) & (WHEEL_SIZE - 1);
+      int32_t slot = FIRST_WHEEL_SIZE + (wheel - 1) * WHEEL_SIZE + index;
+      int32_t node = m_slots[slot];
+      m_slots[slot] = -1;
+      while (node >= 0) {
+        int32_t next = m_nodes[node].m_next;
+        m_nodes[node].m_slot = -1;
+        link(node);
+        node = next;
+      }
+      if (index != 0) {
+        break;
+      }
+    }
+  }
+
+  std::vector<Node> m_nodes;
+  std::vector<int32_t> m_slots;
+  uint64_t m_currentTick;
+  int32_t m_freeList;
+  size_t m_size;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_TIMERWHEEL_H_
@@ -69,8 +69,8 @@ int TombstoneExpiryHandler::handle_timeout(const ACE_Time_Value& current_time,
   }
   LOGDEBUG("Removing expiry task for key [%s]",
            Utils::getCacheableKeyString(key)->asChar());
-  // we now delete the handler in GF_Timer_Heap_ImmediateReset_T
-  // and always return success.
+  // the ExpiryTaskManager deletes the handler once the task is done
+  // so always return success.
   CacheImpl::expiryTaskManager->resetTask(static_cast<long>(expiryTaskId), 0);
   return 0;
 }
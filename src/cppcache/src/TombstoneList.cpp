@@ -47,7 +47,7 @@ long TombstoneList::getExpiryTask(TombstoneExpiryHandler** handler) {
   *handler = new TombstoneExpiryHandler(tombstoneEntryPtr, this, duration);
   tombstoneEntryPtr->setHandler(*handler);
   long id =
-      CacheImpl::expiryTaskManager->scheduleExpiryTask(*handler, duration, 0);
+      CacheImpl::expiryTaskManager->scheduleWheelExpiryTask(*handler, duration);
   return id;
 }
 
@@ -142,9 +142,10 @@ void TombstoneList::eraseEntryFromTombstoneList(const CacheableKeyPtr& key,
   // This function is not guarded as all functions of this class are called from
   // MapSegment
   if (exists(key)) {
-    if (cancelTask) {
-      CacheImpl::expiryTaskManager->cancelTask(
-          static_cast<long>(m_tombstoneMap[key]->getExpiryTaskId()));
+    // a task the ExpiryTaskManager no longer has took its handler with it
+    if (cancelTask &&
+        CacheImpl::expiryTaskManager->cancelTask(static_cast<long>(
+            m_tombstoneMap[key]->getExpiryTaskId())) == 0) {
       delete m_tombstoneMap[key]->getHandler();
     }
 
@@ -175,8 +176,14 @@ long TombstoneList::eraseEntryFromTombstoneListWithoutCancelTask(
 void TombstoneList::cleanUp() {
   // This function is not guarded as all functions of this class are called from
   // MapSegment
+  // the handlers left on the wheel were freed when it stopped
+  if (CacheImpl::expiryTaskManager == nullptr) {
+    return;
+  }
   for (const auto& queIter : m_tombstoneMap) {
-    CacheImpl::expiryTaskManager->cancelTask(queIter.second->getExpiryTaskId());
-    delete queIter.second->getHandler();
+    if (CacheImpl::expiryTaskManager->cancelTask(
+            queIter.second->getExpiryTaskId()) == 0) {
+      delete queIter.second->getHandler();
+    }
   }
 }
@@ -0,0 +1,277 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ValueArena.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using util::concurrent::spinlock_mutex;
+
+namespace {
+// block sizes, about one and a half times apart
+const uint32_t SizeClasses[] = {16,  24,  32,  48,  64,  96,  128,
+                                192, 256, 384, 512, 768, 1024};
+const uint32_t NumSizeClasses = sizeof(SizeClasses) / sizeof(SizeClasses[0]);
+}  // namespace
+
+const uint32_t ValueArena::MAX_VALUE_SIZE;
+const uint32_t ValueArena::SLAB_SIZE;
+const uint32_t ValueArena::NO_HANDLE;
+const uint16_t ValueArena::MAX_ARENAS;
+const uint16_t ValueArena::NO_ID;
+
+std::atomic<ValueArena*> ValueArena::s_arenas[ValueArena::MAX_ARENAS];
+
+ValueArena::ValueArena(const char* poolName)
+    : m_poolName(poolName == nullptr ? "" : poolName),
+      m_id(NO_ID),
+      m_retired(false),
+      m_pinned(0),
+      m_available(NumSizeClasses),
+      m_slabCount(NumSizeClasses, 0),
+      m_freeCount(NumSizeClasses, 0),
+      m_bytesStored(0) {
+  for (uint16_t id = 0; id < MAX_ARENAS; ++id) {
+    ValueArena* expected = nullptr;
+    if (s_arenas[id].compare_exchange_strong(expected, this)) {
+      m_id = id;
+      break;
+    }
+  }
+}
+
+ValueArena::~ValueArena() {
+  if (m_id != NO_ID) {
+    s_arenas[m_id].store(nullptr, std::memory_order_release);
+  }
+}
+
+std::shared_ptr<ValueArena> ValueArena::create(const char* poolName) {
+  return std::shared_ptr<ValueArena>(new ValueArena(poolName),
+                                     &ValueArena::retire);
+}
+
+void ValueArena::retire(ValueArena* arena) {
+  bool empty;
+  {
+    std::lock_guard<spinlock_mutex> guard(arena->m_lock);
+    arena->m_retired = true;
+    empty = arena->m_locations.size() == arena->m_freeHandles.size();
+  }
+  if (empty) {
+    delete arena;
+  }
+}
+
+uint32_t ValueArena::store(const uint8_t* bytes, uint32_t length) {
+  if (length > MAX_VALUE_SIZE || m_id == NO_ID) {
+    return NO_HANDLE;
+  }
+  uint32_t sizeClass = sizeClassOf(length);
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  Location location = allocate(sizeClass, NO_HANDLE);
+  location.m_length = static_cast<uint16_t>(length);
+  uint32_t handle;
+  if (m_freeHandles.empty()) {
+    handle = static_cast<uint32_t>(m_locations.size());
+    m_locations.push_back(location);
+  } else {
+    handle = m_freeHandles.back();
+    m_freeHandles.pop_back();
+    m_locations[handle] = location;
+  }
+  m_slabs[location.m_slab]->m_owners[location.m_block] = handle;
+  std::memcpy(address(location), bytes, length);
+  m_bytesStored += length;
+  return handle;
+}
+
+uint32_t ValueArena::read(uint32_t handle, uint8_t* buffer) const {
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  const Location& location = m_locations[handle];
+  std::memcpy(buffer, address(location), location.m_length);
+  return location.m_length;
+}
+
+const uint8_t* ValueArena::pin(uint32_t handle) const {
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  ++m_pinned;
+  return address(m_locations[handle]);
+}
+
+void ValueArena::unpin() const {
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  --m_pinned;
+}
+
+void ValueArena::release(uint32_t handle) {
+  bool last;
+  {
+    std::lock_guard<spinlock_mutex> guard(m_lock);
+    Location location = m_locations[handle];
+    uint32_t sizeClass = m_slabs[location.m_slab]->m_sizeClass;
+    m_bytesStored -= location.m_length;
+    freeBlock(location);
+    m_freeHandles.push_back(handle);
+    // put off while values are read in place; a later release compacts
+    if (m_pinned == 0 &&
+        m_freeCount[sizeClass] >= 2 * blocksPerSlab(sizeClass)) {
+      compact(sizeClass);
+    }
+    last = m_retired && m_locations.size() == m_freeHandles.size();
+  }
+  if (last) {
+    delete this;
+  }
+}
+
+size_t ValueArena::bytesStored() const {
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  return m_bytesStored;
+}
+
+size_t ValueArena::bytesReserved() const {
+  std::lock_guard<spinlock_mutex> guard(m_lock);
+  return (m_slabs.size() - m_freeSlabs.size()) * SLAB_SIZE;
+}
+
+uint32_t ValueArena::sizeClassOf(uint32_t length) {
+  uint32_t sizeClass = 0;
+  while (SizeClasses[sizeClass] < length) {
+    ++sizeClass;
+  }
+  return sizeClass;
+}
+
+uint32_t ValueArena::blocksPerSlab(uint32_t sizeClass) {
+  return SLAB_SIZE / SizeClasses[sizeClass];
+}
+
+ValueArena::Location ValueArena::allocate(uint32_t sizeClass,
+                                          uint32_t excludedSlab) {
+  std::vector<uint32_t>& available = m_available[sizeClass];
+  size_t index = available.size();
+  while (index > 0 && available[index - 1] == excludedSlab) {
+    --index;
+  }
+  if (index == 0) {
+    available.insert(available.begin(), newSlab(sizeClass));
+    index = 1;
+  }
+  Location location;
+  location.m_slab = available[index - 1];
+  Slab& slab = *m_slabs[location.m_slab];
+  if (slab.m_freeBlocks.empty()) {
+    location.m_block = static_cast<uint16_t>(slab.m_used++);
+  } else {
+    location.m_block = slab.m_freeBlocks.back();
+    slab.m_freeBlocks.pop_back();
+  }
+  location.m_length = 0;
+  --m_freeCount[sizeClass];
+  if (slab.m_freeBlocks.empty() && slab.m_used == blocksPerSlab(sizeClass)) {
+    available.erase(available.begin() + (index - 1));
+  }
+  return location;
+}
+
+void ValueArena::freeBlock(const Location& location) {
+  Slab& slab = *m_slabs[location.m_slab];
+  bool wasFull = slab.m_freeBlocks.empty() &&
+                 slab.m_used == blocksPerSlab(slab.m_sizeClass);
+  slab.m_owners[location.m_block] = NO_HANDLE;
+  slab.m_freeBlocks.push_back(location.m_block);
+  ++m_freeCount[slab.m_sizeClass];
+  if (wasFull) {
+    m_available[slab.m_sizeClass].push_back(location.m_slab);
+  }
+}
+
+uint8_t* ValueArena::address(const Location& location) const {
+  const Slab& slab = *m_slabs[location.m_slab];
+  return slab.m_data.get() + location.m_block * SizeClasses[slab.m_sizeClass];
+}
+
+uint32_t ValueArena::newSlab(uint32_t sizeClass) {
+  std::unique_ptr<Slab> slab(new Slab());
+  slab->m_data.reset(new uint8_t[SLAB_SIZE]);
+  slab->m_sizeClass = sizeClass;
+  slab->m_used = 0;
+  slab->m_owners.resize(blocksPerSlab(sizeClass), NO_HANDLE);
+  uint32_t index;
+  if (m_freeSlabs.empty()) {
+    index = static_cast<uint32_t>(m_slabs.size());
+    m_slabs.push_back(std::move(slab));
+  } else {
+    index = m_freeSlabs.back();
+    m_freeSlabs.pop_back();
+    m_slabs[index] = std::move(slab);
+  }
+  ++m_slabCount[sizeClass];
+  m_freeCount[sizeClass] += blocksPerSlab(sizeClass);
+  return index;
+}
+
+void ValueArena::compact(uint32_t sizeClass) {
+  uint32_t perSlab = blocksPerSlab(sizeClass);
+  // the other slabs have room for the values of the emptied one as long as
+  // a slab's worth of blocks is free
+  while (m_freeCount[sizeClass] >= perSlab && m_slabCount[sizeClass] > 1) {
+    uint32_t source = NO_HANDLE;
+    uint32_t sourceValues = perSlab + 1;
+    for (uint32_t index = 0; index < m_slabs.size(); ++index) {
+      const Slab* slab = m_slabs[index].get();
+      if (slab != nullptr && slab->m_sizeClass == sizeClass) {
+        uint32_t values =
+            slab->m_used - static_cast<uint32_t>(slab->m_freeBlocks.size());
+        if (values < sourceValues) {
+          source = index;
+          sourceValues = values;
+        }
+      }
+    }
+    Slab& slab = *m_slabs[source];
+    for (uint32_t block = 0; block < slab.m_used; ++block) {
+      uint32_t handle = slab.m_owners[block];
+      if (handle == NO_HANDLE) {
+        continue;
+      }
+      Location& from = m_locations[handle];
+      Location to = allocate(sizeClass, source);
+      to.m_length = from.m_length;
+      std::memcpy(address(to), address(from), from.m_length);
+      m_slabs[to.m_slab]->m_owners[to.m_block] = handle;
+      from = to;
+    }
+    std::vector<uint32_t>& available = m_available[sizeClass];
+    available.erase(std::remove(available.begin(), available.end(), source),
+                    available.end());
+    m_slabs[source].reset();
+    m_freeSlabs.push_back(source);
+    --m_slabCount[sizeClass];
+    m_freeCount[sizeClass] -= perSlab - sourceValues;
+  }
+}
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
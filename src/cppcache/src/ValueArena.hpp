@@ -0,0 +1,185 @@
+#pragma once
+
+#ifndef GEODE_VALUEARENA_H_
+#define GEODE_VALUEARENA_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/geode_globals.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "util/concurrent/spinlock_mutex.hpp"
+
+/**
+ * @file ValueArena.hpp
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class ValueArena ValueArena.hpp
+ *
+ * Slab allocator for the serialized values of a region with arena storage.
+ * Values are rounded up to one of a few block sizes and packed into 64KB
+ * slabs holding blocks of a single size, so a small value costs its bytes
+ * plus a little rounding instead of a heap allocation of its own.
+ *
+ * Values are addressed through handles rather than pointers, which lets
+ * the arena move them: when the free blocks of a size add up to two slabs
+ * the sparsest slabs of that size are emptied into the others and freed,
+ * until less than one slab's worth of blocks is free. The arena is
+ * synchronized.
+ *
+ * Map entries refer to their arena by a 16-bit id rather than a pointer,
+ * see find(). An arena made by create() stays alive after its last owner
+ * lets go of it until the last value stored in it is released.
+ */
+class CPPCACHE_EXPORT ValueArena {
+ public:
+  /** Values larger than this are not stored. */
+  static const uint32_t MAX_VALUE_SIZE = 1024;
+
+  static const uint32_t SLAB_SIZE = 64 * 1024;
+
+  /** Returned by store for a value too large for the arena. */
+  static const uint32_t NO_HANDLE = UINT32_MAX;
+
+  /** Number of arenas that can have an id at the same time. */
+  static const uint16_t MAX_ARENAS = 1024;
+
+  /** The id of an arena created while MAX_ARENAS others existed. */
+  static const uint16_t NO_ID = UINT16_MAX;
+
+  /**
+   * @param poolName the pool whose type registry serializes the values,
+   * null when the region has none
+   */
+  explicit ValueArena(const char* poolName = nullptr);
+  ~ValueArena();
+
+  /**
+   * Creates an arena that is deleted once it has no owner and no values.
+   */
+  static std::shared_ptr<ValueArena> create(const char* poolName = nullptr);
+
+  /** The arena with the id, which must not have been deleted. */
+  inline static ValueArena* find(uint16_t id) {
+    return s_arenas[id].load(std::memory_order_acquire);
+  }
+
+  /** Identifies the arena for find(). */
+  inline uint16_t id() const { return m_id; }
+
+  const char* poolName() const {
+    return m_poolName.empty() ? nullptr : m_poolName.c_str();
+  }
+
+  /**
+   * Copies the value into the arena and returns its handle, or NO_HANDLE if
+   * the value is too large or the arena has no id.
+   */
+  uint32_t store(const uint8_t* bytes, uint32_t length);
+
+  /**
+   * Copies the value with the handle into the buffer, which must hold
+   * MAX_VALUE_SIZE bytes, and returns its length.
+   */
+  uint32_t read(uint32_t handle, uint8_t* buffer) const;
+
+  /**
+   * Returns the address of the value with the handle. The value is not
+   * moved by compaction until unpin() is called, so it can be read without
+   * copying it out under the lock.
+   */
+  const uint8_t* pin(uint32_t handle) const;
+
+  /** Ends a pin(). */
+  void unpin() const;
+
+  /** Frees the value with the handle; the handle may then be reused. */
+  void release(uint32_t handle);
+
+  /** Bytes of the values stored. */
+  size_t bytesStored() const;
+
+  /** Bytes of the slabs allocated. */
+  size_t bytesReserved() const;
+
+ private:
+  struct Slab {
+    std::unique_ptr<uint8_t[]> m_data;
+    uint32_t m_sizeClass;
+    // blocks handed out at least once; the rest were never used
+    uint32_t m_used;
+    // handle of the value in each used block, NO_HANDLE if it is free
+    std::vector<uint32_t> m_owners;
+    std::vector<uint16_t> m_freeBlocks;
+  };
+
+  struct Location {
+    uint32_t m_slab;
+    uint16_t m_block;
+    uint16_t m_length;
+  };
+
+  static uint32_t sizeClassOf(uint32_t length);
+  static uint32_t blocksPerSlab(uint32_t sizeClass);
+
+  // takes a free block of the size class outside the excluded slab
+  Location allocate(uint32_t sizeClass, uint32_t excludedSlab);
+  void freeBlock(const Location& location);
+  uint8_t* address(const Location& location) const;
+  uint32_t newSlab(uint32_t sizeClass);
+  void compact(uint32_t sizeClass);
+  static void retire(ValueArena* arena);
+
+  static std::atomic<ValueArena*> s_arenas[MAX_ARENAS];
+
+  const std::string m_poolName;
+  uint16_t m_id;
+  // set once the owners of an arena made by create() have let go of it
+  bool m_retired;
+  mutable uint32_t m_pinned;
+  mutable util::concurrent::spinlock_mutex m_lock;
+  std::vector<std::unique_ptr<Slab>> m_slabs;
+  std::vector<uint32_t> m_freeSlabs;
+  // per size class, the slabs with a free block
+  std::vector<std::vector<uint32_t>> m_available;
+  std::vector<uint32_t> m_slabCount;
+  std::vector<uint32_t> m_freeCount;
+  std::vector<Location> m_locations;
+  std::vector<uint32_t> m_freeHandles;
+  size_t m_bytesStored;
+
+  ValueArena(const ValueArena&);
+  ValueArena& operator=(const ValueArena&);
+};
+
+typedef std::shared_ptr<ValueArena> ValueArenaPtr;
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_VALUEARENA_H_
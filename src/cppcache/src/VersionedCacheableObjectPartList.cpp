@@ -19,6 +19,8 @@
 #include "GeodeTypeIdsImpl.hpp"
 #include <geode/CacheableString.hpp>
 #include "ThinClientRegion.hpp"
+#include "ThinClientBaseDM.hpp"
+#include "TcrMessage.hpp"
 #include "CacheableToken.hpp"
 #include "DiskStoreId.hpp"
 #include "DiskVersionTag.hpp"
@@ -91,7 +93,10 @@ void VersionedCacheableObjectPartList::readObjectPart(int32_t index,
     // set nullptr to indicate that there is no exception for the key on this
     // index
     // readObject
-    input.readObject(value);
+    ThinClientBaseDM* dm =
+        m_region != nullptr ? m_region->getDistMgr() : nullptr;
+    TcrMessageHelper::readObject(
+        input, value, dm != nullptr && dm->keepsValuesSerialized());
     if (m_values) m_values->emplace(keyPtr, value);
   }
 }
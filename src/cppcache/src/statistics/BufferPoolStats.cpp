@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BufferPoolStats.hpp"
+#include <DataOutputBufferPool.hpp>
+using namespace apache::geode::statistics;
+
+BufferPoolStats::BufferPoolStats() {
+  StatisticsFactory* statFactory = StatisticsFactory::getExistingInstance();
+  statDescriptorArr = new StatisticDescriptor*[4];
+  statDescriptorArr[0] = statFactory->createLongCounter(
+      "bufferHits",
+      "Total number of DataOutput buffers taken from the buffer pool.",
+      "buffers", true);
+  statDescriptorArr[1] = statFactory->createLongCounter(
+      "bufferMisses",
+      "Total number of DataOutput buffers allocated because the buffer pool "
+      "was empty.",
+      "buffers", false);
+  statDescriptorArr[2] = statFactory->createLongGauge(
+      "bytesHeld", "Current number of bytes held by the buffer pool.",
+      "bytes", false);
+  statDescriptorArr[3] = statFactory->createLongCounter(
+      "bufferDiscards",
+      "Total number of DataOutput buffers freed because the buffer pool was "
+      "full.",
+      "buffers", false);
+
+  bufferPoolType = statFactory->createType(
+      "DataOutputBufferPool", "Stats on the pool of DataOutput buffers.",
+      statDescriptorArr, 4);
+  hitsId = bufferPoolType->nameToId("bufferHits");
+  missesId = bufferPoolType->nameToId("bufferMisses");
+  bytesHeldId = bufferPoolType->nameToId("bytesHeld");
+  discardsId = bufferPoolType->nameToId("bufferDiscards");
+  bufferPoolStats = statFactory->createStatistics(
+      bufferPoolType, "dataOutputBufferPool", statFactory->getId());
+  refresh();
+}
+
+/**
+ * Copies the current values of the pool counters into the statistics.
+ */
+void BufferPoolStats::refresh() {
+  if (bufferPoolStats) {
+    bufferPoolStats->setLong(hitsId, DataOutputBufferPool::getHits());
+    bufferPoolStats->setLong(missesId, DataOutputBufferPool::getMisses());
+    bufferPoolStats->setLong(bytesHeldId, DataOutputBufferPool::getBytesHeld());
+    bufferPoolStats->setLong(discardsId, DataOutputBufferPool::getDiscards());
+  }
+}
+
+/**
+ * It is mandatory to call this function for proper deletion of stats objects.
+ */
+void BufferPoolStats::close() {
+  if (bufferPoolStats) {
+    bufferPoolStats->close();
+  }
+}
+
+BufferPoolStats::~BufferPoolStats() {
+  bufferPoolType = nullptr;
+  for (int32_t i = 0; i < 4; i++) {
+    statDescriptorArr[i] = nullptr;
+  }
+  bufferPoolStats = nullptr;
+}
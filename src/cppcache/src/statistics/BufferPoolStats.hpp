@@ -0,0 +1,63 @@
+#pragma once
+
+#ifndef GEODE_STATISTICS_BUFFERPOOLSTATS_H_
+#define GEODE_STATISTICS_BUFFERPOOLSTATS_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/geode_globals.hpp>
+#include <geode/statistics/StatisticDescriptor.hpp>
+#include <geode/statistics/StatisticsType.hpp>
+#include <geode/statistics/Statistics.hpp>
+#include <geode/statistics/StatisticsFactory.hpp>
+
+using namespace apache::geode::client;
+
+/** @file
+*/
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+/**
+ * Statistics on the pool of DataOutput buffers. The pool counts without
+ * statistics so that it works before the system is connected; the values are
+ * copied from it each time the sampler runs.
+ */
+class CPPCACHE_EXPORT BufferPoolStats {
+ private:
+  StatisticsType* bufferPoolType;
+  Statistics* bufferPoolStats;
+  int32_t hitsId;
+  int32_t missesId;
+  int32_t bytesHeldId;
+  int32_t discardsId;
+  StatisticDescriptor** statDescriptorArr;
+
+ public:
+  BufferPoolStats();
+  void refresh();
+  void close();
+  ~BufferPoolStats();
+};
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_BUFFERPOOLSTATS_H_
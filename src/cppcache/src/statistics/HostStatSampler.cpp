@@ -133,6 +133,8 @@ HostStatSampler::HostStatSampler(const char* filePath, int64_t sampleIntervalMs,
   m_stopRequested = false;
   m_archiver = nullptr;
   m_samplerStats = new StatSamplerStats();
+  m_bufferPoolStats = new BufferPoolStats();
+  m_threadPoolStats = new ThreadPoolStats();
 
   m_startTime = system_clock::now();
 
@@ -256,6 +258,14 @@ HostStatSampler::~HostStatSampler() {
     delete m_samplerStats;
     m_samplerStats = nullptr;
   }
+  if (m_bufferPoolStats != nullptr) {
+    delete m_bufferPoolStats;
+    m_bufferPoolStats = nullptr;
+  }
+  if (m_threadPoolStats != nullptr) {
+    delete m_threadPoolStats;
+    m_threadPoolStats = nullptr;
+  }
   if (m_archiver != nullptr) {
     delete m_archiver;
     m_archiver = nullptr;
@@ -503,7 +513,11 @@ void HostStatSampler::initSpecialStats() {
   HostStatHelper::newProcessStats(m_pid, "ProcessStats");
 }
 
-void HostStatSampler::sampleSpecialStats() { HostStatHelper::refresh(); }
+void HostStatSampler::sampleSpecialStats() {
+  HostStatHelper::refresh();
+  m_bufferPoolStats->refresh();
+  m_threadPoolStats->refresh();
+}
 
 void HostStatSampler::closeSpecialStats() {
   ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_statMngr->getListMutex());
@@ -752,6 +766,8 @@ int32_t HostStatSampler::svc(void) {
     }
     closeSpecialStats();
     m_samplerStats->close();
+    m_bufferPoolStats->close();
+    m_threadPoolStats->close();
     if (m_archiver != nullptr) {
       m_archiver->close();
     }
@@ -31,6 +31,8 @@
 #include "StatisticsManager.hpp"
 #include <geode/statistics/StatisticsType.hpp>
 #include "StatSamplerStats.hpp"
+#include "BufferPoolStats.hpp"
+#include "ThreadPoolStats.hpp"
 #include "StatArchiveWriter.hpp"
 #include <geode/ExceptionTypes.hpp>
 
@@ -207,6 +209,8 @@ class CPPCACHE_EXPORT HostStatSampler : public ACE_Task_Base,
   volatile bool m_isStatDiskSpaceEnabled;
   StatArchiveWriter* m_archiver;
   StatSamplerStats* m_samplerStats;
+  BufferPoolStats* m_bufferPoolStats;
+  ThreadPoolStats* m_threadPoolStats;
 
   std::string m_archiveFileName;
   int64_t m_archiveFileSizeLimit;
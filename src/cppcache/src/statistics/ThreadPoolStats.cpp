@@ -0,0 +1,89 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPoolStats.hpp"
+#include <ThreadPool.hpp>
+using namespace apache::geode::statistics;
+
+ThreadPoolStats::ThreadPoolStats() {
+  StatisticsFactory* statFactory = StatisticsFactory::getExistingInstance();
+  statDescriptorArr = new StatisticDescriptor*[5];
+  statDescriptorArr[0] = statFactory->createLongCounter(
+      "tasks", "Total number of single-hop sub-tasks performed.", "tasks",
+      true);
+  statDescriptorArr[1] = statFactory->createLongGauge(
+      "tasksQueued",
+      "Current number of single-hop sub-tasks waiting to be started.",
+      "tasks", false);
+  statDescriptorArr[2] = statFactory->createLongCounter(
+      "tasksStolen",
+      "Total number of sub-tasks a worker took from the queue of another "
+      "worker.",
+      "tasks", false);
+  statDescriptorArr[3] = statFactory->createLongCounter(
+      "tasksRunInCaller",
+      "Total number of sub-tasks run by the thread waiting for their result "
+      "because no worker had started them.",
+      "tasks", false);
+  statDescriptorArr[4] = statFactory->createLongCounter(
+      "taskQueueTime",
+      "Total time sub-tasks spent queued before they were started.",
+      "nanoseconds", false);
+
+  threadPoolType = statFactory->createType(
+      "ThreadPool", "Stats on the executor of single-hop sub-tasks.",
+      statDescriptorArr, 5);
+  tasksId = threadPoolType->nameToId("tasks");
+  tasksQueuedId = threadPoolType->nameToId("tasksQueued");
+  tasksStolenId = threadPoolType->nameToId("tasksStolen");
+  tasksRunInCallerId = threadPoolType->nameToId("tasksRunInCaller");
+  queueTimeId = threadPoolType->nameToId("taskQueueTime");
+  threadPoolStats = statFactory->createStatistics(
+      threadPoolType, "threadPool", statFactory->getId());
+  refresh();
+}
+
+/**
+ * Copies the current values of the executor counters into the statistics.
+ */
+void ThreadPoolStats::refresh() {
+  if (threadPoolStats) {
+    threadPoolStats->setLong(tasksId, ThreadPool::getTasks());
+    threadPoolStats->setLong(tasksQueuedId, ThreadPool::getTasksQueued());
+    threadPoolStats->setLong(tasksStolenId, ThreadPool::getTasksStolen());
+    threadPoolStats->setLong(tasksRunInCallerId,
+                             ThreadPool::getTasksRunInCaller());
+    threadPoolStats->setLong(queueTimeId, ThreadPool::getQueueTime());
+  }
+}
+
+/**
+ * It is mandatory to call this function for proper deletion of stats objects.
+ */
+void ThreadPoolStats::close() {
+  if (threadPoolStats) {
+    threadPoolStats->close();
+  }
+}
+
+ThreadPoolStats::~ThreadPoolStats() {
+  threadPoolType = nullptr;
+  for (int32_t i = 0; i < 5; i++) {
+    statDescriptorArr[i] = nullptr;
+  }
+  threadPoolStats = nullptr;
+}
@@ -0,0 +1,197 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CONCURRENT_PASSIVE_RW_MUTEX_H_
+#define GEODE_UTIL_CONCURRENT_PASSIVE_RW_MUTEX_H_
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+#include "spinlock_mutex.hpp"
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+/**
+ * Reader/writer mutex for read mostly data in which readers never write to
+ * memory shared with other readers.
+ *
+ * Every thread owns a cache line sized slot in which it publishes the mutex
+ * it is reading under. A reader stores the mutex in its slot and then checks
+ * that no writer is active; a writer takes the underlying spinlock, raises
+ * its flag and then waits until no slot names the mutex any more. Readers of
+ * the same hot mutex therefore share its cache line read only, while every
+ * write pays for a scan of the slots of the threads that ever read.
+ *
+ * Threads beyond the number of slots, and threads already reading under
+ * another passive_rw_mutex, read under the exclusive lock. The mutex is not
+ * recursive.
+ */
+class passive_rw_mutex final {
+ public:
+  /** Number of threads that can read without taking the exclusive lock. */
+  static const size_t MAX_READERS = 256;
+
+  passive_rw_mutex() : m_writer(false) {}
+  passive_rw_mutex(const passive_rw_mutex &) = delete;
+  passive_rw_mutex &operator=(const passive_rw_mutex &) = delete;
+
+  void lock() {
+    m_lock.lock();
+    m_writer.store(true, std::memory_order_seq_cst);
+    size_t readers = registry().m_used.load(std::memory_order_acquire);
+    for (size_t index = 0; index < readers; ++index) {
+      const std::atomic<const void *> &slot =
+          registry().m_slots[index].m_mutex;
+      while (slot.load(std::memory_order_seq_cst) == this) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void unlock() {
+    m_writer.store(false, std::memory_order_release);
+    m_lock.unlock();
+  }
+
+  void lock_shared() {
+    std::atomic<const void *> *slot = localSlot();
+    if (slot == nullptr || slot->load(std::memory_order_relaxed) != nullptr) {
+      // no slot left, or already reading under another mutex
+      m_lock.lock();
+      return;
+    }
+    while (true) {
+      slot->store(this, std::memory_order_seq_cst);
+      if (!m_writer.load(std::memory_order_seq_cst)) {
+        return;
+      }
+      slot->store(nullptr, std::memory_order_release);
+      while (m_writer.load(std::memory_order_relaxed)) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void unlock_shared() {
+    std::atomic<const void *> *slot = localSlot();
+    if (slot == nullptr || slot->load(std::memory_order_relaxed) != this) {
+      m_lock.unlock();
+      return;
+    }
+    slot->store(nullptr, std::memory_order_release);
+  }
+
+ private:
+  struct alignas(64) Slot {
+    Slot() : m_mutex(nullptr), m_free(true) {}
+    std::atomic<const void *> m_mutex;
+    std::atomic<bool> m_free;
+  };
+
+  struct Registry {
+    Registry() : m_used(0) {}
+    Slot m_slots[MAX_READERS];
+    // slots handed out so far, the only ones a writer scans
+    std::atomic<size_t> m_used;
+  };
+
+  // Claims a slot for the calling thread and frees it on thread exit.
+  class LocalSlot {
+   public:
+    LocalSlot() : m_slot(nullptr) {
+      Registry &slots = registry();
+      size_t used = slots.m_used.load(std::memory_order_acquire);
+      for (size_t index = 0; index < used; ++index) {
+        if (claim(slots.m_slots[index])) {
+          return;
+        }
+      }
+      while (used < MAX_READERS) {
+        if (slots.m_used.compare_exchange_weak(used, used + 1)) {
+          if (claim(slots.m_slots[used])) {
+            return;
+          }
+          used = slots.m_used.load(std::memory_order_acquire);
+        }
+      }
+    }
+
+    ~LocalSlot() {
+      if (m_slot != nullptr) {
+        m_slot->m_free.store(true, std::memory_order_release);
+      }
+    }
+
+    std::atomic<const void *> *get() {
+      return m_slot == nullptr ? nullptr : &m_slot->m_mutex;
+    }
+
+   private:
+    bool claim(Slot &slot) {
+      bool expected = true;
+      if (slot.m_free.compare_exchange_strong(expected, false)) {
+        m_slot = &slot;
+        return true;
+      }
+      return false;
+    }
+
+    Slot *m_slot;
+  };
+
+  static Registry &registry() {
+    static Registry slots;
+    return slots;
+  }
+
+  static std::atomic<const void *> *localSlot() {
+    static thread_local LocalSlot slot;
+    return slot.get();
+  }
+
+  spinlock_mutex m_lock;
+  std::atomic<bool> m_writer;
+};
+
+/** Holds a passive_rw_mutex (or any mutex with lock_shared) for reading. */
+template <class Mutex>
+class shared_lock_guard final {
+ public:
+  explicit shared_lock_guard(Mutex &mutex) : m_mutex(mutex) {
+    m_mutex.lock_shared();
+  }
+  ~shared_lock_guard() { m_mutex.unlock_shared(); }
+
+  shared_lock_guard(const shared_lock_guard &) = delete;
+  shared_lock_guard &operator=(const shared_lock_guard &) = delete;
+
+ private:
+  Mutex &m_mutex;
+};
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
+
+#endif /* GEODE_UTIL_CONCURRENT_PASSIVE_RW_MUTEX_H_ */
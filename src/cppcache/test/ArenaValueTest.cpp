@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+
+#include "ArenaValue.hpp"
+#include "CacheableToken.hpp"
+#include "MapEntry.hpp"
+#include "SerializationRegistry.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+const int32_t EntryCount = 10000;
+
+class ArenaValueTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    SerializationRegistry::init();
+    m_factory.setConcurrencyChecksEnabled(false);
+  }
+
+  MapEntryImplPtr newEntry(int32_t index) {
+    MapEntryImplPtr entry;
+    m_factory.newMapEntry(CacheableInt32::create(index), entry);
+    return entry;
+  }
+
+  static CacheablePtr valueOf(int32_t index) {
+    return CacheableString::create(
+        ("value-" + std::to_string(index)).c_str());
+  }
+
+  EntryFactory m_factory;
+};
+}  // namespace
+
+TEST_F(ArenaValueTest, EntriesKeepNoValueObject) {
+  ValueArenaPtr arena = ValueArena::create();
+  MapEntryImplPtr entry = newEntry(1);
+  CacheablePtr packed = ArenaValue::pack(arena, valueOf(1));
+  ASSERT_TRUE(ArenaValue::isPacked(packed));
+  std::weak_ptr<Cacheable> carrier = packed;
+
+  entry->setValueI(packed);
+  packed = nullptr;
+  EXPECT_TRUE(carrier.expired());
+
+  CacheablePtr value;
+  entry->getValueI(value);
+  auto string = std::dynamic_pointer_cast<CacheableString>(value);
+  ASSERT_NE(nullptr, string);
+  EXPECT_STREQ("value-1", string->asChar());
+
+  entry->setValueI(CacheableInt32::create(2));
+  EXPECT_EQ(0U, arena->bytesStored());
+}
+
+TEST_F(ArenaValueTest, ArenaOutlivesItsOwnersWhileValuesRemain) {
+  ValueArenaPtr arena = ValueArena::create();
+  MapEntryImplPtr entry = newEntry(1);
+  entry->setValueI(ArenaValue::pack(arena, valueOf(1)));
+  arena = nullptr;
+
+  CacheablePtr value;
+  entry->getValueI(value);
+  auto string = std::dynamic_pointer_cast<CacheableString>(value);
+  ASSERT_NE(nullptr, string);
+  EXPECT_STREQ("value-1", string->asChar());
+  entry = nullptr;
+}
+
+TEST_F(ArenaValueTest, PeekSeesTokensWithoutUnpacking) {
+  ValueArenaPtr arena = ValueArena::create();
+  MapEntryImplPtr entry = newEntry(1);
+  CacheablePtr token;
+
+  entry->setValueI(ArenaValue::pack(arena, valueOf(1)));
+  EXPECT_TRUE(entry->peekValueI(token));
+  EXPECT_EQ(nullptr, token);
+
+  entry->setValueI(CacheableToken::tombstone());
+  EXPECT_TRUE(entry->peekValueI(token));
+  EXPECT_TRUE(CacheableToken::isTombstone(token));
+
+  entry->setValueI(CacheableToken::invalid());
+  EXPECT_TRUE(entry->peekValueI(token));
+  EXPECT_TRUE(CacheableToken::isInvalid(token));
+
+  // a destroyed entry has no value, as for getValueI()
+  entry->setValueI(CacheableToken::destroyed());
+  EXPECT_FALSE(entry->peekValueI(token));
+  EXPECT_EQ(nullptr, token);
+
+  entry->setValueI(valueOf(2));
+  EXPECT_TRUE(entry->peekValueI(token));
+  EXPECT_EQ(nullptr, token);
+}
+
+TEST_F(ArenaValueTest, BytesPerEntryBelowBaseline) {
+  ValueArenaPtr arena = ValueArena::create();
+  std::vector<MapEntryImplPtr> entries;
+  size_t heapBytes = 0;
+  for (int32_t index = 0; index < EntryCount; ++index) {
+    CacheablePtr value = valueOf(index);
+    heapBytes += value->objectSize();
+    MapEntryImplPtr entry = newEntry(index);
+    entry->setValueI(ArenaValue::pack(arena, value));
+    entries.push_back(entry);
+  }
+
+  // the handle, arena id and length kept in the entry itself
+  size_t inlineBytes =
+      sizeof(MapEntryImpl) - (sizeof(void*) +
+                              sizeof(std::weak_ptr<MapEntryImpl>) +
+                              sizeof(CacheablePtr) + sizeof(CacheableKeyPtr));
+  EXPECT_LE(inlineBytes, 8U);
+
+  size_t arenaBytes = arena->bytesReserved() / EntryCount;
+  size_t bytesPerEntry = arenaBytes + inlineBytes;
+  // an ArenaValue object per entry, not counting its control block
+  size_t baseline = arenaBytes + sizeof(ArenaValue);
+  EXPECT_LT(bytesPerEntry, baseline);
+  EXPECT_LT(bytesPerEntry, heapBytes / EntryCount);
+
+  for (int32_t index = 0; index < EntryCount; index += 97) {
+    CacheablePtr value;
+    entries[index]->getValueI(value);
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(valueOf(index)->toString()->asChar(),
+              std::string(value->toString()->asChar()));
+  }
+  entries.clear();
+  EXPECT_EQ(0U, arena->bytesStored());
+}
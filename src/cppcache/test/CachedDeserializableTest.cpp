@@ -0,0 +1,77 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <geode/CachedDeserializable.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <TcrMessage.hpp>
+
+using namespace apache::geode::client;
+
+namespace {
+// a PDX value with 4 bytes of fields: type id byte, length, PDX type id
+const uint8_t pdxValue[] = {93, 0, 0, 0, 4, 0, 0, 0, 7, 1, 2, 3, 4};
+const int32_t pdxValueLength = static_cast<int32_t>(sizeof(pdxValue));
+}  // namespace
+
+TEST(CachedDeserializableTest, WritesReceivedBytes) {
+  CachedDeserializablePtr value =
+      CachedDeserializable::create(pdxValue, pdxValueLength);
+  EXPECT_EQ(pdxValueLength, value->getSerializedLength());
+  EXPECT_FALSE(value->isDeserialized());
+
+  DataOutput output;
+  output.writeObject(value);
+  ASSERT_EQ(static_cast<uint32_t>(pdxValueLength), output.getBufferLength());
+  EXPECT_EQ(0, std::memcmp(pdxValue, output.getBuffer(), pdxValueLength));
+  EXPECT_FALSE(value->isDeserialized());
+}
+
+TEST(CachedDeserializableTest, RejectsOtherValues) {
+  const uint8_t intValue[] = {GeodeTypeIds::CacheableInt32, 0, 0, 0, 1};
+  EXPECT_THROW(CachedDeserializable::create(intValue, sizeof(intValue)),
+               IllegalArgumentException);
+}
+
+TEST(CachedDeserializableTest, ReadsPdxValueUndeserialized) {
+  uint8_t buffer[pdxValueLength + 1];
+  std::memcpy(buffer, pdxValue, pdxValueLength);
+  buffer[pdxValueLength] = 42;
+  DataInput input(buffer, sizeof(buffer));
+
+  SerializablePtr value;
+  TcrMessageHelper::readObject(input, value, true);
+  auto cached = std::dynamic_pointer_cast<CachedDeserializable>(value);
+  ASSERT_NE(nullptr, cached);
+  EXPECT_EQ(pdxValueLength, cached->getSerializedLength());
+  EXPECT_EQ(0, std::memcmp(pdxValue, cached->getSerializedValue(),
+                           pdxValueLength));
+  EXPECT_EQ(1, input.getBytesRemaining());
+}
+
+TEST(CachedDeserializableTest, IgnoresTruncatedPdxValue) {
+  DataInput input(pdxValue, pdxValueLength - 1);
+  EXPECT_EQ(0, TcrMessageHelper::getPdxValueLength(input));
+
+  DataInput complete(pdxValue, pdxValueLength);
+  EXPECT_EQ(pdxValueLength, TcrMessageHelper::getPdxValueLength(complete));
+}
@@ -0,0 +1,204 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ace/Recursive_Thread_Mutex.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/GetAllListener.hpp>
+
+#include "TcrMessage.hpp"
+#include "ThinClientRegion.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+/** Records the maps it is handed, one per call. */
+class RecordingListener : public GetAllListener {
+ public:
+  virtual void onValues(const HashMapOfCacheable& values) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_values.push_back(values);
+  }
+
+  virtual void onExceptions(const HashMapOfException& exceptions) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_exceptions.push_back(exceptions);
+  }
+
+  std::vector<HashMapOfCacheable> m_values;
+  std::vector<HashMapOfException> m_exceptions;
+
+ private:
+  std::mutex m_mutex;
+};
+
+CacheableKeyPtr keyOf(int32_t index) { return CacheableInt32::create(index); }
+
+HashMapOfCacheablePtr valuesOf(int32_t first, int32_t count) {
+  auto values = std::make_shared<HashMapOfCacheable>();
+  for (int32_t index = first; index < first + count; ++index) {
+    values->emplace(keyOf(index), CacheableInt32::create(index * 10));
+  }
+  return values;
+}
+
+VectorOfCacheableKeyPtr keysOf(int32_t first, int32_t count) {
+  auto keys = std::make_shared<VectorOfCacheableKey>();
+  for (int32_t index = first; index < first + count; ++index) {
+    keys->push_back(keyOf(index));
+  }
+  return keys;
+}
+
+/** The results of a getAll, shared by the responses to all its batches. */
+class ChunkedGetAllResponseTest : public ::testing::Test {
+ protected:
+  ChunkedGetAllResponseTest()
+      : m_reply(true, nullptr),
+        m_values(std::make_shared<HashMapOfCacheable>()),
+        m_exceptions(std::make_shared<HashMapOfException>()),
+        m_resultKeys(std::make_shared<VectorOfCacheableKey>()) {}
+
+  std::unique_ptr<ChunkedGetAllResponse> newResponse(
+      const GetAllListenerPtr& listener = nullptr) {
+    return std::unique_ptr<ChunkedGetAllResponse>(new ChunkedGetAllResponse(
+        m_reply, nullptr, nullptr, m_values, m_exceptions, m_resultKeys,
+        m_trackerMap, 0, false, m_responseLock, listener));
+  }
+
+  TcrMessageReply m_reply;
+  HashMapOfCacheablePtr m_values;
+  HashMapOfExceptionPtr m_exceptions;
+  VectorOfCacheableKeyPtr m_resultKeys;
+  MapOfUpdateCounters m_trackerMap;
+  ACE_Recursive_Thread_Mutex m_responseLock;
+};
+}  // namespace
+
+TEST_F(ChunkedGetAllResponseTest, ChunksOfAllBatchesAreMerged) {
+  auto first = newResponse();
+  auto second = newResponse();
+  auto exceptions = std::make_shared<HashMapOfException>();
+  exceptions->emplace(keyOf(5),
+                      std::make_shared<CacheServerException>("failed"));
+
+  first->addChunk(valuesOf(0, 2), std::make_shared<HashMapOfException>(),
+                  keysOf(0, 2));
+  second->addChunk(valuesOf(2, 2), exceptions, keysOf(2, 4));
+  first->addChunk(valuesOf(4, 1), std::make_shared<HashMapOfException>(),
+                  keysOf(4, 1));
+
+  EXPECT_EQ(5U, m_values->size());
+  for (int32_t index = 0; index < 5; ++index) {
+    auto value = std::dynamic_pointer_cast<CacheableInt32>(
+        m_values->at(keyOf(index)));
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(index * 10, value->value());
+  }
+  EXPECT_EQ(1U, m_exceptions->size());
+  EXPECT_EQ(1U, m_exceptions->count(keyOf(5)));
+  EXPECT_EQ(7U, m_resultKeys->size());
+}
+
+TEST_F(ChunkedGetAllResponseTest, ListenerGetsEachChunkOnItsOwn) {
+  auto listener = std::make_shared<RecordingListener>();
+  // a getAll with a listener collects no results of its own
+  m_values = nullptr;
+  m_exceptions = nullptr;
+  m_resultKeys = nullptr;
+  auto response = newResponse(listener);
+  auto exceptions = std::make_shared<HashMapOfException>();
+  exceptions->emplace(keyOf(9),
+                      std::make_shared<CacheServerException>("failed"));
+
+  response->addChunk(valuesOf(0, 3), std::make_shared<HashMapOfException>(),
+                     nullptr);
+  response->addChunk(valuesOf(3, 2), exceptions, nullptr);
+  response->addChunk(std::make_shared<HashMapOfCacheable>(),
+                     std::make_shared<HashMapOfException>(), nullptr);
+
+  // every call only has the values of its chunk, and empty chunks are not
+  // passed on
+  ASSERT_EQ(2U, listener->m_values.size());
+  EXPECT_EQ(3U, listener->m_values[0].size());
+  EXPECT_EQ(1U, listener->m_values[0].count(keyOf(0)));
+  EXPECT_EQ(2U, listener->m_values[1].size());
+  EXPECT_EQ(1U, listener->m_values[1].count(keyOf(3)));
+  ASSERT_EQ(1U, listener->m_exceptions.size());
+  EXPECT_EQ(1U, listener->m_exceptions[0].count(keyOf(9)));
+}
+
+TEST_F(ChunkedGetAllResponseTest, ConcurrentBatchesAreAllMerged) {
+  const int32_t Batches = 4;
+  const int32_t ChunksPerBatch = 100;
+  const int32_t KeysPerChunk = 10;
+  auto listener = std::make_shared<RecordingListener>();
+  std::vector<std::thread> threads;
+  for (int32_t batch = 0; batch < Batches; ++batch) {
+    threads.emplace_back([this, listener, batch, ChunksPerBatch,
+                          KeysPerChunk]() {
+      auto response = newResponse(listener);
+      for (int32_t chunk = 0; chunk < ChunksPerBatch; ++chunk) {
+        int32_t first = (batch * ChunksPerBatch + chunk) * KeysPerChunk;
+        response->addChunk(valuesOf(first, KeysPerChunk),
+                           std::make_shared<HashMapOfException>(),
+                           keysOf(first, KeysPerChunk));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  size_t total = Batches * ChunksPerBatch * KeysPerChunk;
+  EXPECT_EQ(total, m_values->size());
+  EXPECT_EQ(total, m_resultKeys->size());
+  EXPECT_EQ(static_cast<size_t>(Batches * ChunksPerBatch),
+            listener->m_values.size());
+}
+
+TEST_F(ChunkedGetAllResponseTest, AddMergesTheOtherResponse) {
+  auto response = newResponse();
+  m_values->emplace(keyOf(0), CacheableInt32::create(0));
+
+  auto otherValues = valuesOf(1, 2);
+  auto otherExceptions = std::make_shared<HashMapOfException>();
+  otherExceptions->emplace(keyOf(3),
+                           std::make_shared<CacheServerException>("failed"));
+  auto otherKeys = keysOf(1, 3);
+  MapOfUpdateCounters otherTrackerMap;
+  otherTrackerMap[keyOf(1)] = 7;
+  ACE_Recursive_Thread_Mutex otherLock;
+  ChunkedGetAllResponse other(m_reply, nullptr, nullptr, otherValues,
+                              otherExceptions, otherKeys, otherTrackerMap, 0,
+                              false, otherLock);
+
+  response->add(&other);
+
+  EXPECT_EQ(3U, m_values->size());
+  EXPECT_EQ(1U, m_values->count(keyOf(2)));
+  EXPECT_EQ(1U, m_exceptions->count(keyOf(3)));
+  EXPECT_EQ(3U, m_resultKeys->size());
+  EXPECT_EQ(7, m_trackerMap[keyOf(1)]);
+}
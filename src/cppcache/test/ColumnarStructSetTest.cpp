@@ -0,0 +1,166 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "ColumnarStructSetImpl.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+ColumnarStructSetImplPtr decode(const std::vector<const char*>& fieldNames,
+                                const std::vector<CacheablePtr>& values) {
+  DataOutput output;
+  for (const auto& value : values) {
+    output.writeObject(value);
+  }
+  std::vector<CacheableStringPtr> names;
+  for (const auto& name : fieldNames) {
+    names.push_back(CacheableString::create(name));
+  }
+
+  auto columns = std::make_shared<ColumnarStructSetImpl>();
+  columns->setFieldNames(names);
+  DataInput input(output.getBuffer(), output.getBufferLength());
+  for (size_t i = 0; i < values.size(); ++i) {
+    columns->readValue(input, false);
+  }
+  EXPECT_EQ(0, input.getBytesRemaining());
+  return columns;
+}
+}  // namespace
+
+TEST(ColumnarStructSetTest, DecodesTypedColumns) {
+  auto columns = decode(
+      {"id", "price", "name"},
+      {CacheableInt32::create(1), CacheableDouble::create(2.5),
+       CacheableString::create("one"), CacheableInt64::create(2), nullptr,
+       CacheableString::create("two")});
+
+  ASSERT_TRUE(columns->isComplete());
+  EXPECT_EQ(2, columns->size());
+  EXPECT_EQ(3, columns->getFieldCount());
+  EXPECT_EQ(2, columns->getFieldIndex("name"));
+  EXPECT_STREQ("price", columns->getFieldName(1));
+  EXPECT_EQ(ColumnarStructSet::INT64_COLUMN, columns->getColumnType(0));
+  EXPECT_EQ(ColumnarStructSet::DOUBLE_COLUMN, columns->getColumnType(1));
+  EXPECT_EQ(ColumnarStructSet::STRING_COLUMN, columns->getColumnType(2));
+
+  EXPECT_EQ(1, columns->getInt64(0, 0));
+  EXPECT_EQ(2, columns->getInt64(1, 0));
+  EXPECT_EQ(2.5, columns->getDouble(0, 1));
+  EXPECT_TRUE(columns->isNull(1, 1));
+  EXPECT_EQ(0, columns->getDouble(1, 1));
+  EXPECT_STREQ("one", columns->getString(0, 2));
+  EXPECT_STREQ("two", columns->getString(1, 2));
+
+  EXPECT_THROW(columns->getString(0, 0), IllegalStateException);
+  EXPECT_THROW(columns->getInt64(2, 0), IllegalArgumentException);
+  EXPECT_THROW(columns->getFieldIndex("none"), IllegalArgumentException);
+}
+
+TEST(ColumnarStructSetTest, CursorVisitsEveryRow) {
+  auto columns =
+      decode({"id"}, {CacheableInt32::create(1), CacheableInt32::create(2),
+                      CacheableInt32::create(3)});
+
+  ColumnarStructSetCursor cursor = columns->getCursor();
+  int64_t sum = 0;
+  int32_t rows = 0;
+  while (cursor.next()) {
+    sum += cursor.getInt64(0);
+    ++rows;
+  }
+  EXPECT_EQ(3, rows);
+  EXPECT_EQ(6, sum);
+  EXPECT_FALSE(cursor.next());
+}
+
+TEST(ColumnarStructSetTest, MixedValuesBecomeObjects) {
+  auto columns = decode({"value"}, {nullptr, CacheableInt32::create(7),
+                                    CacheableString::create("seven"),
+                                    CacheableBoolean::create(true)});
+
+  EXPECT_EQ(ColumnarStructSet::OBJECT_COLUMN, columns->getColumnType(0));
+  EXPECT_EQ(nullptr, columns->getObject(0, 0));
+  auto number =
+      std::dynamic_pointer_cast<CacheableInt32>(columns->getObject(1, 0));
+  ASSERT_NE(nullptr, number);
+  EXPECT_EQ(7, number->value());
+  auto name =
+      std::dynamic_pointer_cast<CacheableString>(columns->getObject(2, 0));
+  ASSERT_NE(nullptr, name);
+  EXPECT_STREQ("seven", name->asChar());
+  EXPECT_NE(nullptr,
+            std::dynamic_pointer_cast<CacheableBoolean>(
+                columns->getObject(3, 0)));
+}
+
+TEST(ColumnarStructSetTest, MixedColumnKeepsReceivedTypes) {
+  auto columns = decode({"a", "b"}, {CacheableInt32::create(1),
+                                     CacheableFloat::create(1.5f),
+                                     CacheableBoolean::create(false),
+                                     CacheableBoolean::create(true)});
+
+  EXPECT_EQ(ColumnarStructSet::OBJECT_COLUMN, columns->getColumnType(0));
+  EXPECT_EQ(ColumnarStructSet::OBJECT_COLUMN, columns->getColumnType(1));
+  auto number =
+      std::dynamic_pointer_cast<CacheableInt32>(columns->getObject(0, 0));
+  ASSERT_NE(nullptr, number);
+  EXPECT_EQ(1, number->value());
+  auto fraction =
+      std::dynamic_pointer_cast<CacheableFloat>(columns->getObject(0, 1));
+  ASSERT_NE(nullptr, fraction);
+  EXPECT_EQ(1.5f, fraction->value());
+  auto flag =
+      std::dynamic_pointer_cast<CacheableBoolean>(columns->getObject(1, 0));
+  ASSERT_NE(nullptr, flag);
+  EXPECT_FALSE(flag->value());
+}
+
+TEST(ColumnarStructSetTest, TypedColumnReturnsReceivedType) {
+  auto columns = decode({"id"}, {CacheableInt16::create(3)});
+
+  EXPECT_EQ(ColumnarStructSet::INT64_COLUMN, columns->getColumnType(0));
+  EXPECT_EQ(3, columns->getInt64(0, 0));
+  EXPECT_NE(nullptr, std::dynamic_pointer_cast<CacheableInt16>(
+                         columns->getObject(0, 0)));
+}
+
+TEST(ColumnarStructSetTest, KeepsNonAsciiStringsEncoded) {
+  const wchar_t* wide = L"caf\u00e9 \u20ac";
+  auto columns = decode({}, {CacheableString::create(wide)});
+
+  EXPECT_EQ(1, columns->getFieldCount());
+  EXPECT_STREQ("", columns->getFieldName(0));
+  EXPECT_EQ(ColumnarStructSet::STRING_COLUMN, columns->getColumnType(0));
+  EXPECT_STREQ("caf\xc3\xa9 \xe2\x82\xac", columns->getString(0, 0));
+
+  auto value =
+      std::dynamic_pointer_cast<CacheableString>(columns->getObject(0, 0));
+  ASSERT_NE(nullptr, value);
+  EXPECT_TRUE(value->isWideString());
+  EXPECT_EQ(0, wcscmp(wide, value->asWChar()));
+}
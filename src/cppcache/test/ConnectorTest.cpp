@@ -0,0 +1,83 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Connector.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+/** Keeps what is sent, accepting at most limit bytes in all. */
+class RecordingConnector : public Connector {
+ public:
+  explicit RecordingConnector(int32_t limit) : m_limit(limit), m_sends(0) {}
+
+  virtual int32_t receive(char *b, int32_t len, uint32_t waitSeconds,
+                          uint32_t waitMicroSeconds) {
+    return 0;
+  }
+
+  virtual int32_t send(const char *b, int32_t len, uint32_t waitSeconds,
+                       uint32_t waitMicroSeconds) {
+    int32_t sent = std::min(len, m_limit - static_cast<int32_t>(m_sent.size()));
+    m_sent.append(b, sent);
+    m_sends++;
+    return sent;
+  }
+
+  virtual void init() {}
+
+  virtual void close() {}
+
+  virtual uint16_t getPort() { return 0; }
+
+  int32_t m_limit;
+  int32_t m_sends;
+  std::string m_sent;
+};
+
+iovec segmentOf(const char *text) {
+  iovec segment;
+  segment.iov_base = const_cast<char *>(text);
+  segment.iov_len = std::char_traits<char>::length(text);
+  return segment;
+}
+}  // namespace
+
+TEST(ConnectorTest, SendvWritesEachBufferInOrder) {
+  RecordingConnector connector(100);
+  iovec segments[] = {segmentOf("header"), segmentOf("value"),
+                      segmentOf("tail")};
+
+  EXPECT_EQ(15, connector.sendv(segments, 3, 1, 0));
+  EXPECT_EQ("headervaluetail", connector.m_sent);
+  EXPECT_EQ(3, connector.m_sends);
+}
+
+TEST(ConnectorTest, SendvStopsAtAShortWrite) {
+  RecordingConnector connector(8);
+  iovec segments[] = {segmentOf("header"), segmentOf("value"),
+                      segmentOf("tail")};
+
+  // the caller sees how far the message got, as with send
+  EXPECT_EQ(8, connector.sendv(segments, 3, 1, 0));
+  EXPECT_EQ("headerva", connector.m_sent);
+  EXPECT_EQ(2, connector.m_sends);
+}
@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "DataOutputBufferPool.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+uint8_t* newBuffer(uint32_t size) {
+  return static_cast<uint8_t*>(std::malloc(size));
+}
+
+// Checks out everything the pool holds so that tests start out empty.
+void drainPool() {
+  uint32_t size;
+  while (uint8_t* buffer = DataOutputBufferPool::checkout(&size)) {
+    std::free(buffer);
+  }
+}
+}  // namespace
+
+TEST(DataOutputBufferPoolTest, EmptyPoolReportsMiss) {
+  drainPool();
+  int64_t misses = DataOutputBufferPool::getMisses();
+  uint32_t size = 0;
+  EXPECT_EQ(nullptr, DataOutputBufferPool::checkout(&size));
+  EXPECT_EQ(misses + 1, DataOutputBufferPool::getMisses());
+  EXPECT_EQ(0, DataOutputBufferPool::getBytesHeld());
+}
+
+TEST(DataOutputBufferPoolTest, ReusesBufferOnSameThread) {
+  drainPool();
+  int64_t hits = DataOutputBufferPool::getHits();
+  uint8_t* buffer = newBuffer(DataOutputBufferPool::MIN_BUFFER_SIZE);
+  DataOutputBufferPool::checkin(buffer, DataOutputBufferPool::MIN_BUFFER_SIZE);
+  EXPECT_EQ(DataOutputBufferPool::MIN_BUFFER_SIZE,
+            DataOutputBufferPool::getBytesHeld());
+
+  uint32_t size = 0;
+  EXPECT_EQ(buffer, DataOutputBufferPool::checkout(&size));
+  EXPECT_EQ(DataOutputBufferPool::MIN_BUFFER_SIZE, size);
+  EXPECT_EQ(hits + 1, DataOutputBufferPool::getHits());
+  EXPECT_EQ(0, DataOutputBufferPool::getBytesHeld());
+  std::free(buffer);
+}
+
+TEST(DataOutputBufferPoolTest, ReusesBuffersReturnedByOtherThreads) {
+  drainPool();
+  const size_t count = DataOutputBufferPool::MAGAZINE_SIZE + 2;
+  const uint32_t grownSize = 64 * 1024;
+  std::vector<uint8_t*> buffers;
+  for (size_t i = 0; i < count; i++) {
+    buffers.push_back(newBuffer(grownSize));
+  }
+  std::thread consumer([&buffers, grownSize]() {
+    for (size_t i = 0; i < buffers.size(); i++) {
+      DataOutputBufferPool::checkin(buffers[i], grownSize);
+    }
+  });
+  consumer.join();
+  EXPECT_EQ(static_cast<int64_t>(count * grownSize),
+            DataOutputBufferPool::getBytesHeld());
+
+  for (size_t i = 0; i < count; i++) {
+    uint32_t size = 0;
+    uint8_t* buffer = DataOutputBufferPool::checkout(&size);
+    ASSERT_NE(nullptr, buffer) << "Buffers of an exited thread are shared";
+    EXPECT_EQ(grownSize, size);
+    std::free(buffer);
+  }
+  EXPECT_EQ(0, DataOutputBufferPool::getBytesHeld());
+}
+
+TEST(DataOutputBufferPoolTest, HeldBytesAreBounded) {
+  drainPool();
+  const uint32_t bigSize = 8 * 1024 * 1024;
+  const size_t count = DataOutputBufferPool::MAX_POOLED_BYTES / bigSize + 1;
+  int64_t discards = DataOutputBufferPool::getDiscards();
+  for (size_t i = 0; i < count; i++) {
+    DataOutputBufferPool::checkin(newBuffer(bigSize), bigSize);
+  }
+  EXPECT_EQ(static_cast<int64_t>(DataOutputBufferPool::MAX_POOLED_BYTES),
+            DataOutputBufferPool::getBytesHeld());
+  EXPECT_EQ(discards + 1, DataOutputBufferPool::getDiscards());
+  DataOutputBufferPool::clear();
+  EXPECT_EQ(0, DataOutputBufferPool::getBytesHeld());
+}
@@ -0,0 +1,152 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "EventBatch.hpp"
+#include "EventIdMap.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+char memberId[] = "member";
+
+EventIdPtr eventId(int64_t seqNum) {
+  return EventId::create(memberId, sizeof(memberId), 1, seqNum);
+}
+
+BatchCacheListener::EventPtr event(int32_t key) {
+  return std::make_shared<BatchCacheListener::Event>(
+      BatchCacheListener::UPDATE, nullptr, CacheableInt32::create(key),
+      nullptr, CacheableInt32::create(key), nullptr, true);
+}
+
+// the redundancy manager's bookkeeping for a notification of a region
+// with a BatchCacheListener, whose ack is held until it is processed
+void receive(EventIdMap& map, const EventIdPtr& id) {
+  EventIdMapEntry entry = EventIdMap::make(id);
+  EXPECT_TRUE(map.put(entry.first, entry.second, true, true));
+}
+
+void release(EventIdMap& map, const EventIdPtr& id) {
+  EventIdMapEntry entry = EventIdMap::make(id);
+  map.release(entry.first, entry.second->getSeqNum());
+}
+
+void release(EventIdMap& map, const std::vector<EventIdPtr>& ids) {
+  for (const auto& id : ids) {
+    release(map, id);
+  }
+}
+
+// the sequence number the periodic ack sends, -1 for no ack
+int64_t periodicAck(EventIdMap& map) {
+  EventIdMapEntryList entries = map.getUnAcked();
+  EXPECT_GE(1U, entries.size());
+  return entries.empty() ? -1 : entries[0].second->getSeqNum();
+}
+}  // namespace
+
+TEST(EventBatchTest, TakesEventsWithTheIdsOfTheirHeldNotifications) {
+  EventBatch batch;
+  EXPECT_EQ(1U, batch.add(event(1), eventId(1)));
+  // an event of a local operation holds no ack
+  EXPECT_EQ(2U, batch.add(event(2), nullptr));
+
+  std::vector<BatchCacheListener::EventPtr> events;
+  std::vector<EventIdPtr> ids;
+  ASSERT_TRUE(batch.take(events, ids));
+  EXPECT_EQ(2U, events.size());
+  ASSERT_EQ(1U, ids.size());
+  EXPECT_EQ(1, ids[0]->getSeqNum());
+
+  EXPECT_FALSE(batch.take(events, ids));
+  EXPECT_EQ(1U, batch.add(event(3), nullptr));
+}
+
+TEST(EventBatchTest, AcksUpToTheFirstUndeliveredEvent) {
+  EventIdMap map;
+  map.init(60);
+  EventBatch batch;
+
+  receive(map, eventId(10));
+  batch.add(event(1), eventId(10));
+  // processed without going to the batch, a region destroy for one
+  receive(map, eventId(11));
+  release(map, eventId(11));
+  EXPECT_EQ(9, periodicAck(map));
+
+  receive(map, eventId(12));
+  batch.add(event(2), eventId(12));
+  EXPECT_EQ(-1, periodicAck(map));
+
+  // delivered by afterEvents
+  std::vector<BatchCacheListener::EventPtr> events;
+  std::vector<EventIdPtr> ids;
+  ASSERT_TRUE(batch.take(events, ids));
+  EXPECT_EQ(2U, events.size());
+  release(map, ids);
+  EXPECT_EQ(12, periodicAck(map));
+  EXPECT_EQ(-1, periodicAck(map));
+}
+
+TEST(EventBatchTest, LaterEventsAreAckedWhileABatchIsPending) {
+  EventIdMap map;
+  map.init(60);
+  EventBatch batch;
+
+  receive(map, eventId(1));
+  release(map, eventId(1));
+  receive(map, eventId(2));
+  batch.add(event(1), eventId(2));
+  for (int64_t seqNum = 3; seqNum < 6; ++seqNum) {
+    receive(map, eventId(seqNum));
+    release(map, eventId(seqNum));
+  }
+  EXPECT_EQ(1, periodicAck(map));
+
+  std::vector<BatchCacheListener::EventPtr> events;
+  std::vector<EventIdPtr> ids;
+  ASSERT_TRUE(batch.take(events, ids));
+  release(map, ids);
+  EXPECT_EQ(5, periodicAck(map));
+}
+
+TEST(EventBatchTest, DiscardedBatchReleasesItsAcks) {
+  EventIdMap map;
+  map.init(60);
+  EventBatch batch;
+
+  receive(map, eventId(1));
+  release(map, eventId(1));
+  receive(map, eventId(2));
+  batch.add(event(1), eventId(2));
+  receive(map, eventId(3));
+  batch.add(event(2), eventId(3));
+  EXPECT_EQ(1, periodicAck(map));
+
+  // what the region does when it is released without callbacks
+  std::vector<BatchCacheListener::EventPtr> events;
+  std::vector<EventIdPtr> ids;
+  ASSERT_TRUE(batch.take(events, ids));
+  events.clear();
+  release(map, ids);
+  EXPECT_EQ(3, periodicAck(map));
+}
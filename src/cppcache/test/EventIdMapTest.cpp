@@ -0,0 +1,117 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "EventIdMap.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+const char memberId[] = "member";
+
+EventSourcePtr source(int64_t threadId) {
+  return std::make_shared<EventSource>(memberId, sizeof(memberId), threadId);
+}
+
+EventSequencePtr sequence(int64_t seqNum) {
+  return std::make_shared<EventSequence>(seqNum);
+}
+}  // namespace
+
+TEST(EventIdMapTest, UnAckedEntriesAreAckedOnce) {
+  EventIdMap map;
+  map.init(60);
+  EXPECT_TRUE(map.put(source(1), sequence(1), true));
+  EXPECT_FALSE(map.put(source(1), sequence(1), true));
+
+  EventIdMapEntryList entries = map.getUnAcked();
+  ASSERT_EQ(1U, entries.size());
+  EXPECT_EQ(1, entries[0].second->getSeqNum());
+  EXPECT_TRUE(map.getUnAcked().empty());
+}
+
+TEST(EventIdMapTest, HeldSourceIsAckedUpToItsFirstHeldEvent) {
+  EventIdMap map;
+  map.init(60);
+  // an event of a pending batch and a later event of the same source
+  EXPECT_TRUE(map.put(source(1), sequence(1), true, true));
+  EXPECT_TRUE(map.put(source(1), sequence(2), true));
+  EXPECT_TRUE(map.put(source(2), sequence(1), true));
+
+  // the ack of the later event would ack the held one as well
+  EventIdMapEntryList entries = map.getUnAcked();
+  ASSERT_EQ(2U, entries.size());
+  for (const auto& entry : entries) {
+    if (*entry.first == *source(1)) {
+      EXPECT_EQ(0, entry.second->getSeqNum());
+    } else {
+      EXPECT_EQ(1, entry.second->getSeqNum());
+    }
+  }
+  EXPECT_TRUE(map.getUnAcked().empty());
+
+  // delivered by afterEvents
+  map.release(source(1), 1);
+  entries = map.getUnAcked();
+  ASSERT_EQ(1U, entries.size());
+  EXPECT_EQ(*source(1), *entries[0].first);
+  EXPECT_EQ(2, entries[0].second->getSeqNum());
+}
+
+TEST(EventIdMapTest, AckAdvancesAsHeldEventsAreReleased) {
+  EventIdMap map;
+  map.init(60);
+  EXPECT_TRUE(map.put(source(1), sequence(1), true, true));
+  EXPECT_TRUE(map.put(source(1), sequence(2), true, true));
+  EXPECT_TRUE(map.put(source(1), sequence(3), true, true));
+  // a duplicate is not put and takes no hold
+  EXPECT_FALSE(map.put(source(1), sequence(3), true, true));
+  EXPECT_TRUE(map.put(source(1), sequence(4), true));
+
+  map.release(source(1), 2);
+  EventIdMapEntryList entries = map.getUnAcked();
+  ASSERT_EQ(1U, entries.size());
+  EXPECT_EQ(0, entries[0].second->getSeqNum());
+
+  map.release(source(1), 1);
+  entries = map.getUnAcked();
+  ASSERT_EQ(1U, entries.size());
+  EXPECT_EQ(2, entries[0].second->getSeqNum());
+
+  map.release(source(1), 3);
+  entries = map.getUnAcked();
+  ASSERT_EQ(1U, entries.size());
+  EXPECT_EQ(4, entries[0].second->getSeqNum());
+  EXPECT_TRUE(map.getUnAcked().empty());
+}
+
+TEST(EventIdMapTest, FailedAckOfHeldSourceIsSentAgain) {
+  EventIdMap map;
+  map.init(60);
+  EXPECT_TRUE(map.put(source(1), sequence(1), true));
+  EXPECT_TRUE(map.put(source(1), sequence(2), true, true));
+
+  EventIdMapEntryList entries = map.getUnAcked();
+  ASSERT_EQ(1U, entries.size());
+  EXPECT_EQ(1, entries[0].second->getSeqNum());
+
+  EXPECT_EQ(1U, map.clearAckedFlags(entries));
+  entries = map.getUnAcked();
+  ASSERT_EQ(1U, entries.size());
+  EXPECT_EQ(1, entries[0].second->getSeqNum());
+}
@@ -0,0 +1,104 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "ExpiryTaskManager.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+/** Blocks in handle_timeout until released, and records its deletion. */
+class BlockingHandler : public ACE_Event_Handler {
+ public:
+  explicit BlockingHandler(std::atomic<bool>& deleted)
+      : m_deleted(deleted), m_firing(false), m_released(false) {}
+
+  virtual ~BlockingHandler() { m_deleted = true; }
+
+  virtual int handle_timeout(const ACE_Time_Value&, const void*) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_firing = true;
+    m_cond.notify_all();
+    m_cond.wait(lock, [this] { return m_released; });
+    return 0;
+  }
+
+  bool waitUntilFiring() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_cond.wait_for(lock, std::chrono::seconds(10),
+                           [this] { return m_firing; });
+  }
+
+  void release() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_released = true;
+    m_cond.notify_all();
+  }
+
+ private:
+  std::atomic<bool>& m_deleted;
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  bool m_firing;
+  bool m_released;
+};
+
+bool waitFor(const std::atomic<bool>& flag) {
+  for (int i = 0; i < 1000 && !flag; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return flag;
+}
+}  // namespace
+
+TEST(ExpiryTaskManagerTest, CancelledWheelTaskKeepsItsHandler) {
+  ExpiryTaskManager manager;
+  manager.begin();
+  std::atomic<bool> deleted(false);
+  auto handler = new BlockingHandler(deleted);
+  auto id = manager.scheduleWheelExpiryTask(handler, 60);
+
+  EXPECT_EQ(0, manager.cancelTask(id));
+  EXPECT_FALSE(deleted);
+  EXPECT_EQ(-1, manager.cancelTask(id));
+  manager.stopExpiryTaskManager();
+  // the caller owns the handler of a task it cancelled
+  EXPECT_FALSE(deleted);
+  delete handler;
+}
+
+TEST(ExpiryTaskManagerTest, TaskCancelledWhileFiringFreesItsHandler) {
+  ExpiryTaskManager manager;
+  manager.begin();
+  std::atomic<bool> deleted(false);
+  auto handler = new BlockingHandler(deleted);
+  auto id = manager.scheduleWheelExpiryTask(handler, 0);
+  ASSERT_TRUE(handler->waitUntilFiring());
+
+  // the handler is still running, so the caller does not get to delete it
+  EXPECT_EQ(-1, manager.cancelTask(id));
+  EXPECT_FALSE(deleted);
+  handler->release();
+  EXPECT_TRUE(waitFor(deleted));
+  manager.stopExpiryTaskManager();
+}
@@ -0,0 +1,70 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "FrequencySketch.hpp"
+
+using namespace apache::geode::client;
+
+TEST(FrequencySketchTest, CountsAccesses) {
+  FrequencySketch sketch(1000);
+  EXPECT_EQ(0U, sketch.frequency(42));
+  for (int i = 0; i < 5; ++i) {
+    sketch.increment(42);
+  }
+  EXPECT_EQ(5U, sketch.frequency(42));
+}
+
+TEST(FrequencySketchTest, SaturatesAtFifteen) {
+  FrequencySketch sketch(1000);
+  for (int i = 0; i < 100; ++i) {
+    sketch.increment(7);
+  }
+  EXPECT_EQ(15U, sketch.frequency(7));
+}
+
+TEST(FrequencySketchTest, HotKeysStandOutFromAScan) {
+  FrequencySketch sketch(512);
+  for (uint32_t round = 0; round < 4; ++round) {
+    for (uint32_t hot = 0; hot < 32; ++hot) {
+      sketch.increment(hot);
+    }
+  }
+  for (uint32_t cold = 1000; cold < 1500; ++cold) {
+    sketch.increment(cold);
+  }
+  uint32_t hotter = 0;
+  for (uint32_t hot = 0; hot < 32; ++hot) {
+    if (sketch.frequency(hot) > sketch.frequency(1000 + hot)) {
+      ++hotter;
+    }
+  }
+  EXPECT_GE(hotter, 30U);
+}
+
+TEST(FrequencySketchTest, AgesCounters) {
+  FrequencySketch sketch(64);
+  for (int i = 0; i < 8; ++i) {
+    sketch.increment(3);
+  }
+  EXPECT_EQ(8U, sketch.frequency(3));
+  // enough other accesses to trigger halving
+  for (uint32_t key = 100; key < 100 + 640; ++key) {
+    sketch.increment(key);
+  }
+  EXPECT_LE(sketch.frequency(3), 4U);
+}
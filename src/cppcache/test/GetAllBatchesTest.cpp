@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "GetAllBatches.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+VectorOfCacheableKeyPtr keysUpTo(int32_t count) {
+  auto keys = std::make_shared<VectorOfCacheableKey>();
+  for (int32_t key = 0; key < count; ++key) {
+    keys->push_back(CacheableInt32::create(key));
+  }
+  return keys;
+}
+
+int32_t keyAt(const VectorOfCacheableKeyPtr& keys, size_t index) {
+  return std::static_pointer_cast<CacheableInt32>(keys->at(index))->value();
+}
+}  // namespace
+
+TEST(GetAllBatchesTest, UnsetBatchSizeKeepsOneBatch) {
+  auto keys = keysUpTo(5);
+  auto batches = splitGetAllBatches(keys, 0);
+  ASSERT_EQ(1U, batches.size());
+  EXPECT_EQ(keys, batches[0]);
+}
+
+TEST(GetAllBatchesTest, SplitsKeysInOrder) {
+  auto keys = keysUpTo(5);
+  auto batches = splitGetAllBatches(keys, 2);
+  ASSERT_EQ(3U, batches.size());
+  EXPECT_EQ(2U, batches[0]->size());
+  EXPECT_EQ(2U, batches[1]->size());
+  ASSERT_EQ(1U, batches[2]->size());
+  EXPECT_EQ(0, keyAt(batches[0], 0));
+  EXPECT_EQ(3, keyAt(batches[1], 1));
+  EXPECT_EQ(4, keyAt(batches[2], 0));
+}
+
+TEST(GetAllBatchesTest, BatchSizeOfAllKeysKeepsOneBatch) {
+  auto keys = keysUpTo(5);
+  auto batches = splitGetAllBatches(keys, 5);
+  ASSERT_EQ(1U, batches.size());
+  EXPECT_EQ(keys, batches[0]);
+}
+
+TEST(GetAllBatchesTest, BatchSizeAboveKeyCountKeepsOneBatch) {
+  auto keys = keysUpTo(5);
+  auto batches = splitGetAllBatches(keys, 6);
+  ASSERT_EQ(1U, batches.size());
+  EXPECT_EQ(keys, batches[0]);
+}
+
+TEST(GetAllBatchesTest, BatchSizeBelowKeyCountLeavesOneKeyOver) {
+  auto keys = keysUpTo(5);
+  auto batches = splitGetAllBatches(keys, 4);
+  ASSERT_EQ(2U, batches.size());
+  ASSERT_EQ(4U, batches[0]->size());
+  ASSERT_EQ(1U, batches[1]->size());
+  for (size_t index = 0; index < 4; ++index) {
+    EXPECT_EQ(static_cast<int32_t>(index), keyAt(batches[0], index));
+  }
+  EXPECT_EQ(4, keyAt(batches[1], 0));
+}
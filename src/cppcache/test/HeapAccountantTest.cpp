@@ -0,0 +1,64 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "HeapAccountant.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+int64_t allocated = 0;
+
+int64_t sampleAllocated() { return allocated; }
+}  // namespace
+
+TEST(HeapAccountantTest, ObjectSizeTakesReportedSize) {
+  ObjectSizeAccountant accountant;
+  EXPECT_EQ(1234, accountant.heapSize(1234));
+  EXPECT_FALSE(accountant.samples());
+}
+
+TEST(HeapAccountantTest, AllocatorMeasuresGrowthSinceCreation) {
+  allocated = 1000;
+  AllocatorAccountant accountant(sampleAllocated,
+                                 AllocatorAccountant::Clock::duration(0));
+  // values take four times what they report
+  allocated += 400;
+  EXPECT_EQ(400, accountant.heapSize(100));
+  allocated += 40;
+  EXPECT_EQ(440, accountant.heapSize(110));
+}
+
+TEST(HeapAccountantTest, AllocatorAddsReportedChangesBetweenSamples) {
+  allocated = 0;
+  AllocatorAccountant accountant(sampleAllocated, std::chrono::hours(1));
+  allocated = 5000;
+  // not sampled yet, so the reported size is all there is
+  EXPECT_EQ(100, accountant.heapSize(100));
+  EXPECT_EQ(0, accountant.heapSize(-50));
+}
+
+TEST(HeapAccountantTest, AllocatorStartsOverWhenNothingIsReported) {
+  allocated = 1000;
+  AllocatorAccountant accountant(sampleAllocated,
+                                 AllocatorAccountant::Clock::duration(0));
+  // memory allocated while the regions are empty is not theirs
+  allocated = 3000;
+  EXPECT_EQ(0, accountant.heapSize(0));
+  allocated = 3500;
+  EXPECT_EQ(500, accountant.heapSize(200));
+}
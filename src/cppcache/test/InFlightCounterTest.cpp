@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "InFlightCounter.hpp"
+
+using namespace apache::geode::client;
+
+TEST(InFlightCounterTest, WaitReturnsWhenNothingInFlight) {
+  InFlightCounter counter;
+  counter.waitForNone();
+  counter.started();
+  counter.completed();
+  counter.waitForNone();
+  EXPECT_EQ(0, counter.count());
+}
+
+TEST(InFlightCounterTest, WaitBlocksUntilLastCompletion) {
+  InFlightCounter counter;
+  counter.started();
+  counter.started();
+  std::atomic<bool> waited(false);
+  std::thread waiter([&] {
+    counter.waitForNone();
+    waited = true;
+  });
+
+  counter.completed();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(waited);
+  EXPECT_EQ(1, counter.count());
+
+  counter.completed();
+  waiter.join();
+  EXPECT_TRUE(waited);
+}
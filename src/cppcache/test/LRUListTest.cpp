@@ -0,0 +1,101 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "LRUList.cpp"
+#include "LRUMapEntry.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+MapEntryImplPtr newEntry(int32_t key) {
+  LRUEntryFactory factory;
+  factory.setConcurrencyChecksEnabled(false);
+  MapEntryImplPtr entry;
+  factory.newMapEntry(CacheableInt32::create(key), entry);
+  return entry;
+}
+}  // namespace
+
+TEST(LRUListTest, ReturnsEntriesInOrder) {
+  LRUList<MapEntryImpl> list;
+  MapEntryImplPtr first = newEntry(1);
+  MapEntryImplPtr second = newEntry(2);
+  list.appendEntry(first);
+  list.appendEntry(second);
+
+  MapEntryImplPtr result;
+  list.getLRUEntry(result);
+  EXPECT_EQ(first, result);
+  list.getLRUEntry(result);
+  EXPECT_EQ(second, result);
+  list.getLRUEntry(result);
+  EXPECT_EQ(nullptr, result);
+}
+
+TEST(LRUListTest, NeverReturnsExcludedEntry) {
+  LRUList<MapEntryImpl> list;
+  MapEntryImplPtr added = newEntry(1);
+  MapEntryImplPtr older = newEntry(2);
+  list.appendEntry(added);
+  list.appendEntry(older);
+
+  MapEntryImplPtr result;
+  list.getLRUEntry(result, added.get());
+  EXPECT_EQ(older, result);
+  list.getLRUEntry(result, added.get());
+  EXPECT_EQ(nullptr, result);
+
+  // the excluded entry stays on the list
+  list.getLRUEntry(result);
+  EXPECT_EQ(added, result);
+}
+
+TEST(LRUListTest, RecentlyUsedEntryGoesBehindExcludedEntry) {
+  LRUList<MapEntryImpl> list;
+  MapEntryImplPtr used = newEntry(1);
+  MapEntryImplPtr added = newEntry(2);
+  list.appendEntry(used);
+  list.appendEntry(added);
+  used->getLRUProperties().setRecentlyUsed();
+
+  MapEntryImplPtr result;
+  list.getLRUEntry(result, added.get());
+  EXPECT_EQ(used, result);
+  EXPECT_FALSE(used->getLRUProperties().testRecentlyUsed());
+}
+
+TEST(LRUListTest, DropsEvictedEntries) {
+  LRUList<MapEntryImpl> list;
+  MapEntryImplPtr evicted1 = newEntry(1);
+  MapEntryImplPtr evicted2 = newEntry(2);
+  MapEntryImplPtr live = newEntry(3);
+  list.appendEntry(evicted1);
+  list.appendEntry(evicted2);
+  list.appendEntry(live);
+  evicted1->getLRUProperties().setEvicted();
+  evicted2->getLRUProperties().setEvicted();
+
+  MapEntryImplPtr result;
+  list.getLRUEntry(result);
+  EXPECT_EQ(live, result);
+  // the list let go of every dropped entry, not just the last one
+  EXPECT_EQ(1, evicted1.use_count());
+  EXPECT_EQ(1, evicted2.use_count());
+}
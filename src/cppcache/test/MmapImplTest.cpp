@@ -0,0 +1,129 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Properties.hpp>
+
+#include "../../mmapimpl/MmapImpl.cpp"
+#include "../../mmapimpl/MmapSegment.cpp"
+#include "SerializationRegistry.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+class MmapImplTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    SerializationRegistry::init();
+    m_properties = Properties::create();
+    m_properties->insert(PERSISTENCE_DIR, "MmapImplTestData");
+    // a few values per segment, so that segments roll and get compacted
+    m_properties->insert(SEGMENT_SIZE, 64);
+    m_properties->insert(COMPACTION_THRESHOLD, 50);
+    m_properties->insert(COMPACTION_INTERVAL, 10);
+    m_mmap.init(std::string("MmapImplTest"), m_properties);
+  }
+
+  virtual void TearDown() { m_mmap.close(); }
+
+  static CacheablePtr valueOf(int index) {
+    return CacheableString::create(
+        ("value-" + std::to_string(index)).c_str());
+  }
+
+  static std::string stringOf(const CacheablePtr& value) {
+    auto string = std::dynamic_pointer_cast<CacheableString>(value);
+    return string == nullptr ? "" : string->asChar();
+  }
+
+  static bool segmentFileExists(uint32_t id) {
+    std::ifstream file("MmapImplTestData/MmapImplTest/" + std::to_string(id) +
+                       ".seg");
+    return file.good();
+  }
+
+  static uint32_t segmentOf(void* handle) {
+    return static_cast<MmapRecord*>(handle)->m_segment->getId();
+  }
+
+  PropertiesPtr m_properties;
+  MmapImpl m_mmap;
+};
+}  // namespace
+
+TEST_F(MmapImplTest, ReadsBackWhatItWrites) {
+  void* handle = nullptr;
+  m_mmap.write(nullptr, valueOf(1), handle);
+  ASSERT_NE(nullptr, handle);
+  EXPECT_EQ("value-1", stringOf(m_mmap.read(nullptr, handle)));
+
+  // a rewrite moves the value but keeps the record
+  void* first = handle;
+  m_mmap.write(nullptr, valueOf(2), handle);
+  EXPECT_EQ(first, handle);
+  EXPECT_EQ("value-2", stringOf(m_mmap.read(nullptr, handle)));
+  m_mmap.destroy(nullptr, handle);
+}
+
+TEST_F(MmapImplTest, DestroyReleasesTheRecord) {
+  void* handle = nullptr;
+  m_mmap.write(nullptr, valueOf(1), handle);
+  m_mmap.destroy(nullptr, handle);
+  EXPECT_EQ(nullptr, handle);
+  EXPECT_THROW(m_mmap.read(nullptr, handle), EntryNotFoundException);
+  EXPECT_THROW(m_mmap.destroy(nullptr, handle), EntryNotFoundException);
+
+  // a destroyed entry written again gets a new record
+  m_mmap.write(nullptr, valueOf(2), handle);
+  ASSERT_NE(nullptr, handle);
+  EXPECT_EQ("value-2", stringOf(m_mmap.read(nullptr, handle)));
+  m_mmap.destroy(nullptr, handle);
+}
+
+TEST_F(MmapImplTest, CompactionMovesLiveValuesOutOfDeadSegments) {
+  void* survivor = nullptr;
+  m_mmap.write(nullptr, valueOf(0), survivor);
+  ASSERT_EQ(0U, segmentOf(survivor));
+
+  std::vector<void*> handles(32, nullptr);
+  for (size_t index = 0; index < handles.size(); ++index) {
+    m_mmap.write(nullptr, valueOf(static_cast<int>(index) + 1),
+                 handles[index]);
+  }
+  ASSERT_NE(segmentOf(survivor), segmentOf(handles.back()));
+  for (size_t index = 0; index < handles.size(); ++index) {
+    m_mmap.destroy(nullptr, handles[index]);
+  }
+
+  // the first segment is mostly dead, so its live value is moved out and
+  // the segment file removed
+  for (int i = 0; i < 1000 && segmentFileExists(0); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_FALSE(segmentFileExists(0));
+  EXPECT_EQ("value-0", stringOf(m_mmap.read(nullptr, survivor)));
+  EXPECT_TRUE(m_mmap.readAll());
+  m_mmap.destroy(nullptr, survivor);
+}
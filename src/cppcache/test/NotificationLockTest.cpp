@@ -0,0 +1,128 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "NotificationLock.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+/**
+ * Applies an event on its own thread: acquires the lock for it, and
+ * releases it once the applier goes out of scope.
+ */
+class Applier {
+ public:
+  Applier(NotificationLock& lock, const TcrMessage* msg, bool dispatched)
+      : m_acquired(false), m_done(false), m_thread([=, &lock] {
+          if (msg == nullptr) {
+            lock.acquireExclusive();
+          } else {
+            lock.acquire(*msg, dispatched);
+          }
+          m_acquired = true;
+          while (!m_done) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          }
+          lock.release();
+        }) {}
+
+  ~Applier() {
+    m_done = true;
+    m_thread.join();
+  }
+
+  bool waitUntilAcquired() {
+    for (int i = 0; i < 1000 && !m_acquired; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return m_acquired;
+  }
+
+  bool blocked() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    return !m_acquired;
+  }
+
+ private:
+  std::atomic<bool> m_acquired;
+  std::atomic<bool> m_done;
+  std::thread m_thread;
+};
+
+class NotificationLockTest : public ::testing::Test {
+ protected:
+  NotificationLockTest()
+      : m_keyEvent(nullptr, CacheableInt32::create(1), nullptr, nullptr,
+                   nullptr),
+        m_otherKeyEvent(nullptr, CacheableInt32::create(2), nullptr,
+                        nullptr, nullptr),
+        m_regionEvent(nullptr, nullptr, 1000, nullptr) {}
+
+  NotificationLock m_lock;
+  TcrMessageDestroy m_keyEvent;
+  TcrMessageDestroy m_otherKeyEvent;
+  TcrMessageClearRegion m_regionEvent;
+};
+}  // namespace
+
+TEST_F(NotificationLockTest, DispatchedEventsForKeysAreAppliedConcurrently) {
+  Applier event(m_lock, &m_keyEvent, true);
+  ASSERT_TRUE(event.waitUntilAcquired());
+  Applier other(m_lock, &m_otherKeyEvent, true);
+  EXPECT_TRUE(other.waitUntilAcquired());
+}
+
+TEST_F(NotificationLockTest, RegionEventWaitsForAppliedEvents) {
+  std::unique_ptr<Applier> event(new Applier(m_lock, &m_keyEvent, true));
+  ASSERT_TRUE(event->waitUntilAcquired());
+  // a clear is a barrier even when a worker applies it
+  std::unique_ptr<Applier> clear(new Applier(m_lock, &m_regionEvent, true));
+  EXPECT_TRUE(clear->blocked());
+  event.reset();
+  EXPECT_TRUE(clear->waitUntilAcquired());
+
+  event.reset(new Applier(m_lock, &m_keyEvent, true));
+  EXPECT_TRUE(event->blocked());
+  clear.reset();
+  EXPECT_TRUE(event->waitUntilAcquired());
+}
+
+TEST_F(NotificationLockTest, ReceiverAppliesEventsOneAtATime) {
+  std::unique_ptr<Applier> event(new Applier(m_lock, &m_keyEvent, false));
+  ASSERT_TRUE(event->waitUntilAcquired());
+  Applier other(m_lock, &m_otherKeyEvent, false);
+  EXPECT_TRUE(other.blocked());
+  event.reset();
+  EXPECT_TRUE(other.waitUntilAcquired());
+}
+
+TEST_F(NotificationLockTest, ReleaseWaitsForAppliedEvents) {
+  std::unique_ptr<Applier> event(new Applier(m_lock, &m_keyEvent, true));
+  ASSERT_TRUE(event->waitUntilAcquired());
+  Applier release(m_lock, nullptr, false);
+  EXPECT_TRUE(release.blocked());
+  event.reset();
+  EXPECT_TRUE(release.waitUntilAcquired());
+}
@@ -0,0 +1,138 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdlib>
+#include <functional>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "OpenHashMap.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+typedef OpenHashMap<int, int, std::hash<int>, std::equal_to<int>> IntMap;
+}  // namespace
+
+TEST(OpenHashMapTest, BindFindUnbind) {
+  IntMap map;
+  map.open(10);
+  EXPECT_EQ(0, map.bind(1, 10));
+  EXPECT_EQ(1, map.bind(1, 11));
+  int value = 0;
+  EXPECT_EQ(0, map.find(1, value));
+  EXPECT_EQ(10, value);
+  EXPECT_EQ(-1, map.find(2, value));
+
+  EXPECT_EQ(1, map.rebind(1, 12));
+  EXPECT_EQ(0, map.rebind(2, 20));
+  EXPECT_EQ(2U, map.current_size());
+  EXPECT_EQ(0, map.unbind(1, value));
+  EXPECT_EQ(12, value);
+  EXPECT_EQ(-1, map.unbind(1));
+  EXPECT_EQ(1U, map.current_size());
+}
+
+TEST(OpenHashMapTest, GrowsIncrementally) {
+  IntMap map;
+  map.open(0);
+  size_t capacity = map.capacity();
+  for (int i = 0; i < 1000; ++i) {
+    map.bind(i, i);
+  }
+  EXPECT_GT(map.capacity(), capacity);
+  EXPECT_GT(map.rehashCount(), 0U);
+  for (int i = 0; i < 1000; ++i) {
+    int value = -1;
+    ASSERT_EQ(0, map.find(i, value));
+    EXPECT_EQ(i, value);
+  }
+}
+
+TEST(OpenHashMapTest, IteratesOverBothTablesWhileResizing) {
+  IntMap map;
+  map.open(0);
+  int count = 0;
+  // stop right after a resize has started
+  while (map.rehashCount() < 3) {
+    map.bind(count, count);
+    ++count;
+  }
+  int seen = 0;
+  long sum = 0;
+  for (IntMap::iterator iter = map.begin(); iter != map.end(); ++iter) {
+    ++seen;
+    sum += iter->int_id_;
+    EXPECT_EQ(iter->ext_id_, iter->int_id_);
+  }
+  EXPECT_EQ(count, seen);
+  EXPECT_EQ(static_cast<long>(count) * (count - 1) / 2, sum);
+}
+
+TEST(OpenHashMapTest, CountsBytes) {
+  std::atomic<int64_t> bytes(0);
+  {
+    IntMap map;
+    map.setBytesCounter(&bytes);
+    map.open(100);
+    EXPECT_EQ(static_cast<int64_t>(map.bytes()), bytes.load());
+    for (int i = 0; i < 1000; ++i) {
+      map.bind(i, i);
+    }
+    EXPECT_EQ(static_cast<int64_t>(map.bytes()), bytes.load());
+  }
+  EXPECT_EQ(0, bytes.load());
+}
+
+TEST(OpenHashMapTest, MatchesUnorderedMap) {
+  IntMap map;
+  map.open(0);
+  std::unordered_map<int, int> expected;
+  std::srand(7);
+  for (int i = 0; i < 200000; ++i) {
+    int key = std::rand() % 5000;
+    int value = std::rand();
+    switch (std::rand() % 3) {
+      case 0:
+        EXPECT_EQ(expected.count(key) ? 1 : 0, map.bind(key, value));
+        expected.insert(std::make_pair(key, value));
+        break;
+      case 1:
+        EXPECT_EQ(expected.count(key) ? 1 : 0, map.rebind(key, value));
+        expected[key] = value;
+        break;
+      default: {
+        int removed = 0;
+        int status = map.unbind(key, removed);
+        auto pos = expected.find(key);
+        if (pos == expected.end()) {
+          EXPECT_EQ(-1, status);
+        } else {
+          EXPECT_EQ(0, status);
+          EXPECT_EQ(pos->second, removed);
+          expected.erase(pos);
+        }
+      }
+    }
+    ASSERT_EQ(expected.size(), map.current_size());
+  }
+  for (const auto& entry : expected) {
+    int value = 0;
+    ASSERT_EQ(0, map.find(entry.first, value));
+    EXPECT_EQ(entry.second, value);
+  }
+}
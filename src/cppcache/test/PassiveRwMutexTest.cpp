@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "util/concurrent/passive_rw_mutex.hpp"
+
+using apache::geode::util::concurrent::passive_rw_mutex;
+using apache::geode::util::concurrent::shared_lock_guard;
+
+TEST(PassiveRwMutexTest, ReadersSeeWholeWrites) {
+  passive_rw_mutex mutex;
+  volatile int64_t first = 0;
+  volatile int64_t second = 0;
+  std::atomic<bool> done(false);
+  std::atomic<int> torn(0);
+
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.push_back(std::thread([&]() {
+      while (!done) {
+        shared_lock_guard<passive_rw_mutex> guard(mutex);
+        if (first != second) {
+          ++torn;
+        }
+      }
+    }));
+  }
+  for (int i = 0; i < 20000; ++i) {
+    std::lock_guard<passive_rw_mutex> guard(mutex);
+    first = first + 1;
+    std::this_thread::yield();
+    second = second + 1;
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(0, torn.load());
+  EXPECT_EQ(20000, first);
+}
+
+TEST(PassiveRwMutexTest, NestedReadsOfDifferentMutexes) {
+  passive_rw_mutex outer;
+  passive_rw_mutex inner;
+  {
+    shared_lock_guard<passive_rw_mutex> outerGuard(outer);
+    shared_lock_guard<passive_rw_mutex> innerGuard(inner);
+  }
+  // both must be free for writers again
+  std::lock_guard<passive_rw_mutex> outerGuard(outer);
+  std::lock_guard<passive_rw_mutex> innerGuard(inner);
+}
+
+TEST(PassiveRwMutexTest, ReusesSlotsOfExitedThreads) {
+  passive_rw_mutex mutex;
+  for (size_t i = 0; i < passive_rw_mutex::MAX_READERS + 16; ++i) {
+    std::thread reader([&]() {
+      shared_lock_guard<passive_rw_mutex> guard(mutex);
+    });
+    reader.join();
+  }
+  std::lock_guard<passive_rw_mutex> guard(mutex);
+}
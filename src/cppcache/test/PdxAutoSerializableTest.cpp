@@ -0,0 +1,183 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <geode/PdxAutoSerializable.hpp>
+#include <PdxHelper.hpp>
+#include <PdxLocalReader.hpp>
+#include <PdxLocalWriter.hpp>
+#include <PdxType.hpp>
+#include <PdxTypeRegistry.hpp>
+#include <PdxWriterWithTypeCollector.hpp>
+
+using namespace apache::geode::client;
+
+namespace {
+class AutoPdx : public PdxAutoSerializable<AutoPdx> {
+ public:
+  AutoPdx()
+      : m_id(0), m_price(0), m_active(false), m_code(0), m_count(0),
+        m_ratio(0), m_small(0) {}
+
+  template <typename Fields>
+  void pdxFields(Fields& fields) {
+    fields("id", m_id)("name", m_name)("price", m_price)("active", m_active)(
+        "code", m_code)("count", m_count)("ratio", m_ratio)(
+        "comment", m_comment)("small", m_small);
+  }
+
+  virtual const char* getClassName() const { return "AutoPdx"; }
+
+  int32_t m_id;
+  std::string m_name;
+  double m_price;
+  bool m_active;
+  int8_t m_code;
+  int64_t m_count;
+  float m_ratio;
+  std::string m_comment;
+  int16_t m_small;
+};
+
+AutoPdx makeObject(const std::string& comment) {
+  AutoPdx object;
+  object.m_id = 42;
+  object.m_name = "the_name";
+  object.m_price = 9.75;
+  object.m_active = true;
+  object.m_code = -3;
+  object.m_count = 1LL << 40;
+  object.m_ratio = 0.5f;
+  object.m_comment = comment;
+  object.m_small = 1234;
+  return object;
+}
+
+PdxTypePtr collectType(AutoPdx& object) {
+  PdxTypeRegistry::init();
+  DataOutput stream;
+  auto collector =
+      std::make_shared<PdxWriterWithTypeCollector>(stream, "AutoPdx");
+  object.toData(collector);
+  collector->endObjectWriting();
+  PdxTypePtr pdxType = collector->getPdxLocalType();
+  pdxType->InitializeType();
+  pdxType->setTypeId(7);
+  return pdxType;
+}
+
+// Compares writeAutoSerializable with PdxLocalWriter for the object.
+void expectSameBytes(AutoPdx& object) {
+  PdxTypePtr pdxType = collectType(object);
+  EXPECT_EQ(pdxType->getTotalFields(), object.getPdxFieldCount());
+  EXPECT_EQ(pdxType->getNumberOfVarLenFields(),
+            object.getPdxVariableLengthFieldCount());
+
+  DataOutput expected;
+  auto writer = std::make_shared<PdxLocalWriter>(expected, pdxType);
+  object.toData(writer);
+  writer->endObjectWriting();
+
+  DataOutput actual;
+  EXPECT_EQ(0, PdxHelper::writeAutoSerializable(actual, object, 7));
+
+  ASSERT_EQ(expected.getBufferLength(), actual.getBufferLength());
+  EXPECT_EQ(0, std::memcmp(expected.getBuffer(), actual.getBuffer(),
+                           actual.getBufferLength()));
+}
+}  // namespace
+
+TEST(PdxAutoSerializableTest, countsFields) {
+  AutoPdx object;
+  EXPECT_EQ(9, object.getPdxFieldCount());
+  EXPECT_EQ(2, object.getPdxVariableLengthFieldCount());
+}
+
+TEST(PdxAutoSerializableTest, writesSameBytesAsPdxLocalWriter) {
+  AutoPdx object = makeObject("short");
+  expectSameBytes(object);
+}
+
+TEST(PdxAutoSerializableTest, writesSameOffsetsForLongerObjects) {
+  // two byte offsets
+  AutoPdx object = makeObject(std::string(300, 'x'));
+  expectSameBytes(object);
+}
+
+TEST(PdxAutoSerializableTest, readsWhatItWrites) {
+  AutoPdx expected = makeObject("the_comment");
+  DataOutput stream;
+  PdxHelper::writeAutoSerializable(stream, expected, 7);
+
+  uint32_t length = 0;
+  const uint8_t* buffer = stream.getBuffer(&length);
+  DataInput input(buffer, length);
+  input.advanceCursor(PdxHelper::PdxHeader);
+  AutoPdx actual;
+  actual.readPdxFields(input);
+
+  EXPECT_EQ(expected.m_id, actual.m_id);
+  EXPECT_EQ(expected.m_name, actual.m_name);
+  EXPECT_EQ(expected.m_price, actual.m_price);
+  EXPECT_EQ(expected.m_active, actual.m_active);
+  EXPECT_EQ(expected.m_code, actual.m_code);
+  EXPECT_EQ(expected.m_count, actual.m_count);
+  EXPECT_EQ(expected.m_ratio, actual.m_ratio);
+  EXPECT_EQ(expected.m_comment, actual.m_comment);
+  EXPECT_EQ(expected.m_small, actual.m_small);
+}
+
+TEST(PdxAutoSerializableTest, readsEmptyStringsWhatItWrites) {
+  AutoPdx expected = makeObject("");
+  expected.m_name = "";
+  DataOutput stream;
+  PdxHelper::writeAutoSerializable(stream, expected, 7);
+
+  uint32_t length = 0;
+  const uint8_t* buffer = stream.getBuffer(&length);
+  DataInput input(buffer, length);
+  input.advanceCursor(PdxHelper::PdxHeader);
+  AutoPdx actual = makeObject("not_empty");
+  actual.readPdxFields(input);
+
+  EXPECT_EQ("", actual.m_name);
+  EXPECT_EQ("", actual.m_comment);
+  EXPECT_EQ(expected.m_small, actual.m_small);
+}
+
+TEST(PdxAutoSerializableTest, readsEmptyStringsThroughPdxReader) {
+  AutoPdx expected = makeObject("");
+  PdxTypePtr pdxType = collectType(expected);
+  DataOutput stream;
+  auto writer = std::make_shared<PdxLocalWriter>(stream, pdxType);
+  expected.toData(writer);
+  writer->endObjectWriting();
+  int length = 0;
+  uint8_t* buffer = writer->getPdxStream(length);
+
+  DataInput input(buffer, length);
+  auto reader = std::make_shared<PdxLocalReader>(input, pdxType, length);
+  AutoPdx actual = makeObject("not_empty");
+  actual.fromData(reader);
+
+  EXPECT_EQ(expected.m_name, actual.m_name);
+  EXPECT_EQ("", actual.m_comment);
+  EXPECT_EQ(expected.m_small, actual.m_small);
+}
@@ -0,0 +1,147 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "PdxInstanceImpl.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+const int32_t TypeId = 0x7e57;
+
+class PdxInstanceImplTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    PdxTypeRegistry::init();
+    DataOutput output;
+    auto writer =
+        std::make_shared<PdxWriterWithTypeCollector>(output, "Customer");
+    writer->writeInt("id", 7);
+    writer->writeString("name", "a name");
+    writer->writeString("city", "a city");
+    // a fixed length field after the variable length ones is found through
+    // the offset table
+    writer->writeLong("count", 42);
+    writer->endObjectWriting();
+
+    m_pdxType = writer->getPdxLocalType();
+    m_pdxType->setTypeId(TypeId);
+    m_pdxType->InitializeType();
+    PdxTypeRegistry::addPdxType(TypeId, m_pdxType);
+
+    int length = 0;
+    uint8_t* stream = writer->getPdxStream(length);
+    m_instance.reset(new PdxInstanceImpl(stream, length, TypeId));
+    delete[] stream;
+  }
+
+  static std::string stringOf(char* value) {
+    std::string result = value == nullptr ? "" : value;
+    DataInput::freeUTFMemory(value);
+    return result;
+  }
+
+  PdxTypePtr m_pdxType;
+  std::unique_ptr<PdxInstanceImpl> m_instance;
+};
+}  // namespace
+
+TEST_F(PdxInstanceImplTest, FieldIndexIsTheSequenceId) {
+  EXPECT_EQ(0, m_pdxType->getFieldIndex("id"));
+  EXPECT_EQ(1, m_pdxType->getFieldIndex("name"));
+  EXPECT_EQ(2, m_pdxType->getFieldIndex("city"));
+  EXPECT_EQ(3, m_pdxType->getFieldIndex("count"));
+
+  const char* names[] = {"id", "name", "city", "count"};
+  for (auto name : names) {
+    EXPECT_EQ(m_pdxType->getFieldIndex(name),
+              m_instance->getFieldIndex(name));
+  }
+}
+
+TEST_F(PdxInstanceImplTest, UnknownFieldHasNoIndex) {
+  EXPECT_EQ(-1, m_pdxType->getFieldIndex("missing"));
+  EXPECT_EQ(-1, m_instance->getFieldIndex("missing"));
+
+  int32_t value = 0;
+  EXPECT_THROW(m_instance->getField("missing", value), IllegalStateException);
+  EXPECT_THROW(m_instance->getField(-1, value), IllegalStateException);
+  EXPECT_THROW(m_instance->getField(4, value), IllegalStateException);
+}
+
+TEST_F(PdxInstanceImplTest, IndexAndNameReadTheSameValues) {
+  int32_t id = 0;
+  m_instance->getField(m_instance->getFieldIndex("id"), id);
+  EXPECT_EQ(7, id);
+  m_instance->getField("id", id);
+  EXPECT_EQ(7, id);
+
+  char* name = nullptr;
+  m_instance->getField(m_instance->getFieldIndex("name"), &name);
+  EXPECT_EQ("a name", stringOf(name));
+  m_instance->getField("name", &name);
+  EXPECT_EQ("a name", stringOf(name));
+
+  char* city = nullptr;
+  m_instance->getField(m_instance->getFieldIndex("city"), &city);
+  EXPECT_EQ("a city", stringOf(city));
+  m_instance->getField("city", &city);
+  EXPECT_EQ("a city", stringOf(city));
+
+  int64_t count = 0;
+  m_instance->getField(m_instance->getFieldIndex("count"), count);
+  EXPECT_EQ(42, count);
+  m_instance->getField("count", count);
+  EXPECT_EQ(42, count);
+}
+
+TEST_F(PdxInstanceImplTest, IndicesSurviveAStreamUpdate) {
+  int32_t index = m_instance->getFieldIndex("city");
+  char* city = nullptr;
+  m_instance->getField(index, &city);
+  EXPECT_EQ("a city", stringOf(city));
+
+  DataOutput output;
+  auto writer =
+      std::make_shared<PdxWriterWithTypeCollector>(output, "Customer");
+  writer->writeInt("id", 8);
+  writer->writeString("name", "a much longer name");
+  writer->writeString("city", "another city");
+  writer->writeLong("count", 43);
+  writer->endObjectWriting();
+  int length = 0;
+  uint8_t* stream = writer->getPdxStream(length);
+  m_instance->updatePdxStream(stream, length);
+  delete[] stream;
+
+  // the offsets cached for the old stream are not used for the new one
+  m_instance->getField(index, &city);
+  EXPECT_EQ("another city", stringOf(city));
+  int64_t count = 0;
+  m_instance->getField(m_instance->getFieldIndex("count"), count);
+  EXPECT_EQ(43, count);
+}
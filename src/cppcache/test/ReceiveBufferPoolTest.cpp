@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ReceiveBufferPool.hpp"
+
+using namespace apache::geode::client;
+
+TEST(ReceiveBufferPoolTest, ReusesReleasedBufferOfSameSizeClass) {
+  ReceiveBufferPool::clear();
+  char* first = ReceiveBufferPool::allocate(1000);
+  ASSERT_NE(nullptr, first);
+  std::memset(first, 0xAB, 1000);
+  ReceiveBufferPool::release(first);
+  EXPECT_EQ(1024U, ReceiveBufferPool::getCachedBytes());
+
+  char* second = ReceiveBufferPool::allocate(1024);
+  EXPECT_EQ(first, second) << "Buffer of the same size class is reused";
+  EXPECT_EQ(0U, ReceiveBufferPool::getCachedBytes());
+  ReceiveBufferPool::release(second);
+  ReceiveBufferPool::clear();
+}
+
+TEST(ReceiveBufferPoolTest, LargeBuffersAreNotCached) {
+  ReceiveBufferPool::clear();
+  size_t size = ReceiveBufferPool::MAX_SIZE_CLASS + 1;
+  char* buffer = ReceiveBufferPool::allocate(size);
+  ASSERT_NE(nullptr, buffer);
+  std::memset(buffer, 0, size);
+  ReceiveBufferPool::release(buffer);
+  EXPECT_EQ(0U, ReceiveBufferPool::getCachedBytes());
+}
+
+TEST(ReceiveBufferPoolTest, CachedBytesPerClassAreBounded) {
+  ReceiveBufferPool::clear();
+  const size_t size = ReceiveBufferPool::MAX_SIZE_CLASS;
+  const size_t count =
+      ReceiveBufferPool::MAX_CACHED_BYTES_PER_CLASS / size + 2;
+  std::vector<char*> buffers;
+  for (size_t i = 0; i < count; i++) {
+    buffers.push_back(ReceiveBufferPool::allocate(size));
+  }
+  for (size_t i = 0; i < count; i++) {
+    ReceiveBufferPool::release(buffers[i]);
+  }
+  EXPECT_EQ(ReceiveBufferPool::MAX_CACHED_BYTES_PER_CLASS,
+            ReceiveBufferPool::getCachedBytes());
+  ReceiveBufferPool::clear();
+}
+
+TEST(ReceiveBufferPoolTest, ReleaseIgnoresNull) {
+  ReceiveBufferPool::release(nullptr);
+}
@@ -0,0 +1,121 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "SingleFlight.hpp"
+#include "InFlightGetKey.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+typedef SingleFlight<int, int, std::hash<int>, std::equal_to<int>> IntFlight;
+typedef SingleFlight<InFlightGetKey, int, InFlightGetKey::Hash,
+                     InFlightGetKey::Equal>
+    GetFlight;
+}  // namespace
+
+TEST(SingleFlightTest, FirstCallerLeads) {
+  IntFlight flight;
+  bool leader = false;
+  IntFlight::CallPtr call = flight.join(1, leader);
+  EXPECT_TRUE(leader);
+  IntFlight::CallPtr other = flight.join(1, leader);
+  EXPECT_FALSE(leader);
+  EXPECT_EQ(call, other);
+  flight.join(2, leader);
+  EXPECT_TRUE(leader);
+  EXPECT_EQ(2U, flight.size());
+}
+
+TEST(SingleFlightTest, CompletedCallIsRemoved) {
+  IntFlight flight;
+  bool leader = false;
+  IntFlight::CallPtr call = flight.join(1, leader);
+  flight.complete(1, call, 10);
+  EXPECT_EQ(0U, flight.size());
+  EXPECT_EQ(10, call->wait());
+  IntFlight::CallPtr next = flight.join(1, leader);
+  EXPECT_TRUE(leader);
+  EXPECT_NE(call, next);
+}
+
+TEST(SingleFlightTest, WaitersGetLeadersResult) {
+  IntFlight flight;
+  bool leader = false;
+  IntFlight::CallPtr call = flight.join(7, leader);
+  ASSERT_TRUE(leader);
+
+  const int numWaiters = 8;
+  std::atomic<int> sum(0);
+  std::atomic<int> leaders(0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < numWaiters; ++i) {
+    threads.emplace_back([&flight, &sum, &leaders] {
+      bool isLeader = false;
+      IntFlight::CallPtr joined = flight.join(7, isLeader);
+      if (isLeader) {
+        ++leaders;
+      } else {
+        sum += joined->wait();
+      }
+    });
+  }
+  while (call->waiters() < numWaiters) {
+    std::this_thread::yield();
+  }
+  flight.complete(7, call, 5);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0, leaders.load());
+  EXPECT_EQ(numWaiters * 5, sum.load());
+}
+
+TEST(SingleFlightTest, UsersDoNotJoinEachOther) {
+  GetFlight flight;
+  auto userA = std::make_shared<UserAttributes>(nullptr, nullptr, nullptr);
+  auto userB = std::make_shared<UserAttributes>(nullptr, nullptr, nullptr);
+  bool leader = false;
+
+  GetFlight::CallPtr callA =
+      flight.join(InFlightGetKey(userA, CacheableInt32::create(1)), leader);
+  EXPECT_TRUE(leader);
+  GetFlight::CallPtr callB =
+      flight.join(InFlightGetKey(userB, CacheableInt32::create(1)), leader);
+  EXPECT_TRUE(leader);
+  EXPECT_NE(callA, callB);
+
+  // an equal key of the same user joins the call of that user only
+  GetFlight::CallPtr otherA =
+      flight.join(InFlightGetKey(userA, CacheableInt32::create(1)), leader);
+  EXPECT_FALSE(leader);
+  EXPECT_EQ(callA, otherA);
+  EXPECT_EQ(2U, flight.size());
+
+  // gets without user attributes still join each other
+  flight.join(InFlightGetKey(nullptr, CacheableInt32::create(1)), leader);
+  EXPECT_TRUE(leader);
+  flight.join(InFlightGetKey(nullptr, CacheableInt32::create(1)), leader);
+  EXPECT_FALSE(leader);
+}
@@ -15,10 +15,15 @@
  * limitations under the License.
  */
 
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
+#include <geode/CacheableBuiltins.hpp>
 #include <geode/CqState.hpp>
 #include <TcrMessage.hpp>
 #include "ByteArrayFixture.hpp"
@@ -40,6 +45,42 @@ class TcrMessageTest : public ::testing::Test, protected ByteArrayFixture {
   }
 };
 
+namespace {
+CacheableBytesPtr bytesOfLength(int32_t length) {
+  std::vector<uint8_t> bytes(length);
+  for (int32_t i = 0; i < length; i++) {
+    bytes[i] = static_cast<uint8_t>(i % 251);
+  }
+  return CacheableBytes::create(bytes.data(), length);
+}
+
+std::unique_ptr<TcrMessagePut> putOf(const CacheablePtr &value) {
+  return std::unique_ptr<TcrMessagePut>(new TcrMessagePut(
+      static_cast<const Region *>(nullptr), CacheableString::create("mykey"),
+      value, static_cast<const UserDataPtr>(nullptr),
+      false,  // isDelta
+      static_cast<ThinClientBaseDM *>(nullptr),
+      false,  // isMetaRegion
+      false,  // fullValueAfterDeltaFail
+      "myRegionName"));
+}
+
+int32_t readInt32(const char *buffer) {
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(buffer);
+  return static_cast<int32_t>((bytes[0] << 24) | (bytes[1] << 16) |
+                              (bytes[2] << 8) | bytes[3]);
+}
+
+std::string concat(const std::vector<iovec> &segments) {
+  std::string result;
+  for (const auto &segment : segments) {
+    result.append(static_cast<const char *>(segment.iov_base),
+                  segment.iov_len);
+  }
+  return result;
+}
+}  // namespace
+
 TEST_F(TcrMessageTest, intializeDefaultConstructor) {
   TcrMessageReply message(true, nullptr);
 
@@ -631,3 +672,51 @@ TEST_F(TcrMessageTest, testConstructorEXECUTECQ_WITH_IR_MSG_TYPE) {
       "000001000000010000000000010001",
       testMessage);
 }
+
+TEST_F(TcrMessageTest, smallByteArrayIsCopiedIntoTheRequest) {
+  auto value = bytesOfLength(TcrMessage::BORROWED_PART_MIN_LENGTH - 1);
+  auto message = putOf(value);
+
+  EXPECT_FALSE(message->hasBorrowedParts());
+  std::vector<iovec> segments;
+  message->getMsgSegments(segments);
+  ASSERT_EQ(1U, segments.size());
+  EXPECT_EQ(message->getMsgData(), segments[0].iov_base);
+  EXPECT_EQ(message->getMsgLength(), segments[0].iov_len);
+}
+
+TEST_F(TcrMessageTest, largeByteArrayIsSentInPlace) {
+  auto value = bytesOfLength(TcrMessage::BORROWED_PART_MIN_LENGTH);
+  auto message = putOf(value);
+
+  ASSERT_TRUE(message->hasBorrowedParts());
+  std::vector<iovec> segments;
+  message->getMsgSegments(segments);
+  ASSERT_EQ(3U, segments.size());
+  // the value bytes are not copied
+  EXPECT_EQ(value->value(), segments[1].iov_base);
+  EXPECT_EQ(static_cast<size_t>(value->length()), segments[1].iov_len);
+  EXPECT_EQ(message->getMsgLength(), concat(segments).size());
+
+  // the header and the part header count the bytes sent in place
+  EXPECT_EQ(static_cast<int32_t>(message->getMsgLength() - 17),
+            readInt32(message->getMsgHeader() + 4));
+  const char *partHeader =
+      static_cast<const char *>(segments[0].iov_base) + segments[0].iov_len - 5;
+  EXPECT_EQ(value->length(), readInt32(partHeader));
+  EXPECT_EQ(0, partHeader[4]);
+}
+
+TEST_F(TcrMessageTest, contiguousMessageMatchesTheSegments) {
+  auto value = bytesOfLength(TcrMessage::BORROWED_PART_MIN_LENGTH + 100);
+  auto message = putOf(value);
+
+  std::vector<iovec> segments;
+  message->getMsgSegments(segments);
+  std::string expected = concat(segments);
+  ASSERT_EQ(expected.size(), message->getMsgLength());
+  EXPECT_EQ(expected, std::string(message->getMsgData(),
+                                  message->getMsgLength()));
+  EXPECT_EQ(0, std::memcmp(message->getMsgData() + segments[0].iov_len,
+                           value->value(), value->length()));
+}
@@ -0,0 +1,74 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TcrMessage.hpp"
+#include "TcrMultiplexedConnection.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+void appendInt(std::vector<char>& bytes, int32_t value) {
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    bytes.push_back(static_cast<char>((value >> shift) & 0xFF));
+  }
+}
+
+// the header of a reply: type, length, number of parts, transaction id and
+// flags
+std::vector<char> replyHeader(int32_t transId) {
+  std::vector<char> bytes;
+  appendInt(bytes, TcrMessage::RESPONSE);
+  appendInt(bytes, 0);
+  appendInt(bytes, 0);
+  appendInt(bytes, transId);
+  bytes.push_back(0);
+  return bytes;
+}
+}  // namespace
+
+TEST(TcrMultiplexedConnectionTest, ReadsTransIdOfReply) {
+  int32_t transId = 0;
+  std::vector<char> reply = replyHeader(0x01020304);
+  ASSERT_TRUE(TcrMultiplexedConnection::getTransId(reply.data(), reply.size(),
+                                                   transId));
+  EXPECT_EQ(0x01020304, transId);
+
+  reply = replyHeader(-1);
+  ASSERT_TRUE(TcrMultiplexedConnection::getTransId(reply.data(), reply.size(),
+                                                   transId));
+  EXPECT_EQ(-1, transId);
+}
+
+TEST(TcrMultiplexedConnectionTest, ReplyCarriesTransIdOfRequest) {
+  // the server echoes the transaction id of the request header
+  TcrMessageDestroyRegion request(nullptr, nullptr, 1000, nullptr);
+  int32_t transId = 0;
+  ASSERT_TRUE(TcrMultiplexedConnection::getTransId(
+      request.getMsgData(), request.getMsgLength(), transId));
+  EXPECT_EQ(request.getTransId(), transId);
+}
+
+TEST(TcrMultiplexedConnectionTest, ShortReplyHasNoTransId) {
+  int32_t transId = 7;
+  std::vector<char> reply = replyHeader(1);
+  EXPECT_FALSE(TcrMultiplexedConnection::getTransId(reply.data(), 15, transId));
+  EXPECT_FALSE(TcrMultiplexedConnection::getTransId(nullptr, 0, transId));
+  EXPECT_EQ(7, transId);
+}
@@ -0,0 +1,142 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "TimerWheel.hpp"
+
+using namespace apache::geode::client;
+
+TEST(TimerWheelTest, ExpiresAtScheduledTick) {
+  TimerWheel<int> wheel;
+  int32_t id = wheel.add(7);
+  wheel.schedule(id, 5);
+
+  std::vector<int32_t> due;
+  wheel.advance(4, due);
+  EXPECT_TRUE(due.empty());
+  wheel.advance(5, due);
+  ASSERT_EQ(1U, due.size());
+  EXPECT_EQ(id, due[0]);
+  EXPECT_EQ(7, wheel.payload(id));
+  EXPECT_FALSE(wheel.isScheduled(id));
+  EXPECT_TRUE(wheel.contains(id));
+}
+
+TEST(TimerWheelTest, PastTickExpiresAtNextTick) {
+  TimerWheel<int> wheel;
+  std::vector<int32_t> due;
+  wheel.advance(10, due);
+  int32_t id = wheel.add(1);
+  wheel.schedule(id, 3);
+  wheel.advance(11, due);
+  ASSERT_EQ(1U, due.size());
+  EXPECT_EQ(id, due[0]);
+}
+
+TEST(TimerWheelTest, CancelledTimerDoesNotExpire) {
+  TimerWheel<int> wheel;
+  int32_t first = wheel.add(1);
+  int32_t second = wheel.add(2);
+  wheel.schedule(first, 300);
+  wheel.schedule(second, 300);
+  EXPECT_EQ(2, wheel.remove(second));
+  EXPECT_FALSE(wheel.contains(second));
+  EXPECT_EQ(1U, wheel.size());
+
+  std::vector<int32_t> due;
+  wheel.advance(300, due);
+  ASSERT_EQ(1U, due.size());
+  EXPECT_EQ(first, due[0]);
+}
+
+TEST(TimerWheelTest, RescheduleMovesTimer) {
+  TimerWheel<int> wheel;
+  int32_t id = wheel.add(1);
+  wheel.schedule(id, 10);
+  wheel.schedule(id, 20000);
+
+  std::vector<int32_t> due;
+  wheel.advance(19999, due);
+  EXPECT_TRUE(due.empty());
+  wheel.advance(20000, due);
+  ASSERT_EQ(1U, due.size());
+  EXPECT_EQ(id, due[0]);
+}
+
+TEST(TimerWheelTest, ReusesRemovedIds) {
+  TimerWheel<int> wheel;
+  int32_t id = wheel.add(1);
+  wheel.remove(id);
+  EXPECT_EQ(id, wheel.add(2));
+  EXPECT_EQ(2, wheel.payload(id));
+}
+
+TEST(TimerWheelTest, ExpiresTimersAcrossAllWheels) {
+  TimerWheel<uint64_t> wheel;
+  std::vector<uint64_t> ticks;
+  std::srand(42);
+  for (int i = 0; i < 2000; ++i) {
+    uint64_t tick = 1 + static_cast<uint64_t>(std::rand()) % (1 << 22);
+    ticks.push_back(tick);
+    wheel.schedule(wheel.add(tick), tick);
+  }
+  // beyond the span of the wheels
+  uint64_t far = (static_cast<uint64_t>(1) << 27) + 5;
+  ticks.push_back(far);
+  wheel.schedule(wheel.add(far), far);
+
+  std::vector<int32_t> due;
+  uint64_t tick = 0;
+  size_t expired = 0;
+  while (expired < ticks.size()) {
+    tick += 97;
+    due.clear();
+    wheel.advance(tick, due);
+    for (auto id : due) {
+      uint64_t expiryTick = wheel.payload(id);
+      EXPECT_LE(expiryTick, tick);
+      EXPECT_GT(expiryTick + 97, tick);
+      wheel.remove(id);
+    }
+    expired += due.size();
+  }
+  EXPECT_EQ(0U, wheel.size());
+  EXPECT_GE(tick, far);
+}
+
+TEST(TimerWheelTest, ClearFreesEveryTimer) {
+  TimerWheel<int> wheel;
+  int32_t scheduled = wheel.add(1);
+  wheel.schedule(scheduled, 100000);
+  int32_t unscheduled = wheel.add(2);
+
+  std::vector<int> payloads;
+  wheel.clear(payloads);
+  ASSERT_EQ(2U, payloads.size());
+  EXPECT_EQ(1, payloads[0]);
+  EXPECT_EQ(2, payloads[1]);
+  EXPECT_EQ(0U, wheel.size());
+  EXPECT_FALSE(wheel.contains(scheduled));
+  EXPECT_FALSE(wheel.contains(unscheduled));
+
+  std::vector<int32_t> due;
+  wheel.advance(200000, due);
+  EXPECT_TRUE(due.empty());
+}
@@ -0,0 +1,97 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ValueArena.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+std::string valueOf(uint32_t index, uint32_t length) {
+  std::string value(length, 'a');
+  for (uint32_t i = 0; i < length; ++i) {
+    value[i] = static_cast<char>('a' + (index + i) % 26);
+  }
+  return value;
+}
+
+uint32_t store(ValueArena& arena, const std::string& value) {
+  return arena.store(reinterpret_cast<const uint8_t*>(value.data()),
+                     static_cast<uint32_t>(value.size()));
+}
+
+std::string read(const ValueArena& arena, uint32_t handle) {
+  uint8_t buffer[ValueArena::MAX_VALUE_SIZE];
+  uint32_t length = arena.read(handle, buffer);
+  return std::string(reinterpret_cast<char*>(buffer), length);
+}
+}  // namespace
+
+TEST(ValueArenaTest, StoresAndReadsValues) {
+  ValueArena arena;
+  uint32_t empty = store(arena, "");
+  uint32_t small = store(arena, "hello");
+  uint32_t large = store(arena, valueOf(3, ValueArena::MAX_VALUE_SIZE));
+  EXPECT_EQ("", read(arena, empty));
+  EXPECT_EQ("hello", read(arena, small));
+  EXPECT_EQ(valueOf(3, ValueArena::MAX_VALUE_SIZE), read(arena, large));
+  EXPECT_EQ(5U + ValueArena::MAX_VALUE_SIZE, arena.bytesStored());
+}
+
+TEST(ValueArenaTest, RejectsValuesTooLarge) {
+  ValueArena arena;
+  EXPECT_EQ(ValueArena::NO_HANDLE,
+            store(arena, valueOf(0, ValueArena::MAX_VALUE_SIZE + 1)));
+  EXPECT_EQ(0U, arena.bytesReserved());
+}
+
+TEST(ValueArenaTest, ReusesReleasedHandles) {
+  ValueArena arena;
+  uint32_t handle = store(arena, "first");
+  arena.release(handle);
+  EXPECT_EQ(0U, arena.bytesStored());
+  EXPECT_EQ(handle, store(arena, "second"));
+  EXPECT_EQ("second", read(arena, handle));
+}
+
+TEST(ValueArenaTest, CompactionKeepsValuesAndFreesSlabs) {
+  ValueArena arena;
+  const uint32_t length = 40;
+  const uint32_t count = 20000;
+  std::vector<uint32_t> handles;
+  for (uint32_t i = 0; i < count; ++i) {
+    handles.push_back(store(arena, valueOf(i, length)));
+  }
+  size_t reserved = arena.bytesReserved();
+  EXPECT_GE(reserved, count * length);
+
+  // keep one value in ten, spread over every slab
+  for (uint32_t i = 0; i < count; ++i) {
+    if (i % 10 != 0) {
+      arena.release(handles[i]);
+    }
+  }
+  EXPECT_EQ(count / 10 * length, arena.bytesStored());
+  EXPECT_LE(arena.bytesReserved(), reserved / 5);
+  for (uint32_t i = 0; i < count; i += 10) {
+    EXPECT_EQ(valueOf(i, length), read(arena, handles[i]));
+  }
+}
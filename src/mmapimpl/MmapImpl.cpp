@@ -0,0 +1,368 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MmapImpl.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+std::string g_default_persistence_directory = "GeodeRegionData";
+size_t g_default_segment_size = 64 * 1024 * 1024;
+int g_default_compaction_threshold = 50;
+int g_default_compaction_interval = 1000;
+}  // namespace
+
+using namespace apache::geode::client;
+
+const int MmapImpl::COMPACTION_BATCH_SIZE;
+
+MmapImpl::MmapImpl()
+    : m_segmentSize(g_default_segment_size),
+      m_compactionThreshold(g_default_compaction_threshold),
+      m_compactionInterval(g_default_compaction_interval),
+      m_closed(true),
+      m_nextSegmentId(0) {}
+
+MmapImpl::~MmapImpl() {
+  LOGDEBUG("MmapImpl::~MmapImpl calling  ~MmapImpl");
+  if (m_compactionThread.joinable()) {
+    close();
+  }
+}
+
+void MmapImpl::init(const RegionPtr& region, PropertiesPtr& diskProperties) {
+  m_regionPtr = region;
+  init(std::string(region->getName()), diskProperties);
+}
+
+void MmapImpl::init(const std::string& regionName,
+                    PropertiesPtr& diskProperties) {
+  m_persistanceDir = g_default_persistence_directory;
+  m_regionName = regionName;
+  if (diskProperties != nullptr) {
+    CacheableStringPtr persDir = diskProperties->find(PERSISTENCE_DIR);
+    CacheableStringPtr segmentSizePtr = diskProperties->find(SEGMENT_SIZE);
+    CacheableStringPtr thresholdPtr =
+        diskProperties->find(COMPACTION_THRESHOLD);
+    CacheableStringPtr intervalPtr = diskProperties->find(COMPACTION_INTERVAL);
+
+    if (persDir != nullptr) m_persistanceDir = persDir->asChar();
+
+    if (segmentSizePtr != nullptr && atol(segmentSizePtr->asChar()) > 0) {
+      m_segmentSize = static_cast<size_t>(atol(segmentSizePtr->asChar()));
+    }
+
+    if (thresholdPtr != nullptr) {
+      m_compactionThreshold = atoi(thresholdPtr->asChar());
+    }
+
+    if (intervalPtr != nullptr && atoi(intervalPtr->asChar()) > 0) {
+      m_compactionInterval = atoi(intervalPtr->asChar());
+    }
+  }
+
+#ifndef _WIN32
+  char currWDPath[512];
+  ::getcwd(currWDPath, 512);
+
+  if (m_persistanceDir.at(0) != '/') {
+    if (0 == ::strlen(currWDPath)) {
+      throw InitFailedException(
+          "Failed to get absolute path for persistence directory.");
+    }
+    m_persistanceDir = std::string(currWDPath) + "/" + m_persistanceDir;
+  }
+
+  LOGFINE("MmapImpl::init creating persistence directory: %s",
+          m_persistanceDir.c_str());
+  ::mkdir(m_persistanceDir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+
+  m_regionDir = m_persistanceDir + "/" + m_regionName;
+  ::mkdir(m_regionDir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+#else
+  char currWDPath[512];
+  GetCurrentDirectory(512, currWDPath);
+
+  if (m_persistanceDir.find(":", 0) == std::string::npos) {
+    m_persistanceDir = std::string(currWDPath) + "/" + m_persistanceDir;
+  }
+
+  LOGFINE("MmapImpl::init creating persistence directory: %s",
+          m_persistanceDir.c_str());
+  CreateDirectory(m_persistanceDir.c_str(), NULL);
+
+  m_regionDir = m_persistanceDir + "/" + m_regionName;
+  CreateDirectory(m_regionDir.c_str(), NULL);
+#endif
+
+  std::lock_guard<std::mutex> guard(m_lock);
+  try {
+    rollSegmentLocked(0);
+  } catch (const Exception& ex) {
+    throw InitFailedException(ex.getMessage());
+  }
+  m_closed = false;
+  m_compactionThread = std::thread(&MmapImpl::compactionLoop, this);
+  LOGFINE(
+      "MmapImpl::init region %s with segment size %lld, compaction threshold "
+      "%d%% and compaction interval %d ms",
+      m_regionName.c_str(), static_cast<long long>(m_segmentSize),
+      m_compactionThreshold,
+      m_compactionInterval);
+}
+
+void MmapImpl::write(const CacheableKeyPtr& key, const CacheablePtr& value,
+                     void*& dbHandle) {
+  DataOutput valueDataBuffer;
+  uint32_t valueBufferSize;
+  valueDataBuffer.writeObject(value);
+  const uint8_t* valueData = valueDataBuffer.getBuffer(&valueBufferSize);
+
+  MmapRecord* record = static_cast<MmapRecord*>(dbHandle);
+  std::lock_guard<std::mutex> guard(m_lock);
+  if (record == nullptr) {
+    record = new MmapRecord();
+    record->m_offset = 0;
+    record->m_length = 0;
+    try {
+      appendLocked(record, valueData, valueBufferSize);
+    } catch (...) {
+      delete record;
+      throw;
+    }
+    dbHandle = record;
+  } else {
+    appendLocked(record, valueData, valueBufferSize);
+  }
+}
+
+bool MmapImpl::writeAll() {
+  std::lock_guard<std::mutex> guard(m_lock);
+  for (std::vector<MmapSegmentPtr>::iterator iter = m_segments.begin();
+       iter != m_segments.end(); ++iter) {
+    (*iter)->sync();
+  }
+  return true;
+}
+
+CacheablePtr MmapImpl::read(const CacheableKeyPtr& key, void*& dbHandle) {
+  MmapRecord* record = static_cast<MmapRecord*>(dbHandle);
+  if (record == nullptr) {
+    throw EntryNotFoundException("MmapImpl::read: entry is not on disk");
+  }
+  MmapSegmentPtr segment;
+  size_t offset;
+  uint32_t length;
+  {
+    // the record may be moved by compaction; the segment it points to stays
+    // mapped for as long as we hold a reference to it
+    std::lock_guard<std::mutex> guard(m_lock);
+    segment = record->m_segment;
+    offset = record->m_offset;
+    length = record->m_length;
+  }
+  DataInput valueDataBuffer(segment->getData() + offset, length);
+  CacheablePtr retValue;
+  valueDataBuffer.readObject(retValue);
+  return retValue;
+}
+
+bool MmapImpl::readAll() {
+  std::vector<MmapRecord> records;
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    for (std::vector<MmapSegmentPtr>::iterator iter = m_segments.begin();
+         iter != m_segments.end(); ++iter) {
+      std::unordered_set<MmapRecord*>& segmentRecords = (*iter)->getRecords();
+      for (std::unordered_set<MmapRecord*>::iterator recIter =
+               segmentRecords.begin();
+           recIter != segmentRecords.end(); ++recIter) {
+        records.push_back(**recIter);
+      }
+    }
+  }
+  size_t numEntries = 0;
+  try {
+    for (; numEntries < records.size(); numEntries++) {
+      const MmapRecord& record = records[numEntries];
+      DataInput valueDataBuffer(record.m_segment->getData() + record.m_offset,
+                                record.m_length);
+      CacheablePtr value;
+      valueDataBuffer.readObject(value);
+    }
+  } catch (const Exception& ex) {
+    LOGERROR("MmapImpl::readAll failed to deserialize entry %d: %s: %s",
+             static_cast<int>(numEntries), ex.getName(), ex.getMessage());
+    return false;
+  }
+  LOGFINE("MmapImpl::readAll read %d entries for region %s",
+          static_cast<int>(numEntries), m_regionName.c_str());
+  return true;
+}
+
+void MmapImpl::destroy(const CacheableKeyPtr& key, void*& dbHandle) {
+  MmapRecord* record = static_cast<MmapRecord*>(dbHandle);
+  if (record == nullptr) {
+    throw EntryNotFoundException("MmapImpl::destroy: entry is not on disk");
+  }
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    record->m_segment->removeRecord(record);
+  }
+  delete record;
+  dbHandle = nullptr;
+}
+
+void MmapImpl::close() {
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_closed = true;
+  }
+  m_compactionCond.notify_all();
+  if (m_compactionThread.joinable()) {
+    m_compactionThread.join();
+  }
+
+  std::lock_guard<std::mutex> guard(m_lock);
+  for (std::vector<MmapSegmentPtr>::iterator iter = m_segments.begin();
+       iter != m_segments.end(); ++iter) {
+    std::unordered_set<MmapRecord*>& records = (*iter)->getRecords();
+    for (std::unordered_set<MmapRecord*>::iterator recIter = records.begin();
+         recIter != records.end(); ++recIter) {
+      delete *recIter;
+    }
+    records.clear();
+    (*iter)->retire();
+  }
+  m_segments.clear();
+  m_activeSegment = nullptr;
+
+#ifndef _WIN32
+  ::rmdir(m_regionDir.c_str());
+  ::rmdir(m_persistanceDir.c_str());
+#else
+  RemoveDirectory(m_regionDir.c_str());
+  RemoveDirectory(m_persistanceDir.c_str());
+#endif
+}
+
+void MmapImpl::appendLocked(MmapRecord* record, const uint8_t* bytes,
+                            uint32_t length) {
+  if (!m_activeSegment->hasRoom(length)) {
+    rollSegmentLocked(length);
+  }
+  size_t offset = m_activeSegment->append(bytes, length);
+  if (record->m_segment != nullptr) {
+    record->m_segment->removeRecord(record);
+  }
+  record->m_segment = m_activeSegment;
+  record->m_offset = offset;
+  record->m_length = length;
+  m_activeSegment->addRecord(record);
+}
+
+void MmapImpl::rollSegmentLocked(uint32_t length) {
+  char fileName[64];
+  ::snprintf(fileName, sizeof(fileName), "/%u.seg", m_nextSegmentId);
+  MmapSegmentPtr segment = std::make_shared<MmapSegment>(
+      m_nextSegmentId, m_regionDir + fileName,
+      std::max(m_segmentSize, static_cast<size_t>(length)));
+  m_nextSegmentId++;
+  m_segments.push_back(segment);
+  m_activeSegment = segment;
+  LOGDEBUG("MmapImpl: region %s now appending to segment %u",
+           m_regionName.c_str(), segment->getId());
+}
+
+void MmapImpl::compactionLoop() {
+  std::unique_lock<std::mutex> guard(m_lock);
+  while (!m_closed) {
+    m_compactionCond.wait_for(
+        guard, std::chrono::milliseconds(m_compactionInterval));
+    if (m_closed) {
+      break;
+    }
+    guard.unlock();
+    try {
+      compact();
+    } catch (const Exception& ex) {
+      LOGERROR("MmapImpl: compaction of region %s failed: %s: %s",
+               m_regionName.c_str(), ex.getName(), ex.getMessage());
+    }
+    guard.lock();
+  }
+}
+
+void MmapImpl::compact() {
+  // sealed segments whose live bytes have fallen to the threshold
+  std::vector<MmapSegmentPtr> candidates;
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    for (std::vector<MmapSegmentPtr>::iterator iter = m_segments.begin();
+         iter != m_segments.end(); ++iter) {
+      const MmapSegmentPtr& segment = *iter;
+      if (segment != m_activeSegment &&
+          segment->getLiveBytes() * 100 <=
+              segment->getWriteOffset() * m_compactionThreshold) {
+        candidates.push_back(segment);
+      }
+    }
+  }
+
+  for (std::vector<MmapSegmentPtr>::iterator iter = candidates.begin();
+       iter != candidates.end(); ++iter) {
+    const MmapSegmentPtr& segment = *iter;
+    size_t moved = 0;
+    bool done = false;
+    // move the live records in batches so that writers and readers are not
+    // held up for the whole segment
+    while (!done) {
+      std::lock_guard<std::mutex> guard(m_lock);
+      if (m_closed) {
+        return;
+      }
+      std::unordered_set<MmapRecord*>& records = segment->getRecords();
+      for (int i = 0; i < COMPACTION_BATCH_SIZE && !records.empty(); i++) {
+        MmapRecord* record = *records.begin();
+        appendLocked(record, segment->getData() + record->m_offset,
+                     record->m_length);
+        moved++;
+      }
+      if (records.empty()) {
+        segment->retire();
+        m_segments.erase(
+            std::find(m_segments.begin(), m_segments.end(), segment));
+        done = true;
+      }
+    }
+    LOGFINE("MmapImpl: compacted segment %u of region %s moving %d records",
+            segment->getId(), m_regionName.c_str(), static_cast<int>(moved));
+  }
+}
+
+extern "C" {
+
+LIBEXP PersistenceManager* createMmapInstance() { return new MmapImpl; }
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#ifndef GEODE_MMAPIMPL_MMAPIMPL_H_
+#define GEODE_MMAPIMPL_MMAPIMPL_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/PersistenceManager.hpp>
+#include <geode/GeodeCppCache.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "MmapSegment.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class MmapImpl MmapImpl.hpp
+ * Memory mapped API for overflow.
+ * The MmapImpl class derives from PersistenceManager base class and keeps
+ * overflowed values in an append-only log of memory mapped segment files.
+ * The PersistenceInfo handle of an entry is an MmapRecord giving the
+ * location of its value, so reading an overflowed value back is a pointer
+ * dereference followed by deserialization. Overwritten and destroyed values
+ * leave dead bytes behind; a background thread copies the live values out of
+ * mostly dead segments and removes them.
+ */
+class MmapImpl : public PersistenceManager {
+  /**
+   * @brief public methods
+   */
+ public:
+  /**
+   * Creates the segment directory for the region and starts the compaction
+   * thread. Settings are passed via diskProperties argument.
+   * @throws InitFailedException if persistence directory initialization
+   * fails.
+   */
+  void init(const RegionPtr& regionptr, PropertiesPtr& diskProperties);
+
+  /**
+   * As init() for a region, given only the region name that names its
+   * segment directory.
+   */
+  void init(const std::string& regionName, PropertiesPtr& diskProperties);
+
+  /**
+   * Appends the serialized value to the active segment and points the
+   * entry's record at it.
+   * @param key the key to write.
+   * @param value the value to write
+   * @param dbHandle the record of the entry; allocated on its first write.
+   * @throws DiskFailureException if a new segment cannot be created.
+   */
+  void write(const CacheableKeyPtr& key, const CacheablePtr& value,
+             void*& dbHandle);
+
+  /**
+   * Flushes all the segments to disk.
+   */
+  bool writeAll();
+
+  /**
+   * Deserializes the value the entry's record points to.
+   * @returns value of type CacheablePtr.
+   * @param key is the key for which the value has to be read.
+   * @param dbHandle the record of the entry.
+   * @throws EntryNotFoundException if the entry has no record.
+   */
+  CacheablePtr read(const CacheableKeyPtr& key, void*& dbHandle);
+
+  /**
+   * Checks that every stored value can be deserialized.
+   * @return false if a value could not be deserialized.
+   */
+  bool readAll();
+
+  /**
+   * Releases the entry's record and resets the handle; the value becomes
+   * dead bytes in its segment.
+   * @throws EntryNotFoundException if the entry has no record.
+   */
+  void destroy(const CacheableKeyPtr& key, void*& dbHandle);
+
+  /**
+   * Stops the compaction thread and removes the segment files.
+   */
+  void close();
+
+  /**
+   * @brief destructor
+   */
+  ~MmapImpl();
+
+  /**
+   * @brief constructor
+   */
+  MmapImpl();
+
+  /**
+   * @brief private members
+   */
+
+ private:
+  /** Number of records moved per lock acquisition during compaction. */
+  static const int COMPACTION_BATCH_SIZE = 64;
+
+  // called with m_lock held
+  void appendLocked(MmapRecord* record, const uint8_t* bytes, uint32_t length);
+  void rollSegmentLocked(uint32_t length);
+
+  void compactionLoop();
+  void compact();
+
+  RegionPtr m_regionPtr;
+  std::string m_regionName;
+  std::string m_regionDir;
+  std::string m_persistanceDir;
+  size_t m_segmentSize;
+  int m_compactionThreshold;
+  int m_compactionInterval;
+
+  std::mutex m_lock;
+  std::condition_variable m_compactionCond;
+  std::thread m_compactionThread;
+  bool m_closed;
+  std::vector<MmapSegmentPtr> m_segments;
+  MmapSegmentPtr m_activeSegment;
+  uint32_t m_nextSegmentId;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_MMAPIMPL_MMAPIMPL_H_
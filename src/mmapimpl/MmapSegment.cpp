@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MmapSegment.hpp"
+#include <cstring>
+#include <geode/ExceptionTypes.hpp>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace apache::geode::client;
+
+MmapSegment::MmapSegment(uint32_t id, const std::string& fileName,
+                         size_t capacity)
+    : m_id(id),
+      m_fileName(fileName),
+      m_capacity(capacity),
+      m_data(nullptr),
+      m_writeOffset(0),
+      m_liveBytes(0),
+      m_retired(false) {
+  std::string error = "Failed to create overflow segment file " + fileName;
+#ifndef _WIN32
+  m_fd = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC,
+                S_IRUSR | S_IWUSR);
+  if (m_fd < 0) {
+    throw DiskFailureException(error.c_str());
+  }
+  if (::ftruncate(m_fd, static_cast<off_t>(capacity)) != 0) {
+    ::close(m_fd);
+    ::unlink(fileName.c_str());
+    throw DiskFailureException(error.c_str());
+  }
+  void* data =
+      ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (data == MAP_FAILED) {
+    ::close(m_fd);
+    ::unlink(fileName.c_str());
+    throw DiskFailureException(error.c_str());
+  }
+  m_data = static_cast<uint8_t*>(data);
+#else
+  m_file = CreateFile(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL,
+                      CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (m_file == INVALID_HANDLE_VALUE) {
+    throw DiskFailureException(error.c_str());
+  }
+  uint64_t size = static_cast<uint64_t>(capacity);
+  m_mapping =
+      CreateFileMapping(m_file, NULL, PAGE_READWRITE,
+                        static_cast<DWORD>(size >> 32),
+                        static_cast<DWORD>(size & 0xFFFFFFFF), NULL);
+  if (m_mapping == NULL) {
+    CloseHandle(m_file);
+    DeleteFile(fileName.c_str());
+    throw DiskFailureException(error.c_str());
+  }
+  m_data = static_cast<uint8_t*>(
+      MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, capacity));
+  if (m_data == NULL) {
+    CloseHandle(m_mapping);
+    CloseHandle(m_file);
+    DeleteFile(fileName.c_str());
+    throw DiskFailureException(error.c_str());
+  }
+#endif
+}
+
+MmapSegment::~MmapSegment() {
+#ifndef _WIN32
+  ::munmap(m_data, m_capacity);
+  ::close(m_fd);
+  if (m_retired) {
+    ::unlink(m_fileName.c_str());
+  }
+#else
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  CloseHandle(m_file);
+  if (m_retired) {
+    DeleteFile(m_fileName.c_str());
+  }
+#endif
+}
+
+size_t MmapSegment::append(const uint8_t* bytes, uint32_t length) {
+  size_t offset = m_writeOffset;
+  std::memcpy(m_data + offset, bytes, length);
+  m_writeOffset += length;
+  return offset;
+}
+
+void MmapSegment::addRecord(MmapRecord* record) {
+  m_records.insert(record);
+  m_liveBytes += record->m_length;
+}
+
+void MmapSegment::removeRecord(MmapRecord* record) {
+  if (m_records.erase(record) > 0) {
+    m_liveBytes -= record->m_length;
+  }
+}
+
+void MmapSegment::sync() {
+  if (m_writeOffset == 0) {
+    return;
+  }
+#ifndef _WIN32
+  ::msync(m_data, m_writeOffset, MS_SYNC);
+#else
+  FlushViewOfFile(m_data, m_writeOffset);
+  FlushFileBuffers(m_file);
+#endif
+}
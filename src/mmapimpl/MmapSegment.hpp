@@ -0,0 +1,129 @@
+#pragma once
+
+#ifndef GEODE_MMAPIMPL_MMAPSEGMENT_H_
+#define GEODE_MMAPIMPL_MMAPSEGMENT_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class MmapSegment;
+
+/**
+ * Location of an overflowed value: the segment holding its serialized bytes,
+ * their offset in the segment and their length. This is the PersistenceInfo
+ * handle kept with every overflowed entry.
+ */
+struct MmapRecord {
+  std::shared_ptr<MmapSegment> m_segment;
+  size_t m_offset;
+  uint32_t m_length;
+};
+
+/**
+ * A segment file of fixed capacity mapped into memory, to which serialized
+ * values are appended. Bytes once written are never modified, so readers
+ * holding a reference to the segment can deserialize them without locking.
+ * The file is unmapped when the last reference goes away and removed if the
+ * segment has been retired.
+ *
+ * The bookkeeping (write offset, live bytes and records) is not synchronized
+ * and is guarded by the owning MmapImpl.
+ */
+class MmapSegment {
+ public:
+  /**
+   * Creates the segment file with the given capacity and maps it.
+   * @throws DiskFailureException if the file cannot be created or mapped.
+   */
+  MmapSegment(uint32_t id, const std::string& fileName, size_t capacity);
+
+  ~MmapSegment();
+
+  uint32_t getId() const { return m_id; }
+
+  const uint8_t* getData() const { return m_data; }
+
+  size_t getCapacity() const { return m_capacity; }
+
+  size_t getWriteOffset() const { return m_writeOffset; }
+
+  size_t getLiveBytes() const { return m_liveBytes; }
+
+  bool hasRoom(size_t length) const {
+    return m_capacity - m_writeOffset >= length;
+  }
+
+  /**
+   * Copies the bytes at the end of the segment and returns their offset.
+   * The caller checks hasRoom() first.
+   */
+  size_t append(const uint8_t* bytes, uint32_t length);
+
+  /** Adds a record that now points into this segment. */
+  void addRecord(MmapRecord* record);
+
+  /** Removes a record that no longer points into this segment. */
+  void removeRecord(MmapRecord* record);
+
+  /** The records whose values live in this segment. */
+  std::unordered_set<MmapRecord*>& getRecords() { return m_records; }
+
+  /** Flushes the written bytes to the file. */
+  void sync();
+
+  /** Removes the file once the segment is no longer referenced. */
+  void retire() { m_retired = true; }
+
+ private:
+  MmapSegment(const MmapSegment&);
+  MmapSegment& operator=(const MmapSegment&);
+
+  uint32_t m_id;
+  std::string m_fileName;
+  size_t m_capacity;
+  uint8_t* m_data;
+#ifdef _WIN32
+  HANDLE m_file;
+  HANDLE m_mapping;
+#else
+  int m_fd;
+#endif
+  size_t m_writeOffset;
+  size_t m_liveBytes;
+  bool m_retired;
+  std::unordered_set<MmapRecord*> m_records;
+};
+
+typedef std::shared_ptr<MmapSegment> MmapSegmentPtr;
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_MMAPIMPL_MMAPSEGMENT_H_
@@ -15,13 +15,39 @@
  * limitations under the License.
  */
 #include "SqLiteHelper.hpp"
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <string>
 #define QUERY_SIZE 512
+
+SqLiteHelper::SqLiteHelper()
+    : m_dbHandle(nullptr),
+      m_tableName(nullptr),
+      m_insertStmt(nullptr),
+      m_removeStmt(nullptr),
+      m_getStmt(nullptr),
+      m_beginStmt(nullptr),
+      m_commitStmt(nullptr),
+      m_maxBatchSize(1),
+      m_flushInterval(0),
+      m_batchCount(0),
+      m_closing(false) {}
+
+SqLiteHelper::~SqLiteHelper() { stopFlushThread(); }
+
 int SqLiteHelper::initDB(const char *regionName, int maxPageCount, int pageSize,
-                         const char *regionDBfile, int busy_timeout_ms) {
+                         const char *regionDBfile, int busy_timeout_ms,
+                         const char *journalMode, int maxBatchSize,
+                         int flushIntervalMs) {
   LOGDEBUG(
       "SqLiteHelper::initDB Initializing SqLite with region name:%s, max page "
-      "count : %d, page size:%d and region db file :%s",
-      regionName, maxPageCount, pageSize, regionDBfile);
+      "count : %d, page size:%d, region db file :%s, journal mode:%s, max "
+      "batch size:%d and flush interval:%d",
+      regionName, maxPageCount, pageSize, regionDBfile, journalMode,
+      maxBatchSize, flushIntervalMs);
+  m_maxBatchSize = maxBatchSize > 0 ? maxBatchSize : 1;
+  m_flushInterval = std::chrono::milliseconds(flushIntervalMs);
   // open the database
   int retCode = sqlite3_open(regionDBfile, &m_dbHandle);
   if (retCode == SQLITE_OK) {
@@ -38,8 +64,25 @@ int SqLiteHelper::initDB(const char *regionName, int maxPageCount, int pageSize,
       retCode = executePragma("page_size", pageSize);
     }
 
+    if (retCode == SQLITE_OK && journalMode != nullptr && *journalMode) {
+      std::string mode(journalMode);
+      std::transform(mode.begin(), mode.end(), mode.begin(), ::toupper);
+      retCode = executePragma("journal_mode", mode.c_str());
+      // a commit in WAL mode needs no sync of the database file
+      if (retCode == SQLITE_OK && mode == "WAL") {
+        retCode = executePragma("synchronous", "NORMAL");
+      }
+    }
+
     // create table
     if (retCode == SQLITE_OK) retCode = createTable();
+
+    if (retCode == SQLITE_OK) retCode = prepareStatements();
+
+    if (retCode == SQLITE_OK && m_maxBatchSize > 1 &&
+        m_flushInterval.count() > 0) {
+      m_flushThread = std::thread(&SqLiteHelper::flushOnInterval, this);
+    }
   }
 
   return retCode;
@@ -65,78 +108,236 @@ int SqLiteHelper::createTable() {
   return retCode == SQLITE_DONE ? 0 : retCode;
 }
 
-int SqLiteHelper::insertKeyValue(void *keyData, uint32_t keyDataSize,
-                                 void *valueData, uint32_t valueDataSize) {
-  // construct query
+int SqLiteHelper::prepareStatements() {
   char query[QUERY_SIZE];
+
   SNPRINTF(query, QUERY_SIZE, "REPLACE INTO %s VALUES(?,?);", m_tableName);
+  int retCode = sqlite3_prepare_v2(m_dbHandle, query, -1, &m_insertStmt, 0);
 
-  LOGDEBUG("SqLiteHelper::insertKeyValue Inserting key value with query:%s",
-           query);
+  if (retCode == SQLITE_OK) {
+    SNPRINTF(query, QUERY_SIZE, "DELETE FROM %s WHERE key=?;", m_tableName);
+    retCode = sqlite3_prepare_v2(m_dbHandle, query, -1, &m_removeStmt, 0);
+  }
 
-  // prepare statement
-  sqlite3_stmt *stmt;
-  int retCode = sqlite3_prepare_v2(m_dbHandle, query, -1, &stmt, 0);
   if (retCode == SQLITE_OK) {
-    // bind parameters and execte statement
-    sqlite3_bind_blob(stmt, 1, keyData, keyDataSize, 0);
-    sqlite3_bind_blob(stmt, 2, valueData, valueDataSize, 0);
-    retCode = sqlite3_step(stmt);
+    SNPRINTF(query, QUERY_SIZE,
+             "SELECT value, length(value) AS valLength FROM %s WHERE key=?;",
+             m_tableName);
+    retCode = sqlite3_prepare_v2(m_dbHandle, query, -1, &m_getStmt, 0);
   }
 
-  sqlite3_finalize(stmt);
+  if (retCode == SQLITE_OK) {
+    retCode = sqlite3_prepare_v2(m_dbHandle, "BEGIN;", -1, &m_beginStmt, 0);
+  }
+
+  if (retCode == SQLITE_OK) {
+    retCode = sqlite3_prepare_v2(m_dbHandle, "COMMIT;", -1, &m_commitStmt, 0);
+  }
+
+  LOGDEBUG("SqLiteHelper::prepareStatements prepared statements for table %s",
+           m_tableName);
+  return retCode;
+}
+
+void SqLiteHelper::finalizeStatements() {
+  sqlite3_stmt **stmts[] = {&m_insertStmt, &m_removeStmt, &m_getStmt,
+                            &m_beginStmt, &m_commitStmt};
+  for (size_t i = 0; i < sizeof(stmts) / sizeof(stmts[0]); i++) {
+    // finalizing a nullptr is a harmless no-op
+    sqlite3_finalize(*stmts[i]);
+    *stmts[i] = nullptr;
+  }
+}
+
+int SqLiteHelper::executeStatement(sqlite3_stmt *stmt) {
+  int retCode = sqlite3_step(stmt);
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
   return retCode == SQLITE_DONE ? 0 : retCode;
 }
 
-int SqLiteHelper::removeKey(void *keyData, uint32_t keyDataSize) {
-  // construct query
-  char query[QUERY_SIZE];
-  SNPRINTF(query, QUERY_SIZE, "DELETE FROM %s WHERE key=?;", m_tableName);
+int SqLiteHelper::beginWrite() {
+  if (m_maxBatchSize <= 1) {
+    return 0;
+  }
+  // an error, such as a full database, makes SQLite roll the batch back
+  if (m_batchCount > 0 && sqlite3_get_autocommit(m_dbHandle)) {
+    LOGERROR("SqLiteHelper::beginWrite %d writes to table %s were rolled back",
+             m_batchCount, m_tableName);
+    m_batchCount = 0;
+  }
+  if (m_batchCount > 0) {
+    return 0;
+  }
+  int retCode = executeStatement(m_beginStmt);
+  if (retCode == 0) {
+    m_batchStart = std::chrono::steady_clock::now();
+    m_flushCond.notify_one();
+  }
+  return retCode;
+}
 
-  LOGDEBUG("SqLiteHelper::removeKey Removing key with query:%s", query);
+int SqLiteHelper::endWrite(int retCode) {
+  if (m_maxBatchSize <= 1) {
+    return retCode;
+  }
+  if (sqlite3_get_autocommit(m_dbHandle)) {
+    LOGERROR("SqLiteHelper::endWrite %d writes to table %s were rolled back",
+             m_batchCount, m_tableName);
+    m_batchCount = 0;
+    return retCode;
+  }
+  m_batchCount++;
+  if (m_batchCount >= m_maxBatchSize ||
+      std::chrono::steady_clock::now() - m_batchStart >= m_flushInterval) {
+    int commitCode = commitBatch();
+    if (retCode == 0) retCode = commitCode;
+  }
+  return retCode;
+}
 
-  // prepare statement
-  sqlite3_stmt *stmt;
-  int retCode = sqlite3_prepare_v2(m_dbHandle, query, -1, &stmt, 0);
-  if (retCode == SQLITE_OK) {
+int SqLiteHelper::commitBatch() {
+  if (m_batchCount == 0) {
+    return 0;
+  }
+  LOGDEBUG("SqLiteHelper::commitBatch committing %d writes for table %s",
+           m_batchCount, m_tableName);
+  int retCode = executeStatement(m_commitStmt);
+  // a commit that failed, say on a busy database, leaves the batch open
+  // unless SQLite rolled it back
+  if (retCode == 0 || sqlite3_get_autocommit(m_dbHandle)) {
+    m_batchCount = 0;
+  }
+  return retCode;
+}
+
+void SqLiteHelper::flushOnInterval() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_closing) {
+    if (m_batchCount == 0) {
+      m_flushCond.wait(lock);
+    } else if (std::chrono::steady_clock::now() - m_batchStart >=
+               m_flushInterval) {
+      if (commitBatch() != 0) {
+        // retried on the next write or interval
+        m_batchStart = std::chrono::steady_clock::now();
+      }
+    } else {
+      m_flushCond.wait_until(lock, m_batchStart + m_flushInterval);
+    }
+  }
+}
+
+void SqLiteHelper::stopFlushThread() {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_closing = true;
+  }
+  m_flushCond.notify_all();
+  if (m_flushThread.joinable()) {
+    m_flushThread.join();
+  }
+}
+
+int SqLiteHelper::insertKeyValue(void *keyData, uint32_t keyDataSize,
+                                 void *valueData, uint32_t valueDataSize) {
+  LOGDEBUG("SqLiteHelper::insertKeyValue Inserting key value in table:%s",
+           m_tableName);
+
+  std::lock_guard<std::mutex> guard(m_mutex);
+  int retCode = beginWrite();
+  if (retCode == 0) {
     // bind parameters and execte statement
-    sqlite3_bind_blob(stmt, 1, keyData, keyDataSize, 0);
-    retCode = sqlite3_step(stmt);
+    sqlite3_bind_blob(m_insertStmt, 1, keyData, keyDataSize, 0);
+    sqlite3_bind_blob(m_insertStmt, 2, valueData, valueDataSize, 0);
+    retCode = endWrite(executeStatement(m_insertStmt));
   }
+  return retCode;
+}
 
-  sqlite3_finalize(stmt);
-  return retCode == SQLITE_DONE ? 0 : retCode;
+int SqLiteHelper::removeKey(void *keyData, uint32_t keyDataSize) {
+  LOGDEBUG("SqLiteHelper::removeKey Removing key from table:%s", m_tableName);
+
+  std::lock_guard<std::mutex> guard(m_mutex);
+  int retCode = beginWrite();
+  if (retCode == 0) {
+    // bind parameters and execte statement
+    sqlite3_bind_blob(m_removeStmt, 1, keyData, keyDataSize, 0);
+    retCode = endWrite(executeStatement(m_removeStmt));
+  }
+  return retCode;
 }
 
 int SqLiteHelper::getValue(void *keyData, uint32_t keyDataSize,
                            void *&valueData, uint32_t &valueDataSize) {
-  // construct query
+  LOGDEBUG("SqLiteHelper::getValue Getting value from table:%s", m_tableName);
+
+  // reads see the writes of the uncommitted batch on this same connection
+  std::lock_guard<std::mutex> guard(m_mutex);
+  // bind parameters and execte statement
+  sqlite3_bind_blob(m_getStmt, 1, keyData, keyDataSize, 0);
+  int retCode = sqlite3_step(m_getStmt);
+  if (retCode == SQLITE_ROW)  // we will get only one row
+  {
+    const void *tempBuff = sqlite3_column_blob(m_getStmt, 0);
+    valueDataSize = sqlite3_column_int(m_getStmt, 1);
+    valueData =
+        reinterpret_cast<uint8_t *>(malloc(sizeof(uint8_t) * valueDataSize));
+    memcpy(valueData, tempBuff, valueDataSize);
+    retCode = sqlite3_step(m_getStmt);
+  }
+
+  sqlite3_reset(m_getStmt);
+  sqlite3_clear_bindings(m_getStmt);
+  return retCode == SQLITE_DONE ? 0 : retCode;
+}
+
+int SqLiteHelper::flush() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return commitBatch();
+}
+
+int SqLiteHelper::checkpoint() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  int retCode = commitBatch();
+  if (retCode == 0) {
+    retCode = sqlite3_wal_checkpoint_v2(m_dbHandle, nullptr,
+                                        SQLITE_CHECKPOINT_PASSIVE, nullptr,
+                                        nullptr);
+  }
+  return retCode;
+}
+
+int SqLiteHelper::readAll(int (*callback)(void *arg, const void *keyData,
+                                          uint32_t keyDataSize,
+                                          const void *valueData,
+                                          uint32_t valueDataSize),
+                          void *arg) {
   char query[QUERY_SIZE];
-  SNPRINTF(query, QUERY_SIZE,
-           "SELECT value, length(value) AS valLength FROM %s WHERE key=?;",
-           m_tableName);
+  SNPRINTF(query, QUERY_SIZE, "SELECT key, value FROM %s;", m_tableName);
 
-  LOGDEBUG("SqLiteHelper::getValue Getting value with query:%s", query);
+  LOGDEBUG("SqLiteHelper::readAll Reading all entries with query:%s", query);
 
-  // prepare statement
-  sqlite3_stmt *stmt;
+  std::lock_guard<std::mutex> guard(m_mutex);
+  sqlite3_stmt *stmt = nullptr;
   int retCode = sqlite3_prepare_v2(m_dbHandle, query, -1, &stmt, 0);
+  // finalized even if the callback throws
+  std::unique_ptr<sqlite3_stmt, int (*)(sqlite3_stmt *)> finalizer(
+      stmt, sqlite3_finalize);
   if (retCode == SQLITE_OK) {
-    // bind parameters and execte statement
-    sqlite3_bind_blob(stmt, 1, keyData, keyDataSize, 0);
-    retCode = sqlite3_step(stmt);
-    if (retCode == SQLITE_ROW)  // we will get only one row
-    {
-      void *tempBuff = const_cast<void *>(sqlite3_column_blob(stmt, 0));
-      valueDataSize = sqlite3_column_int(stmt, 1);
-      valueData =
-          reinterpret_cast<uint8_t *>(malloc(sizeof(uint8_t) * valueDataSize));
-      memcpy(valueData, tempBuff, valueDataSize);
-      retCode = sqlite3_step(stmt);
+    while ((retCode = sqlite3_step(stmt)) == SQLITE_ROW) {
+      const void *keyData = sqlite3_column_blob(stmt, 0);
+      uint32_t keyDataSize = sqlite3_column_bytes(stmt, 0);
+      const void *valueData = sqlite3_column_blob(stmt, 1);
+      uint32_t valueDataSize = sqlite3_column_bytes(stmt, 1);
+      if (callback(arg, keyData, keyDataSize, valueData, valueDataSize) !=
+          0) {
+        retCode = SQLITE_DONE;
+        break;
+      }
     }
   }
 
-  sqlite3_finalize(stmt);
   return retCode == SQLITE_DONE ? 0 : retCode;
 }
 
@@ -161,6 +362,10 @@ int SqLiteHelper::dropTable() {
 int SqLiteHelper::closeDB() {
   LOGDEBUG("SqLiteHelper::closeDB closing the database for region %s",
            m_tableName);
+  stopFlushThread();
+  std::lock_guard<std::mutex> guard(m_mutex);
+  commitBatch();
+  finalizeStatements();
   int retCode = dropTable();
   if (retCode == SQLITE_OK) retCode = sqlite3_close(m_dbHandle);
 
@@ -168,11 +373,16 @@ int SqLiteHelper::closeDB() {
 }
 
 int SqLiteHelper::executePragma(const char *pragmaName, int pragmaValue) {
-  // create query
-  char query[QUERY_SIZE];
   char strVal[50];
   SNPRINTF(strVal, 50, "%d", pragmaValue);
-  SNPRINTF(query, QUERY_SIZE, "PRAGMA %s = %s;", pragmaName, strVal);
+  return executePragma(pragmaName, strVal);
+}
+
+int SqLiteHelper::executePragma(const char *pragmaName,
+                                const char *pragmaValue) {
+  // create query
+  char query[QUERY_SIZE];
+  SNPRINTF(query, QUERY_SIZE, "PRAGMA %s = %s;", pragmaName, pragmaValue);
 
   LOGDEBUG("SqLiteHelper::executePragma Executing pragma query:%s", query);
 
@@ -182,9 +392,11 @@ int SqLiteHelper::executePragma(const char *pragmaName, int pragmaValue) {
   retCode = sqlite3_prepare_v2(m_dbHandle, query, -1, &stmt, 0);
 
   // execute PRAGMA
-  if (retCode == SQLITE_OK &&
-      sqlite3_step(stmt) == SQLITE_ROW) {  // PRAGMA command return one row
+  if (retCode == SQLITE_OK) {
     retCode = sqlite3_step(stmt);
+    if (retCode == SQLITE_ROW) {  // some PRAGMA commands return one row
+      retCode = sqlite3_step(stmt);
+    }
   }
 
   sqlite3_finalize(stmt);
@@ -25,6 +25,10 @@
 #include <geode/PersistenceManager.hpp>
 #include <geode/GeodeCppCache.hpp>
 #include <sys/types.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #ifndef WIN32
 #include <unistd.h>
 #include <sys/stat.h>
@@ -40,13 +44,36 @@ using namespace apache::geode::client;
 
 class SqLiteHelper {
  public:
+  SqLiteHelper();
+  ~SqLiteHelper();
+
   int initDB(const char* regionName, int maxPageCount, int pageSize,
-             const char* regionDBfile, int busy_timeout_ms = 5000);
+             const char* regionDBfile, int busy_timeout_ms = 5000,
+             const char* journalMode = "WAL", int maxBatchSize = 100,
+             int flushIntervalMs = 1000);
   int insertKeyValue(void* keyData, uint32_t keyDataSize, void* valueData,
                      uint32_t valueDataSize);
   int removeKey(void* keyData, uint32_t keyDataSize);
   int getValue(void* keyData, uint32_t keyDataSize, void*& valueData,
                uint32_t& valueDataSize);
+  /**
+   * Commits the writes of the batch in progress, if any.
+   */
+  int flush();
+  /**
+   * Commits the batch in progress and copies the write-ahead log into the
+   * database file.
+   */
+  int checkpoint();
+  /**
+   * Reads every stored entry with a single statement, passing the
+   * serialized key and value to the callback; stops at the first non-zero
+   * value returned by the callback.
+   */
+  int readAll(int (*callback)(void* arg, const void* keyData,
+                              uint32_t keyDataSize, const void* valueData,
+                              uint32_t valueDataSize),
+              void* arg);
   int closeDB();
 
  private:
@@ -54,9 +81,40 @@ class SqLiteHelper {
 
   const char* m_tableName;
   // std::string regionName;
+
+  // statements prepared once for the table and reused by every operation
+  sqlite3_stmt* m_insertStmt;
+  sqlite3_stmt* m_removeStmt;
+  sqlite3_stmt* m_getStmt;
+  sqlite3_stmt* m_beginStmt;
+  sqlite3_stmt* m_commitStmt;
+
+  // writes are grouped in transactions of up to m_maxBatchSize operations,
+  // committed by m_flushThread at the latest m_flushInterval after the
+  // first one
+  int m_maxBatchSize;
+  std::chrono::milliseconds m_flushInterval;
+  int m_batchCount;
+  std::chrono::steady_clock::time_point m_batchStart;
+  std::thread m_flushThread;
+  std::condition_variable m_flushCond;
+  bool m_closing;
+
+  // cached statements must not be used by two threads at a time
+  std::mutex m_mutex;
+
   int dropTable();
   int createTable();
+  int prepareStatements();
+  void finalizeStatements();
+  int beginWrite();
+  int endWrite(int retCode);
+  int commitBatch();
+  void flushOnInterval();
+  void stopFlushThread();
+  int executeStatement(sqlite3_stmt* stmt);
   int executePragma(const char* pragmaName, int pragmaValue);
+  int executePragma(const char* pragmaName, const char* pragmaValue);
 };
 
 #endif  // GEODE_SQLITEIMPL_SQLITEHELPER_H_
@@ -22,6 +22,24 @@
 
 namespace {
 std::string g_default_persistence_directory = "GeodeRegionData";
+std::string g_default_journal_mode = "WAL";
+int g_default_max_batch_size = 100;
+int g_default_flush_interval = 1000;
+
+// checks that a stored entry can be deserialized
+int checkEntry(void* arg, const void* keyData, uint32_t keyDataSize,
+               const void* valueData, uint32_t valueDataSize) {
+  CacheableKeyPtr key;
+  CacheablePtr value;
+  DataInput keyDataBuffer(reinterpret_cast<const uint8_t*>(keyData),
+                          keyDataSize);
+  keyDataBuffer.readObject(key);
+  DataInput valueDataBuffer(reinterpret_cast<const uint8_t*>(valueData),
+                            valueDataSize);
+  valueDataBuffer.readObject(value);
+  ++*reinterpret_cast<int*>(arg);
+  return 0;
+}
 }  // namespace
 
 using namespace apache::geode::client;
@@ -31,12 +49,19 @@ void SqLiteImpl::init(const RegionPtr& region, PropertiesPtr& diskProperties) {
 
   int maxPageCount = 0;
   int pageSize = 0;
+  std::string journalMode = g_default_journal_mode;
+  int maxBatchSize = g_default_max_batch_size;
+  int flushInterval = g_default_flush_interval;
   m_persistanceDir = g_default_persistence_directory;
+  m_regionPtr = region;
   std::string regionName = region->getName();
   if (diskProperties != nullptr) {
     CacheableStringPtr maxPageCountPtr = diskProperties->find(MAX_PAGE_COUNT);
     CacheableStringPtr pageSizePtr = diskProperties->find(PAGE_SIZE);
     CacheableStringPtr persDir = diskProperties->find(PERSISTENCE_DIR);
+    CacheableStringPtr journalModePtr = diskProperties->find(JOURNAL_MODE);
+    CacheableStringPtr maxBatchSizePtr = diskProperties->find(MAX_BATCH_SIZE);
+    CacheableStringPtr flushIntervalPtr = diskProperties->find(FLUSH_INTERVAL);
 
     if (maxPageCountPtr != nullptr) {
       maxPageCount = atoi(maxPageCountPtr->asChar());
@@ -45,6 +70,16 @@ void SqLiteImpl::init(const RegionPtr& region, PropertiesPtr& diskProperties) {
     if (pageSizePtr != nullptr) pageSize = atoi(pageSizePtr->asChar());
 
     if (persDir != nullptr) m_persistanceDir = persDir->asChar();
+
+    if (journalModePtr != nullptr) journalMode = journalModePtr->asChar();
+
+    if (maxBatchSizePtr != nullptr) {
+      maxBatchSize = atoi(maxBatchSizePtr->asChar());
+    }
+
+    if (flushIntervalPtr != nullptr) {
+      flushInterval = atoi(flushIntervalPtr->asChar());
+    }
   }
 
 #ifndef _WIN32
@@ -100,7 +135,8 @@ void SqLiteImpl::init(const RegionPtr& region, PropertiesPtr& diskProperties) {
 #endif
 
   if (m_sqliteHelper->initDB(region->getName(), maxPageCount, pageSize,
-                             m_regionDBFile.c_str()) != 0) {
+                             m_regionDBFile.c_str(), 5000, journalMode.c_str(),
+                             maxBatchSize, flushInterval) != 0) {
     throw IllegalStateException("Failed to initialize database in SQLITE.");
   }
 }
@@ -123,7 +159,13 @@ void SqLiteImpl::write(const CacheableKeyPtr& key, const CacheablePtr& value,
   }
 }
 
-bool SqLiteImpl::writeAll() { return true; }
+bool SqLiteImpl::writeAll() {
+  // every write is already in the database; make it durable in one go
+  if (m_sqliteHelper->checkpoint() != 0) {
+    throw IllegalStateException("Failed to write all entries in SQLITE.");
+  }
+  return true;
+}
 
 CacheablePtr SqLiteImpl::read(const CacheableKeyPtr& key, void*& dbHandle) {
   // Serialize key.
@@ -150,7 +192,23 @@ CacheablePtr SqLiteImpl::read(const CacheableKeyPtr& key, void*& dbHandle) {
   return retValue;
 }
 
-bool SqLiteImpl::readAll() { return true; }
+bool SqLiteImpl::readAll() {
+  int numEntries = 0;
+  try {
+    if (m_sqliteHelper->readAll(checkEntry, &numEntries) != 0) {
+      LOGERROR("SqLiteImpl::readAll failed to read entries for region %s",
+               m_regionPtr->getFullPath());
+      return false;
+    }
+  } catch (const Exception& ex) {
+    LOGERROR("SqLiteImpl::readAll failed to deserialize entry %d: %s: %s",
+             numEntries, ex.getName(), ex.getMessage());
+    return false;
+  }
+  LOGFINE("SqLiteImpl::readAll read %d entries for region %s", numEntries,
+          m_regionPtr->getFullPath());
+  return true;
+}
 
 void SqLiteImpl::destroyRegion() {
   if (m_sqliteHelper->closeDB() != 0) {
@@ -159,10 +217,14 @@ void SqLiteImpl::destroyRegion() {
 
 #ifndef _WIN32
   ::unlink(m_regionDBFile.c_str());
+  ::unlink((m_regionDBFile + "-wal").c_str());
+  ::unlink((m_regionDBFile + "-shm").c_str());
   ::rmdir(m_regionDir.c_str());
   ::rmdir(m_persistanceDir.c_str());
 #else
   DeleteFile(m_regionDBFile.c_str());
+  DeleteFile((m_regionDBFile + "-wal").c_str());
+  DeleteFile((m_regionDBFile + "-shm").c_str());
   RemoveDirectory(m_regionDir.c_str());
   RemoveDirectory(m_persistanceDir.c_str());
 #endif
@@ -187,10 +249,14 @@ void SqLiteImpl::close() {
 
 #ifndef _WIN32
   ::unlink(m_regionDBFile.c_str());
+  ::unlink((m_regionDBFile + "-wal").c_str());
+  ::unlink((m_regionDBFile + "-shm").c_str());
   ::rmdir(m_regionDir.c_str());
   ::rmdir(m_persistanceDir.c_str());
 #else
   DeleteFile(m_regionDBFile.c_str());
+  DeleteFile((m_regionDBFile + "-wal").c_str());
+  DeleteFile((m_regionDBFile + "-shm").c_str());
   RemoveDirectory(m_regionDir.c_str());
   RemoveDirectory(m_persistanceDir.c_str());
 #endif
@@ -61,7 +61,8 @@ class SqLiteImpl : public PersistenceManager {
              void*& dbHandle);
 
   /**
-   * Writes the entire region into the SqLite implementation.
+   * Writes the entire region into the SqLite implementation by committing
+   * the batch of writes in progress and checkpointing the write-ahead log.
    * @throws DiskFailureException if the write fails due to disk fail.
    */
   bool writeAll();
@@ -76,7 +77,9 @@ class SqLiteImpl : public PersistenceManager {
   CacheablePtr read(const CacheableKeyPtr& key, void*& dbHandle);
 
   /**
-   * Read all the keys and values for a region stored in SqLite.
+   * Read all the keys and values for a region stored in SqLite with a single
+   * statement.
+   * @return false if an entry could not be read or deserialized.
    */
   bool readAll();
 